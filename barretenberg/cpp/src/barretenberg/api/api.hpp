@@ -24,6 +24,10 @@ class API {
                                    // recursive verifier) or is it for an ivc verifier?
         bool write_vk{ false };    // should we addditionally write the verification key when writing the proof
         bool include_gates_per_opcode{ false }; // should we include gates_per_opcode in the gates command output
+        std::filesystem::path proving_key_cache_path{ "" }; // directory of the proving key cache; empty disables it
+        uint32_t streamed_sumcheck_rounds{ 0 };        // sumcheck rounds streamed over the full polynomials
+        std::filesystem::path sumcheck_spill_dir{ "" }; // where to spill the prover polynomials; empty disables it
+        size_t fixed_base_msm_memory_budget{ 0 }; // MiB of precomputed SRS multiples for commitments; 0 disables them
 
         friend std::ostream& operator<<(std::ostream& os, const Flags& flags)
         {
@@ -42,6 +46,10 @@ class API {
                << "  verifier_type: " << flags.verifier_type << "\n"
                << "  write_vk " << flags.write_vk << "\n"
                << "  include_gates_per_opcode " << flags.include_gates_per_opcode << "\n"
+               << "  proving_key_cache_path " << flags.proving_key_cache_path << "\n"
+               << "  streamed_sumcheck_rounds " << flags.streamed_sumcheck_rounds << "\n"
+               << "  sumcheck_spill_dir " << flags.sumcheck_spill_dir << "\n"
+               << "  fixed_base_msm_memory_budget " << flags.fixed_base_msm_memory_budget << "\n"
                << "]" << std::endl;
             return os;
         }
@@ -3,6 +3,7 @@
 #include "barretenberg/api/acir_format_getters.hpp"
 #include "barretenberg/api/file_io.hpp"
 #include "barretenberg/api/gate_count.hpp"
+#include "barretenberg/api/proving_key_cache.hpp"
 #include "barretenberg/api/write_prover_output.hpp"
 #include "barretenberg/common/map.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
@@ -12,6 +13,8 @@
 #include "barretenberg/honk/proof_system/types/proof.hpp"
 #include "barretenberg/honk/types/aggregation_object_type.hpp"
 #include "barretenberg/srs/global_crs.hpp"
+#include <thread>
+#include <unistd.h>
 
 namespace bb {
 
@@ -47,41 +50,100 @@ Circuit _compute_circuit(const std::string& bytecode_path, const std::string& wi
 }
 
 template <typename Flavor>
-std::shared_ptr<DeciderProvingKey_<Flavor>> _compute_proving_key(const std::string& bytecode_path,
-                                                                 const std::string& witness_path)
+std::shared_ptr<DeciderProvingKey_<Flavor>> _compute_proving_key(
+    const std::string& bytecode_path,
+    const std::string& witness_path,
+    std::vector<typename Flavor::Polynomial> precomputed_polynomials = {})
 {
     typename Flavor::CircuitBuilder builder = _compute_circuit<Flavor>(bytecode_path, witness_path);
-    auto decider_proving_key = std::make_shared<DeciderProvingKey_<Flavor>>(builder);
+    auto decider_proving_key = std::make_shared<DeciderProvingKey_<Flavor>>(
+        builder, TraceSettings{}, typename Flavor::CommitmentKey(), std::move(precomputed_polynomials));
     return decider_proving_key;
 }
 
+/**
+ * @brief The proving key cache entry of the circuit at `bytecode_path`, if a cache directory has been configured.
+ * @note Bytecode read from stdin cannot be hashed without consuming it, so such circuits are never cached.
+ */
+template <typename Flavor>
+std::optional<ProvingKeyCache<Flavor>> _proving_key_cache(const std::filesystem::path& proving_key_cache_path,
+                                                          const std::filesystem::path& bytecode_path)
+{
+    if (proving_key_cache_path.empty() || bytecode_path == "-") {
+        return std::nullopt;
+    }
+    return ProvingKeyCache<Flavor>(proving_key_cache_path, read_file(bytecode_path));
+}
+
 template <typename Flavor>
 PubInputsProofAndKey<typename Flavor::VerificationKey> _compute_vk(const std::filesystem::path& bytecode_path,
-                                                                   const std::filesystem::path& witness_path)
+                                                                   const std::filesystem::path& witness_path,
+                                                                   const std::filesystem::path& proving_key_cache_path)
 {
+    using VerificationKey = typename Flavor::VerificationKey;
+
+    auto cache = _proving_key_cache<Flavor>(proving_key_cache_path, bytecode_path);
+    if (cache) {
+        if (auto entry = cache->load()) {
+            return { PublicInputsVector{}, HonkProof{}, entry->verification_key };
+        }
+    }
     auto proving_key = _compute_proving_key<Flavor>(bytecode_path.string(), witness_path.string());
-    return { PublicInputsVector{},
-             HonkProof{},
-             std::make_shared<typename Flavor::VerificationKey>(proving_key->proving_key) };
+    auto vk = std::make_shared<VerificationKey>(proving_key->proving_key);
+    if (cache) {
+        cache->store(*proving_key, *vk);
+    }
+    return { PublicInputsVector{}, HonkProof{}, vk };
 }
 
 template <typename Flavor>
-PubInputsProofAndKey<typename Flavor::VerificationKey> _prove(const bool compute_vk,
+PubInputsProofAndKey<typename Flavor::VerificationKey> _prove(const API::Flags& flags,
                                                               const std::filesystem::path& bytecode_path,
                                                               const std::filesystem::path& witness_path,
                                                               const std::filesystem::path& vk_path)
 {
-    auto proving_key = _compute_proving_key<Flavor>(bytecode_path.string(), witness_path.string());
-    std::shared_ptr<typename Flavor::VerificationKey> vk;
-    if (compute_vk) {
+    using VerificationKey = typename Flavor::VerificationKey;
+    const bool compute_vk = flags.write_vk;
+    const std::filesystem::path& proving_key_cache_path = flags.proving_key_cache_path;
+
+    // On a cache hit, the circuit is still built from the witness, but its precomputed polynomials are mapped from the
+    // cache rather than recomputed, and the vk does not have to be committed to
+    auto cache = _proving_key_cache<Flavor>(proving_key_cache_path, bytecode_path);
+    std::optional<typename ProvingKeyCache<Flavor>::Entry> cache_entry;
+    if (cache) {
+        cache_entry = cache->load();
+    }
+    std::vector<typename Flavor::Polynomial> precomputed_polynomials;
+    if (cache_entry) {
+        precomputed_polynomials = std::move(cache_entry->precomputed_polynomials);
+    }
+    auto proving_key = _compute_proving_key<Flavor>(
+        bytecode_path.string(), witness_path.string(), std::move(precomputed_polynomials));
+
+    std::shared_ptr<VerificationKey> vk;
+    if (compute_vk && cache_entry) {
+        vk = cache_entry->verification_key;
+    } else if (compute_vk) {
         info("WARNING: computing verification key while proving. Pass in a precomputed vk for better performance.");
-        vk = std::make_shared<typename Flavor::VerificationKey>(proving_key->proving_key);
+        vk = std::make_shared<VerificationKey>(proving_key->proving_key);
     } else {
-        vk = std::make_shared<typename Flavor::VerificationKey>(
-            from_buffer<typename Flavor::VerificationKey>(read_file(vk_path)));
+        vk = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(read_file(vk_path)));
+    }
+    if (cache && !cache_entry) {
+        // A cache entry has to be self-consistent, so we do not store a vk we were handed
+        cache->store(*proving_key, compute_vk ? *vk : VerificationKey(proving_key->proving_key));
     }
 
     UltraProver_<Flavor> prover{ proving_key, vk };
+    prover.num_streamed_sumcheck_rounds = flags.streamed_sumcheck_rounds;
+    if (!flags.sumcheck_spill_dir.empty()) {
+        // Named after the process and thread, so that concurrent provers (e.g. in server mode) do not collide
+        prover.sumcheck_spill_path =
+            flags.sumcheck_spill_dir / format("prover_polynomials_",
+                                              getpid(),
+                                              "_",
+                                              std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    }
 
     HonkProof concat_pi_and_proof = prover.construct_proof();
     size_t num_inner_public_inputs = prover.proving_key->proving_key.num_public_inputs;
@@ -105,14 +167,24 @@ PubInputsProofAndKey<typename Flavor::VerificationKey> _prove(const bool compute
     return { public_inputs_and_proof.public_inputs, public_inputs_and_proof.proof, vk };
 }
 
+/**
+ * @brief The inputs of the verifier for one proof, as written by prove and write_vk
+ */
+template <typename Flavor> struct VerifierInputs {
+    std::shared_ptr<typename Flavor::VerificationKey> vk;
+    // The public inputs followed by the proof
+    HonkProof proof;
+    // Only with ipa_accumulation
+    HonkProof ipa_proof;
+};
+
 template <typename Flavor>
-bool _verify(const bool ipa_accumulation,
-             const std::filesystem::path& public_inputs_path,
-             const std::filesystem::path& proof_path,
-             const std::filesystem::path& vk_path)
+VerifierInputs<Flavor> _read_verifier_inputs(const bool ipa_accumulation,
+                                             const std::filesystem::path& public_inputs_path,
+                                             const std::filesystem::path& proof_path,
+                                             const std::filesystem::path& vk_path)
 {
     using VerificationKey = typename Flavor::VerificationKey;
-    using Verifier = UltraVerifier_<Flavor>;
 
     auto vk = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(read_file(vk_path)));
     auto public_inputs = many_from_buffer<bb::fr>(read_file(public_inputs_path));
@@ -121,14 +193,7 @@ bool _verify(const bool ipa_accumulation,
     std::vector<fr> complete_proof = public_inputs;
     complete_proof.insert(complete_proof.end(), proof.begin(), proof.end());
 
-    VerifierCommitmentKey<curve::Grumpkin> ipa_verification_key;
-    if (ipa_accumulation) {
-        ipa_verification_key = VerifierCommitmentKey<curve::Grumpkin>(1 << CONST_ECCVM_LOG_N);
-    }
-
-    Verifier verifier{ vk, ipa_verification_key };
-
-    bool verified;
+    HonkProof ipa_proof;
     if (ipa_accumulation) {
         const size_t HONK_PROOF_LENGTH = Flavor::PROOF_LENGTH_WITHOUT_PUB_INPUTS - IPA_PROOF_LENGTH;
         const size_t num_public_inputs = static_cast<size_t>(vk->num_public_inputs);
@@ -138,9 +203,31 @@ bool _verify(const bool ipa_accumulation,
                      "Honk proof has incorrect length while verifying.");
         const std::ptrdiff_t honk_proof_with_pub_inputs_length =
             static_cast<std::ptrdiff_t>(HONK_PROOF_LENGTH + num_public_inputs);
-        auto ipa_proof = HonkProof(complete_proof.begin() + honk_proof_with_pub_inputs_length, complete_proof.end());
-        auto tube_honk_proof =
-            HonkProof(complete_proof.begin(), complete_proof.begin() + honk_proof_with_pub_inputs_length);
+        ipa_proof = HonkProof(complete_proof.begin() + honk_proof_with_pub_inputs_length, complete_proof.end());
+    }
+    return { vk, std::move(complete_proof), std::move(ipa_proof) };
+}
+
+template <typename Flavor>
+bool _verify(const bool ipa_accumulation,
+             const std::filesystem::path& public_inputs_path,
+             const std::filesystem::path& proof_path,
+             const std::filesystem::path& vk_path)
+{
+    using Verifier = UltraVerifier_<Flavor>;
+
+    auto [vk, complete_proof, ipa_proof] =
+        _read_verifier_inputs<Flavor>(ipa_accumulation, public_inputs_path, proof_path, vk_path);
+
+    VerifierCommitmentKey<curve::Grumpkin> ipa_verification_key;
+    if (ipa_accumulation) {
+        ipa_verification_key = VerifierCommitmentKey<curve::Grumpkin>(1 << CONST_ECCVM_LOG_N);
+    }
+
+    Verifier verifier{ vk, ipa_verification_key };
+
+    bool verified;
+    if (ipa_accumulation) {
         verified = verifier.verify_proof(complete_proof, ipa_proof);
     } else {
         verified = verifier.verify_proof(complete_proof);
@@ -155,6 +242,33 @@ bool _verify(const bool ipa_accumulation,
     return verified;
 }
 
+template <typename Flavor>
+std::vector<bool> _batch_verify(const bool ipa_accumulation, const std::vector<std::filesystem::path>& proof_dirs)
+{
+    std::vector<std::shared_ptr<typename Flavor::VerificationKey>> vks;
+    std::vector<HonkProof> proofs;
+    std::vector<HonkProof> ipa_proofs;
+    for (const auto& dir : proof_dirs) {
+        auto [vk, complete_proof, ipa_proof] =
+            _read_verifier_inputs<Flavor>(ipa_accumulation, dir / "public_inputs", dir / "proof", dir / "vk");
+        vks.emplace_back(std::move(vk));
+        proofs.emplace_back(std::move(complete_proof));
+        ipa_proofs.emplace_back(std::move(ipa_proof));
+    }
+
+    VerifierCommitmentKey<curve::Grumpkin> ipa_verification_key;
+    if (ipa_accumulation) {
+        ipa_verification_key = VerifierCommitmentKey<curve::Grumpkin>(1 << CONST_ECCVM_LOG_N);
+    }
+    std::vector<bool> verified =
+        UltraVerifier_<Flavor>::batch_verify_proofs(vks, proofs, ipa_proofs, ipa_verification_key);
+
+    for (size_t i = 0; i < proof_dirs.size(); i++) {
+        info(proof_dirs[i].string(), verified[i] ? ": proof verified successfully" : ": proof verification failed");
+    }
+    return verified;
+}
+
 bool UltraHonkAPI::check([[maybe_unused]] const Flags& flags,
                          [[maybe_unused]] const std::filesystem::path& bytecode_path,
                          [[maybe_unused]] const std::filesystem::path& witness_path)
@@ -174,23 +288,23 @@ void UltraHonkAPI::prove(const Flags& flags,
     };
     // if the ipa accumulation flag is set we are using the UltraRollupFlavor
     if (flags.ipa_accumulation) {
-        _write(_prove<UltraRollupFlavor>(flags.write_vk, bytecode_path, witness_path, vk_path));
+        _write(_prove<UltraRollupFlavor>(flags, bytecode_path, witness_path, vk_path));
     } else if (flags.oracle_hash_type == "poseidon2" && !flags.disable_zk) {
         // if we are not disabling ZK and the oracle hash type is poseidon2, we are using the UltraZKFlavor
-        _write(_prove<UltraZKFlavor>(flags.write_vk, bytecode_path, witness_path, vk_path));
+        _write(_prove<UltraZKFlavor>(flags, bytecode_path, witness_path, vk_path));
     } else if (flags.oracle_hash_type == "poseidon2" && flags.disable_zk) {
         // if we are disabling ZK and the oracle hash type is poseidon2, we are using the UltraFlavor
-        _write(_prove<UltraFlavor>(flags.write_vk, bytecode_path, witness_path, vk_path));
+        _write(_prove<UltraFlavor>(flags, bytecode_path, witness_path, vk_path));
     } else if (flags.oracle_hash_type == "keccak" && !flags.disable_zk) {
         // if we are not disabling ZK and the oracle hash type is keccak, we are using the UltraKeccakZKFlavor
-        _write(_prove<UltraKeccakZKFlavor>(flags.write_vk, bytecode_path, witness_path, vk_path));
+        _write(_prove<UltraKeccakZKFlavor>(flags, bytecode_path, witness_path, vk_path));
     } else if (flags.oracle_hash_type == "keccak" && flags.disable_zk) {
-        _write(_prove<UltraKeccakFlavor>(flags.write_vk, bytecode_path, witness_path, vk_path));
+        _write(_prove<UltraKeccakFlavor>(flags, bytecode_path, witness_path, vk_path));
 #ifdef STARKNET_GARAGA_FLAVORS
     } else if (flags.oracle_hash_type == "starknet" && flags.disable_zk) {
-        _write(_prove<UltraStarknetFlavor>(flags.write_vk, bytecode_path, witness_path, vk_path));
+        _write(_prove<UltraStarknetFlavor>(flags, bytecode_path, witness_path, vk_path));
     } else if (flags.oracle_hash_type == "starknet" && !flags.disable_zk) {
-        _write(_prove<UltraStarknetZKFlavor>(flags.write_vk, bytecode_path, witness_path, vk_path));
+        _write(_prove<UltraStarknetZKFlavor>(flags, bytecode_path, witness_path, vk_path));
 #endif
     } else {
         throw_or_abort("Invalid proving options specified in _prove");
@@ -225,6 +339,31 @@ bool UltraHonkAPI::verify(const Flags& flags,
     }
 }
 
+std::vector<bool> UltraHonkAPI::batch_verify(const Flags& flags, const std::vector<std::filesystem::path>& proof_dirs)
+{
+    const bool ipa_accumulation = flags.ipa_accumulation;
+    // Flavors are selected as in verify
+    if (ipa_accumulation) {
+        return _batch_verify<UltraRollupFlavor>(ipa_accumulation, proof_dirs);
+    } else if (flags.oracle_hash_type == "poseidon2" && !flags.disable_zk) {
+        return _batch_verify<UltraZKFlavor>(ipa_accumulation, proof_dirs);
+    } else if (flags.oracle_hash_type == "poseidon2" && flags.disable_zk) {
+        return _batch_verify<UltraFlavor>(ipa_accumulation, proof_dirs);
+    } else if (flags.oracle_hash_type == "keccak" && !flags.disable_zk) {
+        return _batch_verify<UltraKeccakZKFlavor>(ipa_accumulation, proof_dirs);
+    } else if (flags.oracle_hash_type == "keccak" && flags.disable_zk) {
+        return _batch_verify<UltraKeccakFlavor>(ipa_accumulation, proof_dirs);
+#ifdef STARKNET_GARAGA_FLAVORS
+    } else if (flags.oracle_hash_type == "starknet" && !flags.disable_zk) {
+        return _batch_verify<UltraStarknetZKFlavor>(ipa_accumulation, proof_dirs);
+    } else if (flags.oracle_hash_type == "starknet" && flags.disable_zk) {
+        return _batch_verify<UltraStarknetFlavor>(ipa_accumulation, proof_dirs);
+#endif
+    } else {
+        throw_or_abort("invalid proof type in _batch_verify");
+    }
+}
+
 bool UltraHonkAPI::prove_and_verify([[maybe_unused]] const Flags& flags,
                                     [[maybe_unused]] const std::filesystem::path& bytecode_path,
                                     [[maybe_unused]] const std::filesystem::path& witness_path)
@@ -240,20 +379,20 @@ void UltraHonkAPI::write_vk(const Flags& flags,
     const auto _write = [&](auto&& _prove_output) { write(_prove_output, flags.output_format, "vk", output_path); };
 
     if (flags.ipa_accumulation) {
-        _write(_compute_vk<UltraRollupFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraRollupFlavor>(bytecode_path, "", flags.proving_key_cache_path));
     } else if (flags.oracle_hash_type == "poseidon2" && !flags.disable_zk) {
-        _write(_compute_vk<UltraZKFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraZKFlavor>(bytecode_path, "", flags.proving_key_cache_path));
     } else if (flags.oracle_hash_type == "poseidon2" && flags.disable_zk) {
-        _write(_compute_vk<UltraFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraFlavor>(bytecode_path, "", flags.proving_key_cache_path));
     } else if (flags.oracle_hash_type == "keccak" && !flags.disable_zk) {
-        _write(_compute_vk<UltraKeccakZKFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraKeccakZKFlavor>(bytecode_path, "", flags.proving_key_cache_path));
     } else if (flags.oracle_hash_type == "keccak" && flags.disable_zk) {
-        _write(_compute_vk<UltraKeccakFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraKeccakFlavor>(bytecode_path, "", flags.proving_key_cache_path));
 #ifdef STARKNET_GARAGA_FLAVORS
     } else if (flags.oracle_hash_type == "starknet" && !flags.disable_zk) {
-        _write(_compute_vk<UltraStarknetZKFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraStarknetZKFlavor>(bytecode_path, "", flags.proving_key_cache_path));
     } else if (flags.oracle_hash_type == "starknet" && flags.disable_zk) {
-        _write(_compute_vk<UltraStarknetFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraStarknetFlavor>(bytecode_path, "", flags.proving_key_cache_path));
 #endif
     } else {
         throw_or_abort("invalid proof type in _write_vk");
@@ -6,6 +6,7 @@
 #include "barretenberg/flavor/ultra_zk_flavor.hpp"
 #include <filesystem>
 #include <string>
+#include <vector>
 
 namespace bb {
 
@@ -26,6 +27,13 @@ class UltraHonkAPI : public API {
                 const std::filesystem::path& proof_path,
                 const std::filesystem::path& vk_path) override;
 
+    /**
+     * @brief Verify the proofs in each of `proof_dirs`, with one pairing check for all of them
+     * @details Each directory holds the files `proof`, `public_inputs` and `vk`, as written by prove with write_vk.
+     * @return whether each proof verifies
+     */
+    std::vector<bool> batch_verify(const Flags& flags, const std::vector<std::filesystem::path>& proof_dirs);
+
     bool prove_and_verify(const Flags& flags,
                           const std::filesystem::path& bytecode_path,
                           const std::filesystem::path& witness_path);
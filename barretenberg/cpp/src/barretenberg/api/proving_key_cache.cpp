@@ -0,0 +1,119 @@
+#include "proving_key_cache.hpp"
+#include "barretenberg/api/file_io.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include <iomanip>
+#include <sstream>
+#include <string_view>
+#include <unistd.h>
+
+namespace {
+
+using namespace bb;
+
+template <typename Flavor> constexpr std::string_view flavor_name()
+{
+    if constexpr (std::same_as<Flavor, UltraFlavor>) {
+        return "ultra";
+    } else if constexpr (std::same_as<Flavor, UltraZKFlavor>) {
+        return "ultra_zk";
+    } else if constexpr (std::same_as<Flavor, UltraKeccakFlavor>) {
+        return "ultra_keccak";
+    } else if constexpr (std::same_as<Flavor, UltraKeccakZKFlavor>) {
+        return "ultra_keccak_zk";
+    } else if constexpr (std::same_as<Flavor, UltraRollupFlavor>) {
+        return "ultra_rollup";
+#ifdef STARKNET_GARAGA_FLAVORS
+    } else if constexpr (std::same_as<Flavor, UltraStarknetFlavor>) {
+        return "ultra_starknet";
+    } else if constexpr (std::same_as<Flavor, UltraStarknetZKFlavor>) {
+        return "ultra_starknet_zk";
+#endif
+    }
+}
+
+// Hex encoded sha256 of the cache format, the flavor (which also determines the recursion options the circuit is built
+// with) and the bytecode
+template <typename Flavor> std::string compute_cache_key(const std::vector<uint8_t>& bytecode)
+{
+    std::string preimage = "bb-proving-key-cache-v" + std::to_string(ProvingKeyCache<Flavor>::FORMAT_VERSION) + ":" +
+                           std::string(flavor_name<Flavor>()) + ":";
+    preimage.append(bytecode.begin(), bytecode.end());
+    std::ostringstream key;
+    for (const uint8_t byte : crypto::sha256(preimage)) {
+        key << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(byte);
+    }
+    return key.str();
+}
+
+} // namespace
+
+namespace bb {
+
+template <typename Flavor>
+ProvingKeyCache<Flavor>::ProvingKeyCache(const std::filesystem::path& cache_dir, const std::vector<uint8_t>& bytecode)
+    : entry_path_(cache_dir / compute_cache_key<Flavor>(bytecode))
+{}
+
+template <typename Flavor> std::optional<typename ProvingKeyCache<Flavor>::Entry> ProvingKeyCache<Flavor>::load() const
+{
+    std::error_code ec;
+    if (!std::filesystem::is_directory(entry_path_, ec)) {
+        return std::nullopt;
+    }
+    auto precomputed = PolynomialSpillFile<FF>::open(entry_path_ / "precomputed");
+    if (!precomputed || precomputed->num_polynomials() != Flavor::NUM_PRECOMPUTED_ENTITIES) {
+        vinfo("ignoring incomplete proving key cache entry at ", entry_path_);
+        return std::nullopt;
+    }
+    Entry entry{ .precomputed_polynomials = precomputed->get_polynomials(), .verification_key = nullptr };
+    try {
+        entry.verification_key =
+            std::make_shared<VerificationKey>(from_buffer<VerificationKey>(read_file(entry_path_ / "vk")));
+    } catch (const std::exception& e) {
+        vinfo("ignoring proving key cache entry at ", entry_path_, " with unreadable vk: ", e.what());
+        return std::nullopt;
+    }
+    if (entry.verification_key->circuit_size != entry.precomputed_polynomials[0].virtual_size()) {
+        vinfo("ignoring inconsistent proving key cache entry at ", entry_path_);
+        return std::nullopt;
+    }
+    vinfo("loaded proving key from cache entry ", entry_path_);
+    return entry;
+}
+
+template <typename Flavor>
+void ProvingKeyCache<Flavor>::store(DeciderProvingKey_<Flavor>& proving_key,
+                                    const VerificationKey& verification_key) const
+{
+    // Assemble the entry in a directory of its own and move it into place in one step, so that concurrent readers see
+    // either no entry or a complete one. If another prover got there first, its entry is as good as ours.
+    auto temp_path = entry_path_;
+    temp_path += ".tmp." + std::to_string(getpid());
+    std::error_code ec;
+    try {
+        std::filesystem::create_directories(temp_path);
+        PolynomialSpillFile<FF>::write(temp_path / "precomputed",
+                                       RefVector<Polynomial>(proving_key.proving_key.polynomials.get_precomputed()));
+        write_file(temp_path / "vk", to_buffer(verification_key));
+        std::filesystem::rename(temp_path, entry_path_, ec);
+        if (!ec) {
+            vinfo("stored proving key in cache entry ", entry_path_);
+        }
+    } catch (const std::exception& e) {
+        info("WARNING: failed to write proving key cache entry at ", entry_path_, ": ", e.what());
+    }
+    std::filesystem::remove_all(temp_path, ec);
+}
+
+template class ProvingKeyCache<UltraFlavor>;
+template class ProvingKeyCache<UltraZKFlavor>;
+template class ProvingKeyCache<UltraKeccakFlavor>;
+template class ProvingKeyCache<UltraKeccakZKFlavor>;
+template class ProvingKeyCache<UltraRollupFlavor>;
+#ifdef STARKNET_GARAGA_FLAVORS
+template class ProvingKeyCache<UltraStarknetFlavor>;
+template class ProvingKeyCache<UltraStarknetZKFlavor>;
+#endif
+
+} // namespace bb
@@ -0,0 +1,66 @@
+#pragma once
+#include "barretenberg/polynomials/polynomial_spill_file.hpp"
+#include "barretenberg/ultra_honk/decider_proving_key.hpp"
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief A persistent, content-addressed cache of the circuit dependent part of UltraHonk proving keys.
+ * @details Proving the same circuit over and over with different witnesses recomputes the same selectors, permutation
+ * and table polynomials every time, and (when the vk is requested) commits to them again. This cache stores them once
+ * per circuit, keyed by a hash of the ACIR bytecode, the flavor and the cache format, in a directory per entry:
+ *
+ *      <cache_dir>/<key>/precomputed   the precomputed polynomials of the key as a PolynomialSpillFile
+ *      <cache_dir>/<key>/vk            the serialized verification key
+ *
+ * The precomputed polynomials are memory-mapped back on a hit, so a hot circuit costs neither their construction nor
+ * their memory until they are read. Entries are written under a temporary name and renamed into place, so concurrent
+ * provers sharing a cache directory never observe a partial entry; a corrupted or stale entry is treated as a miss.
+ *
+ * @note The witness still has to be turned into a circuit on every proof: the cache only skips the preprocessing that
+ * depends on the structure of the circuit alone.
+ */
+template <typename Flavor> class ProvingKeyCache {
+    using FF = typename Flavor::FF;
+    using Polynomial = typename Flavor::Polynomial;
+    using VerificationKey = typename Flavor::VerificationKey;
+
+  public:
+    // Bump whenever the layout of an entry or the serialization of its contents changes
+    static constexpr uint32_t FORMAT_VERSION = 1;
+
+    struct Entry {
+        std::vector<Polynomial> precomputed_polynomials;
+        std::shared_ptr<VerificationKey> verification_key;
+    };
+
+    /**
+     * @param cache_dir directory holding the cache entries; created on the first store
+     * @param bytecode the ACIR bytecode of the circuit, exactly as read from disk
+     */
+    ProvingKeyCache(const std::filesystem::path& cache_dir, const std::vector<uint8_t>& bytecode);
+
+    /**
+     * @brief Read the entry of the circuit back from the cache.
+     * @return std::nullopt on a miss
+     */
+    std::optional<Entry> load() const;
+
+    /**
+     * @brief Store the precomputed polynomials of `proving_key` together with its verification key.
+     * @details Failing to write the entry is not an error: the proof does not depend on it.
+     */
+    void store(DeciderProvingKey_<Flavor>& proving_key, const VerificationKey& verification_key) const;
+
+    const std::filesystem::path& entry_path() const { return entry_path_; }
+
+  private:
+    std::filesystem::path entry_path_;
+};
+
+} // namespace bb
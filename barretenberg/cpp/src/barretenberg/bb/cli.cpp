@@ -20,11 +20,15 @@
 #include "barretenberg/api/gate_count.hpp"
 #include "barretenberg/api/prove_tube.hpp"
 #include "barretenberg/bb/cli11_formatter.hpp"
+#include "barretenberg/bb/server.hpp"
+#include "barretenberg/commitment_schemes/commitment_key.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/flavor/ultra_rollup_flavor.hpp"
 #include "barretenberg/honk/types/aggregation_object_type.hpp"
 #include "barretenberg/srs/factories/native_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
+#include <algorithm>
 
 namespace bb {
 // This is updated in-place by bootstrap.sh during the release process. This prevents
@@ -183,6 +187,41 @@ int parse_and_run_cli_command(int argc, char* argv[])
             ->check(CLI::ExistingDirectory);
     };
 
+    const auto add_proving_key_cache_path_option = [&](CLI::App* subcommand) {
+        return subcommand
+            ->add_option("--proving_key_cache_path",
+                         flags.proving_key_cache_path,
+                         "Directory of a cache of proving keys, keyed by circuit. Repeated proofs of a circuit found "
+                         "in the cache skip computing its precomputed polynomials and verification key. Only used by "
+                         "the ultra_honk scheme.")
+            ->envname("BB_PROVING_KEY_CACHE_PATH");
+    };
+
+    const auto add_fixed_base_msm_option = [&](CLI::App* subcommand) {
+        return subcommand
+            ->add_option("--fixed_base_msm_memory_budget",
+                         flags.fixed_base_msm_memory_budget,
+                         "Memory budget in MiB of a table of precomputed multiples of the CRS points, built once and "
+                         "used by every BN254 commitment in place of Pippenger from scratch. Trades memory for fewer "
+                         "bucket accumulation rounds per commitment. 0, the default, disables it.")
+            ->envname("BB_FIXED_BASE_MSM_MEMORY_BUDGET");
+    };
+
+    const auto add_streaming_sumcheck_options = [&](CLI::App* subcommand) {
+        subcommand->add_option("--streamed_sumcheck_rounds",
+                               flags.streamed_sumcheck_rounds,
+                               "Number of initial sumcheck rounds computed by streaming over the full polynomials "
+                               "instead of a table of partially evaluated polynomials. Lowers the peak memory at the "
+                               "cost of a pass over the polynomials per round. Requires --disable_zk.");
+        subcommand
+            ->add_option("--sumcheck_spill_dir",
+                         flags.sumcheck_spill_dir,
+                         "Directory the prover polynomials are spilled to, the precomputed ones once the trace is "
+                         "built and the witness ones before sumcheck, so that they need not be resident at once. "
+                         "Requires --disable_zk.")
+            ->check(CLI::ExistingDirectory);
+    };
+
     const auto add_oracle_hash_option = [&](CLI::App* subcommand) {
         return subcommand
             ->add_option(
@@ -348,6 +387,9 @@ int parse_and_run_cli_command(int argc, char* argv[])
     add_ipa_accumulation_flag(prove);
     add_recursive_flag(prove);
     add_honk_recursion_option(prove);
+    add_proving_key_cache_path_option(prove);
+    add_fixed_base_msm_option(prove);
+    add_streaming_sumcheck_options(prove);
 
     prove->add_flag("--verify", "Verify the proof natively, resulting in a boolean output. Useful for testing.");
 
@@ -376,6 +418,8 @@ int parse_and_run_cli_command(int argc, char* argv[])
     add_recursive_flag(write_vk);
     add_verifier_type_option(write_vk)->default_val("standalone");
     remove_zk_option(write_vk);
+    add_proving_key_cache_path_option(write_vk);
+    add_fixed_base_msm_option(write_vk);
 
     /***************************************************************************************************************
      * Subcommand: verify
@@ -396,6 +440,39 @@ int parse_and_run_cli_command(int argc, char* argv[])
     add_init_kzg_accumulator_option(verify);
     add_honk_recursion_option(verify);
     add_recursive_flag(verify);
+    std::vector<std::filesystem::path> batch_proof_dirs;
+    verify
+        ->add_option("--batch",
+                     batch_proof_dirs,
+                     "Verify the proofs in each of these directories, which hold the files proof, public_inputs and vk "
+                     "as written by prove --write_vk, together with one pairing check. Fails unless all proofs verify. "
+                     "Only supported by the ultra_honk scheme.")
+        ->check(CLI::ExistingDirectory);
+
+    /***************************************************************************************************************
+     * Subcommand: server
+     ***************************************************************************************************************/
+    CLI::App* server_command =
+        app.add_subcommand("server",
+                           "Serve UltraHonk prove, verify and write_vk requests, encoded as msgpack messages, from "
+                           "stdin or a Unix socket, keeping the CRS and the thread pool warm across requests.");
+    std::filesystem::path server_socket_path;
+    size_t server_max_jobs = 1;
+    server_command->add_option(
+        "--socket", server_socket_path, "Listen on a Unix socket at this path instead of reading from stdin.");
+    server_command
+        ->add_option("--max_jobs",
+                     server_max_jobs,
+                     "Maximum number of requests processed at once, 1 by default. Each request uses all threads, so "
+                     "more than one mostly helps to overlap circuit construction and file IO, at the cost of memory. "
+                     "Concurrent requests share the CRS and lookup tables of the process.")
+        ->check(CLI::PositiveNumber);
+
+    add_verbose_flag(server_command);
+    add_debug_flag(server_command);
+    add_crs_path_option(server_command);
+    add_proving_key_cache_path_option(server_command);
+    add_fixed_base_msm_option(server_command);
 
     /***************************************************************************************************************
      * Subcommand: write_solidity_verifier
@@ -572,6 +649,8 @@ int parse_and_run_cli_command(int argc, char* argv[])
     // Immediately after parsing, we can init the global CRS factory. Note this does not yet read or download any
     // points; that is done on-demand.
     srs::init_net_crs_factory(flags.crs_path);
+    // Commitment keys constructed from here on, by any command, build or share the fixed-base table
+    CommitmentKey<curve::BN254>::set_fixed_base_memory_budget(flags.fixed_base_msm_memory_budget << 20);
     if (prove->parsed() || write_vk->parsed()) {
         // If writing to an output folder, make sure it exists.
         std::filesystem::create_directories(output_path);
@@ -601,6 +680,9 @@ int parse_and_run_cli_command(int argc, char* argv[])
             return 0;
         }
         if (verify->parsed()) {
+            if (!batch_proof_dirs.empty()) {
+                throw_or_abort("--batch is only supported by the ultra_honk scheme");
+            }
             const bool verified = api.verify(flags, public_inputs_path, proof_path, vk_path);
             vinfo("verified: ", verified);
             return verified ? 0 : 1;
@@ -616,6 +698,10 @@ int parse_and_run_cli_command(int argc, char* argv[])
     };
 
     try {
+        // SERVER
+        if (server_command->parsed()) {
+            return server::run_server(flags, server_socket_path, server_max_jobs);
+        }
         // TUBE
         if (prove_tube_command->parsed()) {
             // TODO(https://github.com/AztecProtocol/barretenberg/issues/1201): Potentially remove this extra logic.
@@ -694,6 +780,10 @@ int parse_and_run_cli_command(int argc, char* argv[])
                 api.prove(flags, bytecode_path, witness_path, vk_path, output_path);
                 return 0;
             }
+            if (verify->parsed() && !batch_proof_dirs.empty()) {
+                const std::vector<bool> verified = api.batch_verify(flags, batch_proof_dirs);
+                return std::all_of(verified.begin(), verified.end(), [](bool v) { return v; }) ? 0 : 1;
+            }
             return execute_non_prove_command(api);
         } else {
             throw_or_abort("No match for API command");
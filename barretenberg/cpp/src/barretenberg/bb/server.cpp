@@ -0,0 +1,330 @@
+#include "server.hpp"
+#include "barretenberg/api/api_ultra_honk.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/messaging/stream_parser.hpp"
+#include "barretenberg/serialize/msgpack_impl.hpp"
+#include "barretenberg/stdlib_circuit_builders/plookup_tables/plookup_tables.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace bb::server {
+namespace {
+
+using namespace bb::messaging;
+
+// Write all of `size` bytes to `fd`, retrying on short writes
+bool write_all(int fd, const char* data, size_t size)
+{
+    while (size > 0) {
+        const ssize_t written = ::write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+/**
+ * @brief The sending half of a client connection, shared by the reader and the jobs of the client.
+ * @details Responses of concurrent jobs are serialized by a mutex so that their msgpack objects do not interleave. The
+ * descriptor is closed when the reader and every job of the client are done with it.
+ */
+class Connection {
+  public:
+    Connection(int input_fd, int output_fd)
+        : input_fd_(input_fd)
+        , output_fd_(output_fd)
+    {}
+    Connection(const Connection&) = delete;
+    Connection(Connection&&) = delete;
+    Connection& operator=(const Connection&) = delete;
+    Connection& operator=(Connection&&) = delete;
+    ~Connection()
+    {
+        // stdio is not ours to close
+        if (output_fd_ > STDERR_FILENO) {
+            ::close(output_fd_);
+        }
+        if (input_fd_ > STDERR_FILENO && input_fd_ != output_fd_) {
+            ::close(input_fd_);
+        }
+    }
+
+    int input_fd() const { return input_fd_; }
+
+    // Make a blocked read of the input return end of file, responses can still be sent
+    void shutdown_input() const { ::shutdown(input_fd_, SHUT_RD); }
+
+    // Interface expected by messaging::StreamDispatcher
+    template <typename T> void send(const T& message)
+    {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, message);
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!write_all(output_fd_, buffer.data(), buffer.size())) {
+            info("bb server: failed to send a response: ", std::strerror(errno));
+        }
+    }
+
+  private:
+    int input_fd_;
+    int output_fd_;
+    std::mutex mutex_;
+};
+
+API::Flags job_flags(const API::Flags& defaults, const ProofOptions& options)
+{
+    API::Flags flags = defaults;
+    flags.scheme = "ultra_honk";
+    flags.oracle_hash_type = options.oracle_hash_type;
+    flags.disable_zk = options.disable_zk;
+    flags.ipa_accumulation = options.ipa_accumulation;
+    return flags;
+}
+
+void check_output_path(const std::string& path)
+{
+    if (path.empty() || path == "-") {
+        throw_or_abort("bb server writes its outputs to files, an output path is required");
+    }
+}
+
+JobResponse prove(const API::Flags& defaults, const ProveRequest& request)
+{
+    check_output_path(request.output_dir);
+    API::Flags flags = job_flags(defaults, request.options);
+    flags.write_vk = request.write_vk;
+    flags.output_format = request.output_format;
+    std::filesystem::create_directories(request.output_dir);
+    UltraHonkAPI api;
+    api.prove(flags, request.bytecode_path, request.witness_path, request.vk_path, request.output_dir);
+    return { .success = true };
+}
+
+JobResponse verify(const API::Flags& defaults, const VerifyRequest& request)
+{
+    UltraHonkAPI api;
+    const bool verified = api.verify(
+        job_flags(defaults, request.options), request.public_inputs_path, request.proof_path, request.vk_path);
+    return { .success = true, .verified = verified };
+}
+
+JobResponse write_vk(const API::Flags& defaults, const WriteVkRequest& request)
+{
+    check_output_path(request.output_path);
+    API::Flags flags = job_flags(defaults, request.options);
+    flags.output_format = request.output_format;
+    std::filesystem::create_directories(request.output_path);
+    UltraHonkAPI api;
+    api.write_vk(flags, request.bytecode_path, request.output_path);
+    return { .success = true };
+}
+
+/**
+ * @brief Read requests from a client until it disconnects or sends TERMINATE, queueing one job per request.
+ */
+void serve_connection(const API::Flags& defaults, JobQueue& jobs, const std::shared_ptr<Connection>& connection)
+{
+    StreamDispatcher<Connection> dispatcher(*connection);
+
+    // Requests are decoded on the reader thread, as the object they are read from only lives until the next read
+    const auto register_job = [&]<typename Request>(ServerMessageType type,
+                                                    JobResponse (*run)(const API::Flags&, const Request&)) {
+        std::function<bool(msgpack::object&)> handler = [&defaults, &jobs, connection, type, run](
+                                                            msgpack::object& obj) {
+            auto request = std::make_shared<TypedMessage<Request>>();
+            obj.convert(*request);
+            jobs.submit([&defaults, connection, type, run, request]() {
+                JobResponse response;
+                try {
+                    response = run(defaults, request->value);
+                } catch (const std::exception& e) {
+                    response = { .success = false, .error = e.what() };
+                }
+                MsgHeader header(request->header.messageId);
+                connection->send(TypedMessage<JobResponse>(type, header, response));
+            });
+            return true;
+        };
+        dispatcher.registerTarget(type, handler);
+    };
+    register_job(PROVE, &prove);
+    register_job(VERIFY, &verify);
+    register_job(WRITE_VK, &write_vk);
+
+    constexpr size_t READ_SIZE = 1 << 16;
+    msgpack::unpacker unpacker;
+    while (true) {
+        unpacker.reserve_buffer(READ_SIZE);
+        const ssize_t num_read = ::read(connection->input_fd(), unpacker.buffer(), READ_SIZE);
+        if (num_read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (num_read <= 0) {
+            return;
+        }
+        unpacker.buffer_consumed(static_cast<size_t>(num_read));
+        msgpack::object_handle handle;
+        while (unpacker.next(handle)) {
+            msgpack::object obj = handle.get();
+            bool keep_going = true;
+            try {
+                keep_going = dispatcher.onNewData(obj);
+            } catch (const std::exception& e) {
+                info("bb server: dropping malformed request: ", e.what());
+            }
+            if (!keep_going) {
+                return;
+            }
+        }
+    }
+}
+
+// Written to by the signal handler to wake up the accept loop of serve_socket
+std::array<int, 2> stop_pipe{ -1, -1 }; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void request_stop(int /*signal*/)
+{
+    const char byte = 0;
+    [[maybe_unused]] const ssize_t written = ::write(stop_pipe[1], &byte, 1);
+}
+
+/**
+ * @brief A client of the socket server and the thread reading its requests.
+ */
+struct Client {
+    std::shared_ptr<Connection> connection;
+    std::thread reader;
+    std::atomic<bool> done = false;
+};
+
+/**
+ * @brief Accept clients on a Unix socket at `socket_path` until SIGINT or SIGTERM, then stop reading requests and
+ * join the reader of every client.
+ */
+void serve_socket(const API::Flags& defaults, JobQueue& jobs, const std::filesystem::path& socket_path)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socket_path.string().size() >= sizeof(address.sun_path)) {
+        throw_or_abort("socket path too long: " + socket_path.string());
+    }
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+    const int listen_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    std::filesystem::remove(socket_path);
+    if (listen_fd < 0 || ::bind(listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listen_fd, SOMAXCONN) != 0) {
+        throw_or_abort("failed to listen on " + socket_path.string() + ": " + std::strerror(errno));
+    }
+    // The signal may be delivered to any thread, so rather than interrupting accept it wakes up the poll below
+    if (::pipe(stop_pipe.data()) != 0) {
+        throw_or_abort(std::string("failed to create a pipe: ") + std::strerror(errno));
+    }
+    struct sigaction action {};
+    action.sa_handler = request_stop;
+    sigemptyset(&action.sa_mask);
+    ::sigaction(SIGINT, &action, nullptr);
+    ::sigaction(SIGTERM, &action, nullptr);
+    info("bb server: listening on ", socket_path);
+
+    // Clients come and go for as long as the server runs; each one gets a reader thread feeding the shared queue
+    std::list<Client> clients;
+    std::array<pollfd, 2> poll_fds{ pollfd{ .fd = listen_fd, .events = POLLIN, .revents = 0 },
+                                    pollfd{ .fd = stop_pipe[0], .events = POLLIN, .revents = 0 } };
+    while (true) {
+        if (::poll(poll_fds.data(), poll_fds.size(), -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw_or_abort(std::string("bb server: poll failed: ") + std::strerror(errno));
+        }
+        if (poll_fds[1].revents != 0) {
+            break;
+        }
+        if (poll_fds[0].revents == 0) {
+            continue;
+        }
+        const int client_fd = ::accept(listen_fd, nullptr, nullptr);
+        if (client_fd < 0) {
+            if (errno != EINTR && errno != ECONNABORTED) {
+                // e.g. out of file descriptors: back off until running jobs release some
+                info("bb server: accept failed: ", std::strerror(errno));
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+            continue;
+        }
+        // Join the readers of the clients that have disconnected since
+        clients.remove_if([](Client& client) {
+            if (!client.done) {
+                return false;
+            }
+            client.reader.join();
+            return true;
+        });
+        Client& client = clients.emplace_back();
+        client.connection = std::make_shared<Connection>(client_fd, client_fd);
+        client.reader = std::thread([&defaults, &jobs, &client]() {
+            serve_connection(defaults, jobs, client.connection);
+            client.done = true;
+        });
+    }
+
+    info("bb server: shutting down");
+    ::close(listen_fd);
+    std::filesystem::remove(socket_path);
+    // The requests already read are still answered once the queue drains
+    for (auto& client : clients) {
+        client.connection->shutdown_input();
+    }
+    for (auto& client : clients) {
+        client.reader.join();
+    }
+}
+
+} // namespace
+
+void serve_client(const API::Flags& defaults, JobQueue& jobs, int input_fd, int output_fd)
+{
+    serve_connection(defaults, jobs, std::make_shared<Connection>(input_fd, output_fd));
+}
+
+int run_server(const API::Flags& flags, const std::filesystem::path& socket_path, size_t max_concurrent_jobs)
+{
+    // A client that goes away must not take the server (and the other clients' jobs) with it
+    std::signal(SIGPIPE, SIG_IGN);
+
+    if (max_concurrent_jobs > 1) {
+        // Concurrent jobs share the state of the process. The CRS factories lock around get_crs; the lookup tables
+        // are built lazily without synchronising their readers, so they are built before any job runs.
+        plookup::get_multitable(plookup::MultiTableId::HONK_DUMMY_MULTI);
+    }
+    JobQueue jobs(std::max<size_t>(max_concurrent_jobs, 1));
+    if (!socket_path.empty()) {
+        serve_socket(flags, jobs, socket_path);
+    } else {
+        info("bb server: reading requests from stdin");
+        serve_client(flags, jobs, STDIN_FILENO, STDOUT_FILENO);
+    }
+    // Leaving scope drains the queue, so every request read gets its response
+    return 0;
+}
+
+} // namespace bb::server
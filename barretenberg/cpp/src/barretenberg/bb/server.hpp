@@ -0,0 +1,164 @@
+#pragma once
+#include "barretenberg/api/api.hpp"
+#include "barretenberg/messaging/header.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace bb::server {
+
+/**
+ * @brief Requests accepted by `bb server`.
+ * @details Every request is a messaging::TypedMessage<Request> and is answered with a
+ * messaging::TypedMessage<JobResponse> of the same type, whose requestId is the messageId of the request. Jobs may
+ * complete out of order when the server runs more than one at a time. The system messages PING (answered with PONG) and
+ * TERMINATE (stop reading requests from this client) are handled as well.
+ *
+ * All paths are interpreted by the server, and outputs are written to files exactly as by the corresponding one-shot
+ * commands; writing to stdout ("-") is not supported.
+ */
+enum ServerMessageType {
+    PROVE = messaging::FIRST_APP_MSG_TYPE,
+    VERIFY,
+    WRITE_VK,
+};
+
+// Options of a request that select the flavor; see the options of the same name of the one-shot commands
+struct ProofOptions {
+    std::string oracle_hash_type = "poseidon2";
+    bool disable_zk = false;
+    bool ipa_accumulation = false;
+    MSGPACK_FIELDS(oracle_hash_type, disable_zk, ipa_accumulation);
+};
+
+struct ProveRequest {
+    std::string bytecode_path;
+    std::string witness_path;
+    std::string vk_path;
+    std::string output_dir;
+    std::string output_format = "bytes";
+    bool write_vk = false;
+    ProofOptions options;
+    MSGPACK_FIELDS(bytecode_path, witness_path, vk_path, output_dir, output_format, write_vk, options);
+};
+
+struct VerifyRequest {
+    std::string public_inputs_path;
+    std::string proof_path;
+    std::string vk_path;
+    ProofOptions options;
+    MSGPACK_FIELDS(public_inputs_path, proof_path, vk_path, options);
+};
+
+struct WriteVkRequest {
+    std::string bytecode_path;
+    std::string output_path;
+    std::string output_format = "bytes";
+    ProofOptions options;
+    MSGPACK_FIELDS(bytecode_path, output_path, output_format, options);
+};
+
+struct JobResponse {
+    bool success = false;
+    // Only meaningful for VERIFY
+    bool verified = false;
+    std::string error;
+    MSGPACK_FIELDS(success, verified, error);
+};
+
+/**
+ * @brief A queue of jobs executed by a fixed number of worker threads, in the order they were submitted.
+ * @details Each job parallelises internally through parallel_for, so the workers only bound how many proofs are in
+ * flight (and hence their combined memory), not how many cores are used.
+ */
+class JobQueue {
+  public:
+    JobQueue(size_t num_workers)
+    {
+        workers_.reserve(num_workers);
+        for (size_t i = 0; i < num_workers; ++i) {
+            workers_.emplace_back([this]() { worker_loop(); });
+        }
+    }
+    JobQueue(const JobQueue&) = delete;
+    JobQueue(JobQueue&&) = delete;
+    JobQueue& operator=(const JobQueue&) = delete;
+    JobQueue& operator=(JobQueue&&) = delete;
+    // Finishes every queued job before returning
+    ~JobQueue()
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        condition_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    void submit(std::function<void()> job)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            jobs_.push_back(std::move(job));
+        }
+        condition_.notify_one();
+    }
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<std::function<void()>> jobs_;
+    bool stop_ = false;
+    std::vector<std::thread> workers_;
+
+    void worker_loop()
+    {
+        while (true) {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                condition_.wait(lock, [this]() { return stop_ || !jobs_.empty(); });
+                if (jobs_.empty()) {
+                    return;
+                }
+                job = std::move(jobs_.front());
+                jobs_.pop_front();
+            }
+            job();
+        }
+    }
+};
+
+/**
+ * @brief Read requests from `input_fd` until it is closed or a TERMINATE arrives, queueing one job per request on
+ * `jobs`. Responses are written to `output_fd`, possibly after this returns. Descriptors other than stdio are closed
+ * once the last response has been written.
+ */
+void serve_client(const API::Flags& defaults, JobQueue& jobs, int input_fd, int output_fd);
+
+/**
+ * @brief Serve UltraHonk prove/verify/write_vk requests until the clients are done.
+ * @details The point of the server is to pay for process startup, CRS loading and thread pool creation once for many
+ * proofs. Requests are msgpack objects read back to back from stdin, or from every client connecting to a Unix socket
+ * at `socket_path` if one is given; responses are written back the same way. Up to `max_concurrent_jobs` requests are
+ * processed at once, the others wait in a queue in the order they arrived.
+ *
+ * Concurrent jobs share the CRS factories, which are locked, and the lookup tables, which are built before any job
+ * runs. Other process-wide state is not guarded, which is why the cli defaults to one job at a time.
+ *
+ * @param flags defaults for every job (crs path, proving key cache, logging)
+ * @return the exit code, in stdin mode once stdin is closed or a TERMINATE arrives and all queued jobs are done; in
+ * socket mode once SIGINT or SIGTERM arrives, the clients have been disconnected and all queued jobs are done
+ */
+int run_server(const API::Flags& flags, const std::filesystem::path& socket_path, size_t max_concurrent_jobs);
+
+} // namespace bb::server
@@ -0,0 +1,143 @@
+#include "server.hpp"
+#include "barretenberg/serialize/msgpack_impl.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <optional>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace bb;
+using namespace bb::messaging;
+using namespace bb::server;
+
+namespace {
+
+/**
+ * @brief The client end of a socket pair whose other end is served by serve_client.
+ */
+class TestClient {
+  public:
+    explicit TestClient(int fd)
+        : fd_(fd)
+    {}
+    TestClient(const TestClient&) = delete;
+    TestClient(TestClient&&) = delete;
+    TestClient& operator=(const TestClient&) = delete;
+    TestClient& operator=(TestClient&&) = delete;
+    ~TestClient() { ::close(fd_); }
+
+    template <typename T> void send(const T& message)
+    {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, message);
+        EXPECT_EQ(::write(fd_, buffer.data(), buffer.size()), static_cast<ssize_t>(buffer.size()));
+    }
+
+    // The next message from the server, or nullopt once the server has closed its end
+    std::optional<msgpack::object_handle> receive()
+    {
+        constexpr size_t READ_SIZE = 1 << 12;
+        msgpack::object_handle handle;
+        while (!unpacker_.next(handle)) {
+            unpacker_.reserve_buffer(READ_SIZE);
+            const ssize_t num_read = ::read(fd_, unpacker_.buffer(), READ_SIZE);
+            if (num_read <= 0) {
+                return std::nullopt;
+            }
+            unpacker_.buffer_consumed(static_cast<size_t>(num_read));
+        }
+        return handle;
+    }
+
+    template <typename T> T receive_as()
+    {
+        auto handle = receive();
+        if (!handle.has_value()) {
+            throw std::runtime_error("the server closed the connection");
+        }
+        T message;
+        handle->get().convert(message);
+        return message;
+    }
+
+  private:
+    int fd_;
+    msgpack::unpacker unpacker_;
+};
+
+HeaderOnlyMessage system_message(uint32_t type, uint32_t message_id)
+{
+    MsgHeader header(message_id, 0);
+    return HeaderOnlyMessage(type, header);
+}
+
+// A request that is well formed, but whose job fails as its files do not exist
+TypedMessage<VerifyRequest> verify_missing_files(uint32_t message_id)
+{
+    MsgHeader header(message_id, 0);
+    VerifyRequest request{ .public_inputs_path = "/nonexistent/public_inputs",
+                           .proof_path = "/nonexistent/proof",
+                           .vk_path = "/nonexistent/vk" };
+    return TypedMessage<VerifyRequest>(VERIFY, header, request);
+}
+
+} // namespace
+
+TEST(ServerTest, ServeClient)
+{
+    std::array<int, 2> fds{};
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds.data()), 0);
+    TestClient client(fds[0]);
+    {
+        JobQueue jobs(1);
+        std::thread reader([&jobs, server_fd = fds[1]]() { serve_client(API::Flags{}, jobs, server_fd, server_fd); });
+
+        // A system message is answered by the reader itself
+        client.send(system_message(PING, 1));
+        auto pong = client.receive_as<HeaderOnlyMessage>();
+        EXPECT_EQ(pong.msgType, static_cast<uint32_t>(PONG));
+        EXPECT_EQ(pong.header.requestId, 1U);
+
+        // A request that does not decode is dropped without a response, the next one is still served
+        MsgHeader malformed_header(2, 0);
+        client.send(TypedMessage<uint32_t>(VERIFY, malformed_header, 42));
+        client.send(verify_missing_files(3));
+        auto response = client.receive_as<TypedMessage<JobResponse>>();
+        EXPECT_EQ(response.msgType, static_cast<uint32_t>(VERIFY));
+        EXPECT_EQ(response.header.requestId, 3U);
+        EXPECT_FALSE(response.value.success);
+        EXPECT_FALSE(response.value.verified);
+        EXPECT_FALSE(response.value.error.empty());
+
+        // The reader stops at TERMINATE, the request queued before it is still answered
+        client.send(verify_missing_files(4));
+        client.send(system_message(TERMINATE, 5));
+        reader.join();
+    }
+    auto response = client.receive_as<TypedMessage<JobResponse>>();
+    EXPECT_EQ(response.header.requestId, 4U);
+    EXPECT_FALSE(response.value.success);
+    // The server closed its end once the last response was written
+    EXPECT_FALSE(client.receive().has_value());
+}
+
+TEST(ServerTest, JobQueueFinishesQueuedJobsOnShutdown)
+{
+    constexpr size_t NUM_JOBS = 16;
+    std::atomic<size_t> num_completed = 0;
+    {
+        JobQueue jobs(2);
+        for (size_t i = 0; i < NUM_JOBS; ++i) {
+            jobs.submit([&num_completed]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                num_completed.fetch_add(1);
+            });
+        }
+    }
+    EXPECT_EQ(num_completed.load(), NUM_JOBS);
+}
@@ -1,3 +1,4 @@
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/crypto/merkle_tree/append_only_tree/content_addressed_append_only_tree.hpp"
 #include "barretenberg/crypto/merkle_tree/fixtures.hpp"
@@ -10,10 +11,12 @@
 #include "barretenberg/crypto/merkle_tree/signal.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
+#include <algorithm>
 #include <benchmark/benchmark.h>
 #include <cstdint>
 #include <filesystem>
 #include <memory>
+#include <span>
 
 using namespace benchmark;
 using namespace bb::crypto::merkle_tree;
@@ -71,6 +74,45 @@ template <typename TreeType> void append_only_tree_bench(State& state) noexcept
 
     std::filesystem::remove_all(directory);
 }
+/**
+ * @brief Hashing a whole subtree of `batch_size` leaves level by level, without a store
+ * @details Arg 1 selects how each level is hashed: 0 pair by pair through hash_pair (the former insertion path), 1 as a
+ * batch through hash_pairs on one thread, 2 as a batch split across threads (the current insertion path).
+ */
+template <typename HashingPolicy> void subtree_hash_bench(State& state) noexcept
+{
+    const size_t batch_size = size_t(state.range(0));
+    const int64_t mode = state.range(1);
+
+    std::vector<fr> leaves(batch_size);
+    for (auto& leaf : leaves) {
+        leaf = fr(random_engine.get_random_uint256());
+    }
+    std::vector<fr> children(batch_size);
+    std::vector<fr> parents(batch_size / 2);
+    for (auto _ : state) {
+        std::copy(leaves.begin(), leaves.end(), children.begin());
+        for (size_t level_size = batch_size / 2; level_size > 0; level_size >>= 1) {
+            std::span<const fr> level_children(children.data(), 2 * level_size);
+            std::span<fr> level_parents(parents.data(), level_size);
+            if (mode == 0) {
+                for (size_t i = 0; i < level_size; ++i) {
+                    level_parents[i] = HashingPolicy::hash_pair(level_children[2 * i], level_children[2 * i + 1]);
+                }
+            } else if (mode == 1) {
+                HashingPolicy::hash_pairs(level_children, level_parents);
+            } else {
+                bb::parallel_for_range(level_size, [&](size_t start, size_t end) {
+                    HashingPolicy::hash_pairs(level_children.subspan(2 * start, 2 * (end - start)),
+                                              level_parents.subspan(start, end - start));
+                });
+            }
+            std::copy_n(parents.begin(), level_size, children.begin());
+        }
+        DoNotOptimize(children[0]);
+    }
+}
+
 BENCHMARK(append_only_tree_bench<Poseidon2>)
     ->Unit(benchmark::kMillisecond)
     ->RangeMultiplier(2)
@@ -81,6 +123,10 @@ BENCHMARK(append_only_tree_bench<Poseidon2>)
     ->RangeMultiplier(2)
     ->Range(512, 8192)
     ->Iterations(10);
+BENCHMARK(subtree_hash_bench<Poseidon2HashPolicy>)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgsProduct({ { 64, 1024, 8192 }, { 0, 1, 2 } })
+    ->ArgNames({ "batch_size", "mode" });
 
 } // namespace
 
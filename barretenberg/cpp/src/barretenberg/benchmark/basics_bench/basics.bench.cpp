@@ -165,6 +165,29 @@ void ff_invert(State& state)
     }
 }
 
+/**
+ * @brief Batch inversion of 2^range(0) elements, serially (range(1) = 0) or by parallel_batch_invert split into at
+ * most range(1) chunks, to show how the parallel variant scales with the number of cores
+ */
+void ff_batch_invert(State& state)
+{
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t num_elements = 1 << static_cast<size_t>(state.range(0));
+    const auto num_threads = static_cast<size_t>(state.range(1));
+    std::vector<Fr> elements(num_elements);
+    for (auto& element : elements) {
+        element = Fr::random_element(&engine);
+    }
+
+    for (auto _ : state) {
+        if (num_threads == 0) {
+            Fr::batch_invert(elements);
+        } else {
+            Fr::parallel_batch_invert(elements, num_threads);
+        }
+    }
+}
+
 /**
  * @brief Evaluate how much conversion to montgomery costs (in cache)
  *
@@ -487,6 +510,11 @@ BENCHMARK(ff_addition)->Unit(kMicrosecond)->DenseRange(12, 30);
 BENCHMARK(ff_multiplication)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_sqr)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_invert)->Unit(kMicrosecond)->DenseRange(12, 19);
+BENCHMARK(ff_batch_invert)
+    ->Unit(kMicrosecond)
+    ->ArgsProduct({ { 16, 20, 22 }, { 0, 1, 2, 4, 8, 16, 32 } })
+    ->ArgNames({ "log_n", "threads" })
+    ->UseRealTime();
 BENCHMARK(ff_to_montgomery)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_from_montgomery)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_reduce)->Unit(kMicrosecond)->DenseRange(12, 29);
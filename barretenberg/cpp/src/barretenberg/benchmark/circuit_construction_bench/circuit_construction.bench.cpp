@@ -1,9 +1,12 @@
 
 #include <benchmark/benchmark.h>
 
+#include "barretenberg/flavor/ultra_flavor.hpp"
 #include "barretenberg/stdlib/primitives/biggroup/biggroup.hpp"
 #include "barretenberg/stdlib/primitives/curves/bn254.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "barretenberg/trace_to_polynomials/trace_to_polynomials.hpp"
 
 using namespace benchmark;
 using namespace bb;
@@ -40,7 +43,47 @@ void biggroup_construction_bench(State& state)
         state.PauseTiming();
     }
 }
+
+// A finalized circuit of 2^log_num_gates arithmetic gates
+UltraCircuitBuilder construct_copy_cycles_circuit(size_t log_num_gates)
+{
+    UltraCircuitBuilder builder;
+    MockCircuits::add_arithmetic_gates(builder, (1UL << log_num_gates));
+    builder.finalize_circuit(/*ensure_nonzero=*/true);
+    return builder;
+}
+
+// Build the copy cycles by walking the trace cell by cell, with one vector per variable
+void copy_cycles_serial_bench(State& state)
+{
+    auto builder = construct_copy_cycles_circuit(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::vector<std::vector<cycle_node>> copy_cycles(builder.get_num_variables());
+        uint32_t offset = UltraFlavor::has_zero_row ? 1 : 0;
+        for (auto& block : builder.blocks.get()) {
+            for (uint32_t row_idx = 0; row_idx < block.size(); ++row_idx) {
+                for (uint32_t wire_idx = 0; wire_idx < UltraFlavor::NUM_WIRES; ++wire_idx) {
+                    const uint32_t real_var_idx = builder.real_variable_index[block.wires[wire_idx][row_idx]];
+                    copy_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, row_idx + offset });
+                }
+            }
+            offset += static_cast<uint32_t>(block.size());
+        }
+        DoNotOptimize(copy_cycles);
+    }
+}
+
+// Build the copy cycles as the proving key construction does
+void copy_cycles_parallel_bench(State& state)
+{
+    auto builder = construct_copy_cycles_circuit(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(TraceToPolynomials<UltraFlavor>::compute_copy_cycles(builder));
+    }
+}
 } // namespace
 BENCHMARK(biggroup_construction_bench)->Unit(kMicrosecond)->DenseRange(2, 20);
+BENCHMARK(copy_cycles_serial_bench)->Unit(kMillisecond)->DenseRange(16, 20, 2);
+BENCHMARK(copy_cycles_parallel_bench)->Unit(kMillisecond)->DenseRange(16, 20, 2);
 
 BENCHMARK_MAIN();
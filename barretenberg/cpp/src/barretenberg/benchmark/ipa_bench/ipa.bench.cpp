@@ -1,5 +1,6 @@
 #include "barretenberg/commitment_schemes/ipa/ipa.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
+#include <algorithm>
 #include <benchmark/benchmark.h>
 
 using namespace benchmark;
@@ -18,6 +19,11 @@ VerifierCommitmentKey<Curve> vk;
 std::vector<std::shared_ptr<NativeTranscript>> prover_transcripts(MAX_POLYNOMIAL_DEGREE_LOG2 -
                                                                   MIN_POLYNOMIAL_DEGREE_LOG2 + 1);
 std::vector<OpeningClaim<Curve>> opening_claims(MAX_POLYNOMIAL_DEGREE_LOG2 - MIN_POLYNOMIAL_DEGREE_LOG2 + 1);
+// Claims verified together by ipa_batch_verify, all for polynomials of the largest size
+constexpr size_t MAX_BATCH_SIZE = 16;
+std::vector<HonkProof> batch_proofs;
+std::vector<OpeningClaim<Curve>> batch_opening_claims;
+
 static void DoSetup(const benchmark::State&)
 {
     srs::init_file_crs_factory(srs::bb_crs_path());
@@ -66,6 +72,54 @@ void ipa_verify(State& state) noexcept
         ASSERT(result);
     }
 }
+
+void prepare_batch()
+{
+    if (!batch_proofs.empty()) {
+        return;
+    }
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t n = 1 << MAX_POLYNOMIAL_DEGREE_LOG2;
+    for (size_t i = 0; i < MAX_BATCH_SIZE; ++i) {
+        Polynomial poly(n);
+        for (size_t j = 0; j < n; ++j) {
+            poly.at(j) = Fr::random_element(&engine);
+        }
+        auto x = Fr::random_element(&engine);
+        const OpeningPair<Curve> opening_pair = { x, poly.evaluate(x) };
+        batch_opening_claims.push_back({ opening_pair, ck.commit(poly) });
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA<Curve>::compute_opening_proof(ck, { poly, opening_pair }, prover_transcript);
+        batch_proofs.push_back(prover_transcript->export_proof());
+    }
+}
+
+// Args: number of claims, and whether they are verified with batch_reduce_verify (1) or one by one (0)
+void ipa_batch_verify(State& state) noexcept
+{
+    prepare_batch();
+    const auto num_claims = static_cast<size_t>(state.range(0));
+    const bool batched = state.range(1) != 0;
+    std::span<const OpeningClaim<Curve>> opening_claims(batch_opening_claims.data(), num_claims);
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts;
+        for (size_t i = 0; i < num_claims; ++i) {
+            verifier_transcripts.emplace_back(std::make_shared<NativeTranscript>());
+            verifier_transcripts.back()->load_proof(batch_proofs[i]);
+        }
+        state.ResumeTiming();
+        if (batched) {
+            auto result = IPA<Curve>::batch_reduce_verify<NativeTranscript>(vk, opening_claims, verifier_transcripts);
+            ASSERT(std::all_of(result.begin(), result.end(), [](bool verified) { return verified; }));
+        } else {
+            for (size_t i = 0; i < num_claims; ++i) {
+                auto result = IPA<Curve>::reduce_verify(vk, opening_claims[i], verifier_transcripts[i]);
+                ASSERT(result);
+            }
+        }
+    }
+}
 } // namespace
 BENCHMARK(ipa_open)
     ->Unit(kMillisecond)
@@ -75,4 +129,9 @@ BENCHMARK(ipa_verify)
     ->Unit(kMillisecond)
     ->DenseRange(MIN_POLYNOMIAL_DEGREE_LOG2, MAX_POLYNOMIAL_DEGREE_LOG2)
     ->Setup(DoSetup);
+BENCHMARK(ipa_batch_verify)
+    ->Unit(kMillisecond)
+    ->ArgsProduct({ { 1, 2, 4, 8, MAX_BATCH_SIZE }, { 0, 1 } })
+    ->ArgNames({ "claims", "batched" })
+    ->Setup(DoSetup);
 BENCHMARK_MAIN();
@@ -1,8 +1,17 @@
 #include "barretenberg/crypto/merkle_tree/merkle_tree.hpp"
+#include "barretenberg/common/thread_pool.hpp"
+#include "barretenberg/crypto/merkle_tree/append_only_tree/content_addressed_append_only_tree.hpp"
 #include "barretenberg/crypto/merkle_tree/hash.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
 #include "barretenberg/crypto/merkle_tree/memory_store.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/cached_content_addressed_tree_store.hpp"
+#include "barretenberg/crypto/merkle_tree/response.hpp"
+#include "barretenberg/crypto/merkle_tree/signal.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include <benchmark/benchmark.h>
+#include <filesystem>
+#include <memory>
+#include <string>
 
 using namespace benchmark;
 using namespace bb;
@@ -74,4 +83,73 @@ void update_random_elements(State& state) noexcept
 }
 BENCHMARK(update_random_elements)->Unit(benchmark::kMillisecond)->Range(100, 100)->Iterations(1);
 
+/**
+ * @brief Reading the sibling paths of a batch of leaves of a committed tree
+ * @details Arg 1 selects how the paths are read: 0 one path at a time through get_sibling_path, 1 all at once through
+ * get_sibling_paths, which walks the tree once and shares the nodes common to several paths.
+ */
+void sibling_paths(State& state) noexcept
+{
+    using StoreType = ContentAddressedCachedTreeStore<bb::fr>;
+    using AppendOnlyTreeType = ContentAddressedAppendOnlyTree<StoreType, Poseidon2HashPolicy>;
+    constexpr uint32_t TREE_DEPTH = 40;
+    constexpr size_t TREE_SIZE = 1 << 16;
+
+    const size_t num_paths = size_t(state.range(0));
+    const int64_t mode = state.range(1);
+
+    std::string name = "sibling_paths_" + std::to_string(engine.get_random_uint32());
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / name;
+    std::filesystem::create_directories(directory);
+    {
+        LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(directory.string(), name, 1024 * 1024, 16);
+        std::unique_ptr<StoreType> store = std::make_unique<StoreType>(name, TREE_DEPTH, db);
+        AppendOnlyTreeType tree(std::move(store), std::make_shared<ThreadPool>(1));
+
+        std::vector<fr> values(TREE_SIZE);
+        for (auto& value : values) {
+            value = fr(engine.get_random_uint256());
+        }
+        Signal add_signal(1);
+        tree.add_values(values, [&](const TypedResponse<AddDataResponse>&) { add_signal.signal_level(0); });
+        add_signal.wait_for_level(0);
+        Signal commit_signal(1);
+        tree.commit([&](const TypedResponse<CommitResponse>&) { commit_signal.signal_level(0); });
+        commit_signal.wait_for_level(0);
+
+        std::vector<index_t> indices(num_paths);
+        for (auto& index : indices) {
+            index = engine.get_random_uint64() % TREE_SIZE;
+        }
+
+        for (auto _ : state) {
+            if (mode == 0) {
+                for (const index_t& index : indices) {
+                    Signal path_signal(1);
+                    tree.get_sibling_path(
+                        index,
+                        [&](const TypedResponse<GetSiblingPathResponse>& response) {
+                            DoNotOptimize(response.inner.path);
+                            path_signal.signal_level(0);
+                        },
+                        false);
+                    path_signal.wait_for_level(0);
+                }
+            } else {
+                Signal paths_signal(1);
+                tree.get_sibling_paths(indices, false, [&](const TypedResponse<GetSiblingPathsResponse>& response) {
+                    DoNotOptimize(response.inner.paths);
+                    paths_signal.signal_level(0);
+                });
+                paths_signal.wait_for_level(0);
+            }
+        }
+    }
+    std::filesystem::remove_all(directory);
+}
+BENCHMARK(sibling_paths)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgsProduct({ { 64, 1024, 8192 }, { 0, 1 } })
+    ->ArgNames({ "num_paths", "mode" });
+
 BENCHMARK_MAIN();
@@ -1,4 +1,5 @@
 #include "barretenberg/crypto/poseidon2/poseidon2.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2_batch_permutation.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <benchmark/benchmark.h>
 
@@ -41,4 +42,61 @@ void poseiden_hash_bench(State& state) noexcept
 }
 BENCHMARK(poseiden_hash_bench)->Unit(benchmark::kMillisecond);
 
+using Poseidon2Params = bb::crypto::Poseidon2Bn254ScalarFieldParams;
+using Poseidon2State = bb::crypto::Poseidon2Permutation<Poseidon2Params>::State;
+
+std::vector<Poseidon2State> random_states(size_t count)
+{
+    std::vector<Poseidon2State> states(count);
+    for (auto& state : states) {
+        for (auto& element : state) {
+            element = fr::random_element();
+        }
+    }
+    return states;
+}
+
+// Single-threaded permutations per second, one state at a time
+void poseidon2_permutation_scalar_bench(State& state) noexcept
+{
+    auto states = random_states(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (auto& permutation_state : states) {
+            permutation_state = bb::crypto::Poseidon2Permutation<Poseidon2Params>::permutation(permutation_state);
+        }
+        DoNotOptimize(states.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(poseidon2_permutation_scalar_bench)->Arg(8)->Arg(1024);
+
+// Single-threaded permutations per second through the batch permutation (vectorized if the CPU supports it)
+void poseidon2_permutation_batch_bench(State& state) noexcept
+{
+    auto states = random_states(static_cast<size_t>(state.range(0)));
+    state.SetLabel(bb::crypto::Poseidon2BatchPermutation<Poseidon2Params>::is_vectorized() ? "vectorized" : "scalar");
+    for (auto _ : state) {
+        bb::crypto::Poseidon2BatchPermutation<Poseidon2Params>::permute(states);
+        DoNotOptimize(states.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(poseidon2_permutation_batch_bench)->Arg(8)->Arg(1024);
+
+void poseidon2_hash_pairs_bench(State& state) noexcept
+{
+    const auto num_pairs = static_cast<size_t>(state.range(0));
+    std::vector<fr> inputs(2 * num_pairs);
+    for (auto& input : inputs) {
+        input = fr::random_element();
+    }
+    std::vector<fr> outputs(num_pairs);
+    for (auto _ : state) {
+        bb::crypto::Poseidon2<Poseidon2Params>::hash_pairs(inputs, outputs);
+        DoNotOptimize(outputs.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(poseidon2_hash_pairs_bench)->Arg(1024);
+
 BENCHMARK_MAIN();
\ No newline at end of file
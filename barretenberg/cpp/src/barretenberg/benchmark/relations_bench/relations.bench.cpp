@@ -1,3 +1,4 @@
+#include "barretenberg/ecc/curves/bn254/fr_lanes.hpp"
 #include "barretenberg/eccvm/eccvm_flavor.hpp"
 #include "barretenberg/flavor/mega_flavor.hpp"
 #include "barretenberg/flavor/ultra_flavor.hpp"
@@ -50,6 +51,31 @@ template <typename Flavor, typename Relation> void execute_relation_for_univaria
     execute_relation<Flavor, Relation, Input, Accumulator>(state);
 }
 
+// Single execution of relation on the degree-1 edges of Sumcheck of flavors with USE_SHORT_MONOMIALS, one edge at a
+// time (Fr) or FrLanes::NUM_LANES edges at a time (FrLanes); compare the edges processed per second
+template <typename Flavor, typename Relation, typename Fr> void execute_relation_for_edges(::benchmark::State& state)
+{
+    using FF = typename Flavor::FF;
+    using Input = typename Flavor::template AllEntities<bb::Univariate<Fr, 2>>;
+    using Accumulator = TupleOfUnivariates<Fr, Relation::SUBRELATION_PARTIAL_LENGTHS>;
+    constexpr size_t NUM_EDGES = std::same_as<Fr, FrLanes> ? FrLanes::NUM_LANES : 1;
+
+    auto params = bb::RelationParameters<FF>::get_random();
+
+    // Random inputs, so that the relation is evaluated as it is on a non-trivial row
+    Input input;
+    for (auto& edge : input.get_all()) {
+        edge = bb::Univariate<Fr, 2>::get_random();
+    }
+    Accumulator accumulator;
+    std::apply([](auto&... elements) { ((elements = std::decay_t<decltype(elements)>::zero()), ...); }, accumulator);
+
+    for (auto _ : state) {
+        Relation::accumulate(accumulator, input, params, 1);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUM_EDGES));
+}
+
 // Single execution of relation on PG univariates, i.e. PG combiner work
 template <typename Flavor, typename Relation> void execute_relation_for_pg_univariates(::benchmark::State& state)
 {
@@ -89,6 +115,30 @@ BENCHMARK(execute_relation_for_univariates<MegaFlavor, DatabusLookupRelation<Fr>
 BENCHMARK(execute_relation_for_univariates<MegaFlavor, Poseidon2ExternalRelation<Fr>>);
 BENCHMARK(execute_relation_for_univariates<MegaFlavor, Poseidon2InternalRelation<Fr>>);
 
+// Ultra relations on the edges of Sumcheck, one at a time and FrLanes::NUM_LANES at a time
+BENCHMARK(execute_relation_for_edges<UltraFlavor, UltraArithmeticRelation<Fr>, Fr>);
+BENCHMARK(execute_relation_for_edges<UltraFlavor, UltraArithmeticRelation<Fr>, FrLanes>);
+BENCHMARK(execute_relation_for_edges<UltraFlavor, DeltaRangeConstraintRelation<Fr>, Fr>);
+BENCHMARK(execute_relation_for_edges<UltraFlavor, DeltaRangeConstraintRelation<Fr>, FrLanes>);
+BENCHMARK(execute_relation_for_edges<UltraFlavor, EllipticRelation<Fr>, Fr>);
+BENCHMARK(execute_relation_for_edges<UltraFlavor, EllipticRelation<Fr>, FrLanes>);
+BENCHMARK(execute_relation_for_edges<UltraFlavor, AuxiliaryRelation<Fr>, Fr>);
+BENCHMARK(execute_relation_for_edges<UltraFlavor, AuxiliaryRelation<Fr>, FrLanes>);
+BENCHMARK(execute_relation_for_edges<UltraFlavor, LogDerivLookupRelation<Fr>, Fr>);
+BENCHMARK(execute_relation_for_edges<UltraFlavor, LogDerivLookupRelation<Fr>, FrLanes>);
+BENCHMARK(execute_relation_for_edges<UltraFlavor, UltraPermutationRelation<Fr>, Fr>);
+BENCHMARK(execute_relation_for_edges<UltraFlavor, UltraPermutationRelation<Fr>, FrLanes>);
+
+// Goblin-Ultra only relations on the edges of Sumcheck, one at a time and FrLanes::NUM_LANES at a time
+BENCHMARK(execute_relation_for_edges<MegaFlavor, EccOpQueueRelation<Fr>, Fr>);
+BENCHMARK(execute_relation_for_edges<MegaFlavor, EccOpQueueRelation<Fr>, FrLanes>);
+BENCHMARK(execute_relation_for_edges<MegaFlavor, DatabusLookupRelation<Fr>, Fr>);
+BENCHMARK(execute_relation_for_edges<MegaFlavor, DatabusLookupRelation<Fr>, FrLanes>);
+BENCHMARK(execute_relation_for_edges<MegaFlavor, Poseidon2ExternalRelation<Fr>, Fr>);
+BENCHMARK(execute_relation_for_edges<MegaFlavor, Poseidon2ExternalRelation<Fr>, FrLanes>);
+BENCHMARK(execute_relation_for_edges<MegaFlavor, Poseidon2InternalRelation<Fr>, Fr>);
+BENCHMARK(execute_relation_for_edges<MegaFlavor, Poseidon2InternalRelation<Fr>, FrLanes>);
+
 // Ultra relations (verifier work)
 BENCHMARK(execute_relation_for_values<UltraFlavor, UltraArithmeticRelation<Fr>>);
 BENCHMARK(execute_relation_for_values<UltraFlavor, DeltaRangeConstraintRelation<Fr>>);
@@ -0,0 +1,107 @@
+#include "barretenberg/constants.hpp"
+#include "barretenberg/ecc/curves/bn254/g1.hpp"
+#include "barretenberg/transcript/transcript.hpp"
+#include <array>
+#include <benchmark/benchmark.h>
+#include <string>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+using FF = fr;
+using Commitment = g1::affine_element;
+
+// The shape of an AVM proof, see AvmFlavorVariables and COMPUTED_AVM_PROOF_LENGTH_IN_FIELDS
+constexpr size_t NUM_WIRE_COMMITMENTS = 1800;
+constexpr size_t NUM_LOOKUP_COMMITMENTS = 322;
+constexpr size_t NUM_EVALUATIONS = 2475;
+constexpr size_t UNIVARIATE_LENGTH = 9;
+constexpr size_t LOG_N = CONST_PROOF_SIZE_LOG_N;
+
+/**
+ * @brief Run the rounds of an AVM proof through a transcript, as the prover (sending) or the verifier (receiving)
+ * @details Only the transcript work is measured: the data sent is constant, and no group operation is performed.
+ */
+template <typename Transcript, bool is_prover> FF run_avm_transcript(Transcript& transcript)
+{
+    const Commitment commitment = Commitment::one();
+    const FF evaluation = FF(7);
+    auto send = [&]<typename T>(const std::string& label, const T& value) {
+        if constexpr (is_prover) {
+            transcript.send_to_verifier(label, value);
+        } else {
+            static_cast<void>(transcript.template receive_from_prover<T>(label));
+        }
+    };
+
+    send("circuit_size", static_cast<uint32_t>(1 << 21));
+    for (size_t i = 0; i < NUM_WIRE_COMMITMENTS; i++) {
+        send("wire_" + std::to_string(i), commitment);
+    }
+    auto [beta, gamma] = transcript.template get_challenges<FF>("beta", "gamma");
+    for (size_t i = 0; i < NUM_LOOKUP_COMMITMENTS; i++) {
+        send("lookup_inverse_" + std::to_string(i), commitment);
+    }
+    FF challenge = transcript.template get_challenge<FF>("Sumcheck:alpha");
+    for (size_t i = 0; i < LOG_N; i++) {
+        challenge = transcript.template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(i));
+    }
+
+    std::array<FF, UNIVARIATE_LENGTH> univariate;
+    univariate.fill(evaluation);
+    for (size_t i = 0; i < LOG_N; i++) {
+        send("Sumcheck:univariate_" + std::to_string(i), univariate);
+        challenge = transcript.template get_challenge<FF>("Sumcheck:u_" + std::to_string(i));
+    }
+    std::array<FF, NUM_EVALUATIONS> evaluations;
+    evaluations.fill(evaluation);
+    send("Sumcheck:evaluations", evaluations);
+
+    challenge = transcript.template get_challenge<FF>("rho");
+    for (size_t i = 1; i < LOG_N; i++) {
+        send("Gemini:FOLD_" + std::to_string(i), commitment);
+    }
+    challenge = transcript.template get_challenge<FF>("Gemini:r");
+    for (size_t i = 1; i <= LOG_N; i++) {
+        send("Gemini:a_" + std::to_string(i), evaluation);
+    }
+    challenge = transcript.template get_challenge<FF>("Shplonk:nu");
+    send("Shplonk:Q", commitment);
+    challenge = transcript.template get_challenge<FF>("Shplonk:z");
+    send("KZG:W", commitment);
+    return challenge + beta + gamma;
+}
+
+template <typename Transcript> HonkProof avm_proof()
+{
+    Transcript transcript;
+    run_avm_transcript<Transcript, true>(transcript);
+    return transcript.export_proof();
+}
+
+template <typename Transcript> void avm_prover_transcript_bench(State& state) noexcept
+{
+    for (auto _ : state) {
+        Transcript transcript;
+        DoNotOptimize(run_avm_transcript<Transcript, true>(transcript));
+    }
+}
+
+template <typename Transcript> void avm_verifier_transcript_bench(State& state) noexcept
+{
+    const HonkProof proof = avm_proof<Transcript>();
+    for (auto _ : state) {
+        Transcript transcript;
+        transcript.load_proof(proof);
+        DoNotOptimize(run_avm_transcript<Transcript, false>(transcript));
+    }
+}
+} // namespace
+
+BENCHMARK_TEMPLATE(avm_prover_transcript_bench, NativeTranscript)->Unit(kMillisecond);
+BENCHMARK_TEMPLATE(avm_prover_transcript_bench, NativeSpongeTranscript)->Unit(kMillisecond);
+BENCHMARK_TEMPLATE(avm_verifier_transcript_bench, NativeTranscript)->Unit(kMillisecond);
+BENCHMARK_TEMPLATE(avm_verifier_transcript_bench, NativeSpongeTranscript)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
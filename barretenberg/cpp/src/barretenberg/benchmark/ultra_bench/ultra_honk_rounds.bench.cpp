@@ -75,6 +75,36 @@ BB_PROFILE static void test_round(State& state, size_t index) noexcept
         // NOTE: google bench is very finnicky, must end in ResumeTiming() for correctness
     }
 }
+
+/**
+ * @details Benchmark the relation check rounds of Goblin ultrahonk for a circuit laid out in a structured trace of size
+ * 2^20, which is mostly empty, either skipping the rows outside of its blocks or visiting every row.
+ * @param state - The google benchmark state: log2 of the number of gates, and whether to skip the empty rows.
+ **/
+BB_PROFILE static void RELATION_CHECK_STRUCTURED(State& state) noexcept
+{
+    auto log2_num_gates = static_cast<size_t>(state.range(0));
+    const bool skip_empty_rows = state.range(1) != 0;
+    bb::srs::init_file_crs_factory(bb::srs::bb_crs_path());
+
+    MegaCircuitBuilder builder;
+    bb::mock_circuits::generate_basic_arithmetic_circuit(builder, log2_num_gates);
+    auto proving_key = std::make_shared<DeciderProvingKey_<MegaFlavor>>(builder, TraceSettings{ EXAMPLE_20 });
+    if (!skip_empty_rows) {
+        proving_key->sumcheck_active_ranges.clear();
+    }
+    auto verification_key = std::make_shared<MegaFlavor::VerificationKey>(proving_key->proving_key);
+    MegaProver prover(proving_key, verification_key);
+    OinkProver<MegaFlavor> oink_prover(prover.proving_key, verification_key, prover.transcript);
+    oink_prover.prove();
+    prover.generate_gate_challenges();
+
+    for (auto _ : state) {
+        DeciderProver_<MegaFlavor> decider_prover(prover.proving_key, prover.transcript);
+        decider_prover.execute_relation_check_rounds();
+    }
+}
+
 #define ROUND_BENCHMARK(round)                                                                                         \
     static void ROUND_##round(State& state) noexcept                                                                   \
     {                                                                                                                  \
@@ -91,5 +121,9 @@ ROUND_BENCHMARK(LOG_DERIVATIVE_INVERSE)->Iterations(1);
 ROUND_BENCHMARK(GRAND_PRODUCT_COMPUTATION)->Iterations(1);
 ROUND_BENCHMARK(GENERATE_ALPHAS)->Iterations(1);
 ROUND_BENCHMARK(RELATION_CHECK);
+BENCHMARK(RELATION_CHECK_STRUCTURED)
+    ->ArgsProduct({ { 14, 16, 18 }, { 0, 1 } })
+    ->ArgNames({ "log2_num_gates", "skip_empty_rows" })
+    ->Unit(kMillisecond);
 
 BENCHMARK_MAIN();
@@ -187,6 +187,69 @@ template <typename Curve> void bench_commit_random(::benchmark::State& state)
     }
 }
 
+// Commit to a polynomial with dense random nonzero entries using the fixed-base mode. The second argument is the
+// memory budget of the precomputed table as a multiple of the size of the SRS prefix.
+template <typename Curve> void bench_commit_random_fixed_base(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    const size_t num_points = 1 << state.range(0);
+    const size_t memory_budget =
+        static_cast<size_t>(state.range(1)) * num_points * sizeof(typename Curve::AffineElement);
+    CommitmentKey<Curve>::set_fixed_base_memory_budget(memory_budget);
+    auto key = create_commitment_key<Curve>(num_points);
+    CommitmentKey<Curve>::set_fixed_base_memory_budget(0);
+
+    Polynomial<Fr> polynomial = Polynomial<Fr>::random(num_points);
+    for (auto _ : state) {
+        key.commit(polynomial);
+    }
+}
+
+// A set of polynomials resembling the witness commitments of a single prover round: a few full wires, a few wires
+// that only fill part of the trace and a few sparse lookup polynomials
+template <typename FF> std::vector<Polynomial<FF>> prover_round_random_polys(const size_t num_points)
+{
+    std::vector<Polynomial<FF>> polynomials;
+    for (size_t i = 0; i < 3; ++i) {
+        polynomials.emplace_back(Polynomial<FF>::random(num_points));
+    }
+    for (size_t i = 0; i < 3; ++i) {
+        polynomials.emplace_back(Polynomial<FF>::random(num_points >> (i + 1)));
+    }
+    for (size_t i = 0; i < 2; ++i) {
+        polynomials.emplace_back(sparse_random_poly<FF>(num_points, num_points / 64));
+    }
+    return polynomials;
+}
+
+// Commit to a prover round worth of polynomials one at a time
+template <typename Curve> void bench_commit_prover_round_sequential(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    std::vector<Polynomial<Fr>> polynomials = prover_round_random_polys<Fr>(num_points);
+    for (auto _ : state) {
+        for (auto& polynomial : polynomials) {
+            key.commit(polynomial);
+        }
+    }
+}
+
+// Commit to a prover round worth of polynomials with a single batched MSM
+template <typename Curve> void bench_commit_prover_round_batched(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    std::vector<Polynomial<Fr>> polynomials = prover_round_random_polys<Fr>(num_points);
+    for (auto _ : state) {
+        key.batch_commit(RefVector(polynomials));
+    }
+}
+
 // Commit to a polynomial with dense random nonzero entries but NOT our happiest case of an exact power of 2
 // Note this used to be a 50% regression just subtracting a power of 2 by 1.
 template <typename Curve> void bench_commit_random_non_power_of_2(::benchmark::State& state)
@@ -309,6 +372,15 @@ BENCHMARK(bench_commit_sparse_random_preprocessed<curve::BN254>)
 BENCHMARK(bench_commit_random<curve::BN254>)
     ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
     ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_random_fixed_base<curve::BN254>)
+    ->ArgsProduct({ benchmark::CreateDenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS, 1), { 4, 16, 64 } })
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_prover_round_sequential<curve::BN254>)
+    ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_prover_round_batched<curve::BN254>)
+    ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
+    ->Unit(benchmark::kMillisecond);
 BENCHMARK(bench_commit_random_non_power_of_2<curve::BN254>)
     ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
     ->Unit(benchmark::kMillisecond);
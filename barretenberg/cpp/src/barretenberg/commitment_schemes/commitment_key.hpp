@@ -14,6 +14,7 @@
  */
 
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/ref_vector.hpp"
 #include "barretenberg/constants.hpp"
 #include "barretenberg/ecc/batched_affine_addition/batched_affine_addition.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
@@ -26,6 +27,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <string_view>
 
 namespace bb {
@@ -54,9 +56,65 @@ template <class Curve> class CommitmentKey {
         return numeric::round_up_power_2(num_points) + EXTRA_SRS_POINTS_FOR_ECCVM_IPA;
     }
 
+    using FixedBaseTable = typename scalar_multiplication::MSM<Curve>::FixedBaseTable;
+
+    /**
+     * @brief Process-wide state of the opt-in fixed-base mode. The table is shared by every key over the same SRS.
+     */
+    struct FixedBaseCache {
+        std::mutex mutex;
+        size_t memory_budget_bytes = 0;
+        const G1* srs_data = nullptr;
+        std::shared_ptr<const FixedBaseTable> table;
+    };
+
+    static FixedBaseCache& get_fixed_base_cache()
+    {
+        static FixedBaseCache cache;
+        return cache;
+    }
+
+    /**
+     * @brief Get a fixed-base table covering at least the first `num_points` SRS points, if the mode is enabled
+     * @details The cached table is rebuilt when a key needs more points than it covers or the SRS has been replaced.
+     */
+    static std::shared_ptr<const FixedBaseTable> get_fixed_base_table(
+        const std::shared_ptr<srs::factories::Crs<Curve>>& crs, size_t num_points)
+    {
+        FixedBaseCache& cache = get_fixed_base_cache();
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        if (cache.memory_budget_bytes == 0) {
+            return nullptr;
+        }
+        std::span<const G1> points = crs->get_monomial_points();
+        num_points = std::min(num_points, points.size());
+        const bool same_srs = cache.srs_data == points.data();
+        if (same_srs && cache.table != nullptr && cache.table->num_bases >= num_points) {
+            return cache.table;
+        }
+        if (same_srs && cache.table != nullptr) {
+            num_points = std::max(num_points, cache.table->num_bases);
+        }
+        auto table = std::make_shared<const FixedBaseTable>(scalar_multiplication::MSM<Curve>::compute_fixed_base_table(
+            points.subspan(0, num_points), cache.memory_budget_bytes));
+        if (table->empty()) {
+            vinfo("fixed-base memory budget of ",
+                  cache.memory_budget_bytes,
+                  " bytes is too small for ",
+                  num_points,
+                  " points, using the default commitment path");
+            return nullptr;
+        }
+        cache.srs_data = points.data();
+        cache.table = table;
+        return table;
+    }
+
   public:
     std::shared_ptr<srs::factories::Crs<Curve>> srs;
     size_t dyadic_size;
+    // Precomputed multiples of the SRS points used by `commit` when the fixed-base mode is enabled
+    std::shared_ptr<const FixedBaseTable> fixed_base_table;
 
     CommitmentKey() = default;
 
@@ -70,7 +128,28 @@ template <class Curve> class CommitmentKey {
     CommitmentKey(const size_t num_points)
         : srs(srs::get_crs_factory<Curve>()->get_crs(get_num_needed_srs_points(num_points)))
         , dyadic_size(get_num_needed_srs_points(num_points))
+        , fixed_base_table(get_fixed_base_table(srs, dyadic_size))
     {}
+
+    /**
+     * @brief Opt into the fixed-base MSM mode for all commitment keys over this curve constructed from now on
+     * @details Instead of running Pippenger from scratch against the raw SRS, such keys commit using precomputed
+     * multiples of the SRS points (see MSM::FixedBaseTable), which cuts the number of bucket accumulation rounds. The
+     * table is built once, uses at most `memory_budget_bytes` and is shared between keys. A budget of zero disables
+     * the mode and releases the cached table once no key references it.
+     *
+     * @param memory_budget_bytes
+     */
+    static void set_fixed_base_memory_budget(size_t memory_budget_bytes)
+    {
+        FixedBaseCache& cache = get_fixed_base_cache();
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        if (cache.memory_budget_bytes != memory_budget_bytes) {
+            cache.memory_budget_bytes = memory_budget_bytes;
+            cache.srs_data = nullptr;
+            cache.table = nullptr;
+        }
+    }
     /**
      * @brief Checks the commitment key is properly initialized.
      *
@@ -99,11 +178,72 @@ template <class Curve> class CommitmentKey {
                                   srs->get_monomial_size()));
         }
 
+        if (fixed_base_table != nullptr && consumed_srs <= fixed_base_table->num_bases) {
+            return scalar_multiplication::MSM<Curve>::fixed_base_msm(*fixed_base_table, polynomial);
+        }
+
         G1 r = scalar_multiplication::pippenger_unsafe<Curve>(polynomial, point_table);
         Commitment point(r);
         return point;
     };
 
+    /**
+     * @brief Commit to a set of polynomials with a single batched Pippenger invocation
+     * @details Committing one polynomial at a time parallelizes each MSM on its own, which leaves threads idle on
+     * small or sparse polynomials and repeats the per-MSM setup. MSM::batch_multi_scalar_mul instead transforms the
+     * scalars of the whole batch up front and splits the combined nonzero work evenly between threads.
+     *
+     * @param polynomials
+     * @return std::vector<Commitment> the commitments, in the order of the input
+     */
+    std::vector<Commitment> batch_commit(RefVector<Polynomial<Fr>> polynomials) const
+    {
+        PROFILE_THIS_NAME("batch_commit");
+        std::span<const G1> point_table = srs->get_monomial_points();
+        size_t max_consumed_srs = 0;
+        for (const Polynomial<Fr>& polynomial : polynomials) {
+            max_consumed_srs = std::max(max_consumed_srs, polynomial.start_index() + polynomial.size());
+        }
+        if (max_consumed_srs > srs->get_monomial_size()) {
+            throw_or_abort(format("Attempting to commit to a polynomial that needs ",
+                                  max_consumed_srs,
+                                  " points with an SRS of size ",
+                                  srs->get_monomial_size()));
+        }
+
+        // The fixed-base MSM already parallelizes well within a single polynomial
+        if (fixed_base_table != nullptr && max_consumed_srs <= fixed_base_table->num_bases) {
+            std::vector<Commitment> commitments;
+            commitments.reserve(polynomials.size());
+            for (const Polynomial<Fr>& polynomial : polynomials) {
+                commitments.emplace_back(commit(polynomial));
+            }
+            return commitments;
+        }
+
+        // Empty polynomials commit to the point at infinity and are left out of the batch
+        std::vector<Commitment> commitments(polynomials.size(), Curve::Group::affine_point_at_infinity);
+        std::vector<size_t> batch_indices;
+        std::vector<std::span<const G1>> points;
+        std::vector<std::span<Fr>> scalars;
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            Polynomial<Fr>& polynomial = polynomials[i];
+            if (polynomial.size() > 0) {
+                batch_indices.emplace_back(i);
+                points.emplace_back(point_table.subspan(polynomial.start_index()));
+                scalars.emplace_back(polynomial.coeffs());
+            }
+        }
+        if (!batch_indices.empty()) {
+            std::vector<Commitment> results =
+                scalar_multiplication::MSM<Curve>::batch_multi_scalar_mul(points, scalars, /*handle_edge_cases=*/false);
+            for (size_t i = 0; i < batch_indices.size(); ++i) {
+                commitments[batch_indices[i]] = results[i];
+            }
+        }
+        return commitments;
+    }
+
     /**
      * @brief Efficiently commit to a polynomial whose nonzero elements are arranged in discrete blocks
      * @details Given a set of ranges where the polynomial takes non-zero values, copy the non-zero inputs (scalars,
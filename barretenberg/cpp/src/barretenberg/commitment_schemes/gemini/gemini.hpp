@@ -319,6 +319,12 @@ template <typename Curve> class GeminiProver_ {
                                                             std::span<const Fr> multilinear_challenge,
                                                             const Polynomial& A_0);
 
+    static std::pair<std::vector<Polynomial>, std::vector<Commitment>> compute_and_commit_fold_polynomials(
+        const size_t log_n,
+        std::span<const Fr> multilinear_challenge,
+        Polynomial&& A_0,
+        const CommitmentKey<Curve>& commitment_key);
+
     static std::pair<Polynomial, Polynomial> compute_partially_evaluated_batch_polynomials(
         const size_t log_n,
         PolynomialBatcher& polynomial_batcher,
@@ -339,6 +345,8 @@ template <typename Curve> class GeminiProver_ {
                                     const std::shared_ptr<Transcript>& transcript,
                                     bool has_zk = false);
 
+  private:
+    static void fold(const Polynomial& A_l, const Fr& u_l, Polynomial& A_l_fold);
 }; // namespace bb
 
 template <typename Curve> class GeminiVerifier_ {
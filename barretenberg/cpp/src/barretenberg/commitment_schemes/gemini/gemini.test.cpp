@@ -254,5 +254,28 @@ TYPED_TEST(GeminiTest, SoundnessRegression)
     }
 }
 
+/**
+ * @brief The pipelined fold computation produces the same folds and commitments as folding then committing
+ */
+TYPED_TEST(GeminiTest, PipelinedFoldsMatch)
+{
+    using Fr = typename TypeParam::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    auto u = this->random_evaluation_point(this->log_n);
+    Polynomial A_0 = Polynomial::random(this->n);
+
+    auto fold_polynomials = GeminiProver_<TypeParam>::compute_fold_polynomials(this->log_n, u, A_0);
+    auto [pipelined_folds, pipelined_commitments] =
+        GeminiProver_<TypeParam>::compute_and_commit_fold_polynomials(this->log_n, u, std::move(A_0), this->ck);
+
+    ASSERT_EQ(pipelined_folds.size(), this->log_n - 1);
+    ASSERT_EQ(pipelined_commitments.size(), this->log_n - 1);
+    for (size_t l = 0; l < this->log_n - 1; ++l) {
+        EXPECT_EQ(pipelined_folds[l], fold_polynomials[l]);
+        EXPECT_EQ(pipelined_commitments[l], this->ck.commit(fold_polynomials[l]));
+    }
+}
+
 template <class Curve> typename GeminiTest<Curve>::CK GeminiTest<Curve>::ck;
 template <class Curve> typename GeminiTest<Curve>::VK GeminiTest<Curve>::vk;
@@ -79,14 +79,15 @@ std::vector<typename GeminiProver_<Curve>::Claim> GeminiProver_<Curve>::prove(
 
     Polynomial A_0 = polynomial_batcher.compute_batched(rho, running_scalar);
 
-    // Construct the d-1 Gemini foldings of A₀(X)
-    std::vector<Polynomial> fold_polynomials = compute_fold_polynomials(log_n, multilinear_challenge, A_0);
+    // Construct and commit to the d-1 Gemini foldings of A₀(X); A₀ itself is released once folded
+    auto [fold_polynomials, fold_commitments] =
+        compute_and_commit_fold_polynomials(log_n, multilinear_challenge, std::move(A_0), commitment_key);
 
     // If virtual_log_n >= log_n, pad the fold commitments with dummy group elements [1]_1.
     for (size_t l = 0; l < virtual_log_n - 1; l++) {
         std::string label = "Gemini:FOLD_" + std::to_string(l + 1);
         if (l < log_n - 1) {
-            transcript->send_to_verifier(label, commitment_key.commit(fold_polynomials[l]));
+            transcript->send_to_verifier(label, fold_commitments[l]);
         } else {
             transcript->send_to_verifier(label, Commitment::one());
         }
@@ -147,60 +148,102 @@ template <typename Curve>
 std::vector<typename GeminiProver_<Curve>::Polynomial> GeminiProver_<Curve>::compute_fold_polynomials(
     const size_t log_n, std::span<const Fr> multilinear_challenge, const Polynomial& A_0)
 {
-    const size_t num_threads = get_num_cpus_pow2();
-    constexpr size_t efficient_operations_per_thread = 64; // A guess of the number of operation for which there
-                                                           // would be a point in sending them to a separate thread
-
-    // Reserve and allocate space for m-1 Fold polynomials, the foldings of the full batched polynomial A₀
     std::vector<Polynomial> fold_polynomials;
     fold_polynomials.reserve(log_n - 1);
-    for (size_t l = 0; l < log_n - 1; ++l) {
-        // size of the previous polynomial/2
-        const size_t n_l = 1 << (log_n - l - 1);
-
-        // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-        fold_polynomials.emplace_back(Polynomial(n_l));
-    }
 
     // A_l = Aₗ(X) is the polynomial being folded
     // in the first iteration, we take the batched polynomial
     // in the next iteration, it is the previously folded one
-    auto A_l = A_0.data();
+    const Polynomial* A_l = &A_0;
     for (size_t l = 0; l < log_n - 1; ++l) {
         // size of the previous polynomial/2
         const size_t n_l = 1 << (log_n - l - 1);
 
-        // Use as many threads as it is useful so that 1 thread doesn't process 1 element, but make sure that there is
-        // at least 1
-        size_t num_used_threads = std::min(n_l / efficient_operations_per_thread, num_threads);
-        num_used_threads = num_used_threads ? num_used_threads : 1;
-        size_t chunk_size = n_l / num_used_threads;
-        size_t last_chunk_size = (n_l % chunk_size) ? (n_l % num_used_threads) : chunk_size;
-
-        // Opening point is the same for all
-        const Fr u_l = multilinear_challenge[l];
-
         // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-        auto A_l_fold = fold_polynomials[l].data();
-
-        parallel_for(num_used_threads, [&](size_t i) {
-            size_t current_chunk_size = (i == (num_used_threads - 1)) ? last_chunk_size : chunk_size;
-            for (std::ptrdiff_t j = (std::ptrdiff_t)(i * chunk_size);
-                 j < (std::ptrdiff_t)((i * chunk_size) + current_chunk_size);
-                 j++) {
-                // fold(Aₗ)[j] = (1-uₗ)⋅even(Aₗ)[j] + uₗ⋅odd(Aₗ)[j]
-                //            = (1-uₗ)⋅Aₗ[2j]      + uₗ⋅Aₗ[2j+1]
-                //            = Aₗ₊₁[j]
-                A_l_fold[j] = A_l[j << 1] + u_l * (A_l[(j << 1) + 1] - A_l[j << 1]);
-            }
-        });
+        fold_polynomials.emplace_back(Polynomial(n_l, Polynomial::DontZeroMemory::FLAG));
+        fold(*A_l, multilinear_challenge[l], fold_polynomials.back());
         // set Aₗ₊₁ = Aₗ for the next iteration
-        A_l = A_l_fold;
+        A_l = &fold_polynomials.back();
     }
 
     return fold_polynomials;
 };
 
+/**
+ * @brief Computes the d-1 fold polynomials Fold_i, i = 1, ..., d-1, and their commitments
+ * @details Equivalent to compute_fold_polynomials followed by a commitment to each fold, but pipelined: the commitment
+ * to Fold_i is computed alongside Fold_{i+1}, the two jobs sharing the thread pool, so that the field work of the folds
+ * hides behind the MSMs. A₀ is only needed to compute Fold_1 and is released right after, before the other folds are
+ * allocated, which lowers the peak memory of the PCS by the size of the circuit.
+ *
+ * @param multilinear_challenge multilinear opening point 'u'
+ * @param A_0 = F(X) + G↺(X) = F(X) + G(X)/X
+ * @return The fold polynomials and their commitments
+ */
+template <typename Curve>
+std::pair<std::vector<typename GeminiProver_<Curve>::Polynomial>, std::vector<typename GeminiProver_<Curve>::Commitment>>
+GeminiProver_<Curve>::compute_and_commit_fold_polynomials(const size_t log_n,
+                                                          std::span<const Fr> multilinear_challenge,
+                                                          Polynomial&& A_0,
+                                                          const CommitmentKey<Curve>& commitment_key)
+{
+    PROFILE_THIS_NAME("Gemini::compute_and_commit_fold_polynomials");
+
+    std::vector<Polynomial> fold_polynomials;
+    std::vector<Commitment> fold_commitments;
+    if (log_n <= 1) {
+        return { std::move(fold_polynomials), std::move(fold_commitments) };
+    }
+    fold_commitments.resize(log_n - 1);
+    // The folds must not move while a commitment job reads them
+    fold_polynomials.reserve(log_n - 1);
+
+    fold_polynomials.emplace_back(Polynomial(1 << (log_n - 1), Polynomial::DontZeroMemory::FLAG));
+    fold(A_0, multilinear_challenge[0], fold_polynomials[0]);
+    A_0 = Polynomial();
+
+    for (size_t l = 1; l < log_n - 1; ++l) {
+        const size_t n_l = 1 << (log_n - l - 1);
+        fold_polynomials.emplace_back(Polynomial(n_l, Polynomial::DontZeroMemory::FLAG));
+        parallel_invoke({ [&]() { fold_commitments[l - 1] = commitment_key.commit(fold_polynomials[l - 1]); },
+                          [&]() { fold(fold_polynomials[l - 1], multilinear_challenge[l], fold_polynomials[l]); } });
+    }
+    fold_commitments[log_n - 2] = commitment_key.commit(fold_polynomials[log_n - 2]);
+
+    return { std::move(fold_polynomials), std::move(fold_commitments) };
+};
+
+/**
+ * @brief Computes A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X), where A_l_fold has half the size of A_l
+ */
+template <typename Curve>
+void GeminiProver_<Curve>::fold(const Polynomial& A_l, const Fr& u_l, Polynomial& A_l_fold)
+{
+    const size_t num_threads = get_num_cpus_pow2();
+    constexpr size_t efficient_operations_per_thread = 64; // A guess of the number of operation for which there
+                                                           // would be a point in sending them to a separate thread
+    const size_t n_l = A_l_fold.size();
+
+    // Use as many threads as it is useful so that 1 thread doesn't process 1 element, but make sure that there is
+    // at least 1
+    size_t num_used_threads = std::min(n_l / efficient_operations_per_thread, num_threads);
+    num_used_threads = num_used_threads ? num_used_threads : 1;
+    size_t chunk_size = n_l / num_used_threads;
+    size_t last_chunk_size = (n_l % chunk_size) ? (n_l % num_used_threads) : chunk_size;
+
+    const Fr* A_l_data = A_l.data();
+    Fr* A_l_fold_data = A_l_fold.data();
+    parallel_for(num_used_threads, [&](size_t i) {
+        size_t current_chunk_size = (i == (num_used_threads - 1)) ? last_chunk_size : chunk_size;
+        for (size_t j = i * chunk_size; j < (i * chunk_size) + current_chunk_size; j++) {
+            // fold(Aₗ)[j] = (1-uₗ)⋅even(Aₗ)[j] + uₗ⋅odd(Aₗ)[j]
+            //            = (1-uₗ)⋅Aₗ[2j]      + uₗ⋅Aₗ[2j+1]
+            //            = Aₗ₊₁[j]
+            A_l_fold_data[j] = A_l_data[j << 1] + u_l * (A_l_data[(j << 1) + 1] - A_l_data[j << 1]);
+        }
+    });
+};
+
 /**
 
  *
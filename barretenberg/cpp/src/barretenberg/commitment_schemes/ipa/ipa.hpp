@@ -19,8 +19,11 @@
 #include "barretenberg/stdlib/primitives/circuit_builders/circuit_builders_fwd.hpp"
 #include "barretenberg/stdlib/transcript/transcript.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include <algorithm>
 #include <cstddef>
+#include <exception>
 #include <numeric>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -530,6 +533,170 @@ template <typename Curve_> class IPA {
         return {stdlib_log_poly_length, round_challenges_inv, G_zero};
     }
 
+    /**
+     * @brief The data of a native IPA proof that batch verification needs, read from its transcript.
+     */
+    struct NativeProofData {
+        size_t log_poly_length = 0;
+        Fr generator_challenge;
+        // u_j^{-1}, in the order they are used to construct the vector s
+        std::vector<Fr> round_challenges_inv;
+        // L_j, R_j and their scalars u_j^{-1}, u_j in the MSM of step 5 of reduce_verify_internal_native
+        std::vector<Commitment> lr_elements;
+        std::vector<Fr> lr_scalars;
+        Commitment G_zero;
+        Fr a_zero;
+        Fr b_zero;
+    };
+
+    /**
+     * @brief Read an IPA proof from the transcript and derive its challenges, i.e. steps 1, 2, 4, 6 and 9 of \link
+     * IPA::reduce_verify_internal_native reduce_verify_internal_native \endlink, without any of the group operations.
+     * G₀ is taken from the proof; checking it against the SRS is left to the caller.
+     */
+    static NativeProofData receive_proof_native(const VK& vk, const OpeningClaim<Curve>& opening_claim, auto& transcript)
+        requires(!Curve::is_stdlib_type)
+    {
+        NativeProofData proof;
+        auto poly_length = static_cast<uint32_t>(transcript->template receive_from_prover<typename Curve::BaseField>(
+            "IPA:poly_degree_plus_1"));
+
+        proof.generator_challenge = transcript->template get_challenge<Fr>("IPA:generator_challenge");
+        if (proof.generator_challenge.is_zero()) {
+            throw_or_abort("The generator challenge can't be zero");
+        }
+
+        proof.log_poly_length = static_cast<size_t>(numeric::get_msb(poly_length));
+        if (proof.log_poly_length > CONST_ECCVM_LOG_N) {
+            throw_or_abort("IPA log_poly_length is too large " + std::to_string(proof.log_poly_length));
+        }
+        if ((size_t{ 1 } << proof.log_poly_length) > vk.get_monomial_points().size()) {
+            throw_or_abort("potential bug: Not enough SRS points for IPA!");
+        }
+
+        std::vector<Fr> round_challenges(CONST_ECCVM_LOG_N);
+        for (size_t i = 0; i < CONST_ECCVM_LOG_N; i++) {
+            std::string index = std::to_string(CONST_ECCVM_LOG_N - i - 1);
+            auto element_L = transcript->template receive_from_prover<Commitment>("IPA:L_" + index);
+            auto element_R = transcript->template receive_from_prover<Commitment>("IPA:R_" + index);
+            round_challenges[i] = transcript->template get_challenge<Fr>("IPA:round_challenge_" + index);
+            if (round_challenges[i].is_zero()) {
+                throw_or_abort("Round challenges can't be zero");
+            }
+            if (i < proof.log_poly_length) {
+                proof.lr_elements.emplace_back(element_L);
+                proof.lr_elements.emplace_back(element_R);
+            }
+        }
+        round_challenges.resize(proof.log_poly_length);
+        proof.round_challenges_inv = round_challenges;
+        Fr::batch_invert(proof.round_challenges_inv);
+        for (size_t i = 0; i < proof.log_poly_length; i++) {
+            proof.lr_scalars.emplace_back(proof.round_challenges_inv[i]);
+            proof.lr_scalars.emplace_back(round_challenges[i]);
+        }
+
+        // b₀ = ∏_{i ∈ [k]} (1 + u_{i-1}^{-1}. (evaluation)^{2^{i-1}})
+        proof.b_zero = Fr::one();
+        Fr challenge_power = opening_claim.opening_pair.challenge;
+        for (size_t i = 0; i < proof.log_poly_length; i++) {
+            proof.b_zero *= Fr::one() + proof.round_challenges_inv[proof.log_poly_length - 1 - i] * challenge_power;
+            challenge_power.self_sqr();
+        }
+
+        proof.G_zero = transcript->template receive_from_prover<Commitment>("IPA:G_0");
+        proof.a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
+        return proof;
+    }
+
+    /**
+     * @brief Check a subset of the claims of a batch with one MSM.
+     * @details Claim j verifies iff both
+     *   \f$C_j + (f_j(\beta_j) - a_{0,j} b_{0,j}) U_j + \sum_i (u_{i,j}^{-1}L_{i,j} + u_{i,j}R_{i,j}) - a_{0,j}G_{0,j} = 0\f$
+     * and \f$G_{0,j} - \langle \vec{s}_j,\vec{G}\rangle = 0\f$ hold. Each of these relations is scaled by a fresh random
+     * factor and all of them are summed, so that the vectors \f$\vec{s}_j\f$ fold into a single vector of scalars for
+     * the SRS. The sum is zero if all claims verify, and otherwise only with negligible probability.
+     */
+    static bool batch_check_native(const VK& vk,
+                                   std::span<const OpeningClaim<Curve>> opening_claims,
+                                   std::span<const NativeProofData> proofs,
+                                   std::span<const size_t> indices)
+        requires(!Curve::is_stdlib_type)
+    {
+        size_t srs_msm_size = 0;
+        for (size_t j : indices) {
+            srs_msm_size = std::max(srs_msm_size, size_t{ 1 } << proofs[j].log_poly_length);
+        }
+        std::vector<Fr> srs_scalars(srs_msm_size, Fr::zero());
+        std::vector<Commitment> msm_elements;
+        std::vector<Fr> msm_scalars;
+        Fr generator_scalar = Fr::zero();
+
+        // Points at infinity (e.g. the commitment to a zero polynomial) contribute nothing and are left out
+        const auto add_term = [&](const Commitment& element, const Fr& scalar) {
+            if (!element.is_point_at_infinity()) {
+                msm_elements.emplace_back(element);
+                msm_scalars.emplace_back(scalar);
+            }
+        };
+        for (size_t j : indices) {
+            const NativeProofData& proof = proofs[j];
+            const OpeningClaim<Curve>& claim = opening_claims[j];
+            const Fr ipa_relation_factor = Fr::random_element();
+            const Fr G_zero_relation_factor = Fr::random_element();
+
+            add_term(claim.commitment, ipa_relation_factor);
+            generator_scalar += ipa_relation_factor * proof.generator_challenge *
+                                (claim.opening_pair.evaluation - proof.a_zero * proof.b_zero);
+            for (size_t i = 0; i < proof.lr_elements.size(); i++) {
+                add_term(proof.lr_elements[i], ipa_relation_factor * proof.lr_scalars[i]);
+            }
+            add_term(proof.G_zero, G_zero_relation_factor - ipa_relation_factor * proof.a_zero);
+
+            // srs_scalars -= G_zero_relation_factor ⋅ s_j
+            Polynomial<Fr> s_poly(construct_poly_from_u_challenges_inv(proof.log_poly_length,
+                                                                       proof.round_challenges_inv));
+            const Fr s_factor = -G_zero_relation_factor;
+            parallel_for_heuristic(
+                s_poly.size(),
+                [&](size_t i) { srs_scalars[i] += s_factor * s_poly[i]; },
+                thread_heuristics::FF_ADDITION_COST + thread_heuristics::FF_MULTIPLICATION_COST);
+        }
+        add_term(Commitment::one(), generator_scalar);
+
+        // The proof elements are arbitrary points, so unlike the SRS they need the edge-case handling MSM
+        GroupElement result = scalar_multiplication::pippenger<Curve>({ 0, msm_scalars }, msm_elements);
+        std::span<const Commitment> srs_elements = vk.get_monomial_points();
+        result += scalar_multiplication::pippenger_unsafe<Curve>({ 0, srs_scalars },
+                                                                 srs_elements.subspan(0, srs_msm_size));
+        return result.is_point_at_infinity();
+    }
+
+    /**
+     * @brief Find the claims of a batch that do not verify by checking it, then each half of a batch that fails,
+     * recursively. Costs one check if all claims verify and O(f log n) checks if f out of n do not.
+     */
+    static void batch_verify_bisect_native(const VK& vk,
+                                           std::span<const OpeningClaim<Curve>> opening_claims,
+                                           std::span<const NativeProofData> proofs,
+                                           std::span<const size_t> indices,
+                                           std::vector<bool>& verified)
+        requires(!Curve::is_stdlib_type)
+    {
+        if (batch_check_native(vk, opening_claims, proofs, indices)) {
+            for (size_t j : indices) {
+                verified[j] = true;
+            }
+            return;
+        }
+        if (indices.size() == 1) {
+            return;
+        }
+        const size_t half = indices.size() / 2;
+        batch_verify_bisect_native(vk, opening_claims, proofs, indices.subspan(0, half), verified);
+        batch_verify_bisect_native(vk, opening_claims, proofs, indices.subspan(half), verified);
+    }
+
   public:
     /**
      * @brief Compute an inner product argument proof for opening a single polynomial at a single evaluation point.
@@ -568,6 +735,57 @@ template <typename Curve_> class IPA {
         return reduce_verify_internal_native(vk, opening_claim, transcript);
     }
 
+    /**
+     * @brief Natively verify many IPA proofs at once
+     *
+     * @param vk Verification_key containing srs
+     * @param opening_claims The claims C_j, (\f$\beta_j\f$, \f$f_j(\beta_j)\f$) to verify
+     * @param transcripts Transcripts with the proof of each claim, consumed as by reduce_verify
+     *
+     * @return whether each claim verifies
+     *
+     * @details The cost of verifying an IPA proof is dominated by the MSM \f$G_0=\langle \vec{s},\vec{G}\rangle\f$ of
+     * the size of the polynomial. Rather than computing it for every proof, the verification relations of all proofs
+     * are combined with random factors into a single MSM over the shared SRS (see \link IPA::batch_check_native
+     * batch_check_native \endlink), so N proofs cost about as much as one MSM of the size of the largest polynomial plus
+     * N linear-time constructions of \f$\vec{s}\f$. If the batch does not verify, it is bisected to find the claims at
+     * fault.
+     *
+     * Unlike reduce_verify, a G₀ in a proof that does not match the SRS makes its claim fail rather than abort.
+     */
+    template <typename Transcript>
+    static std::vector<bool> batch_reduce_verify(const VK& vk,
+                                                 std::span<const OpeningClaim<Curve>> opening_claims,
+                                                 std::span<const std::shared_ptr<Transcript>> transcripts)
+        requires(!Curve::is_stdlib_type)
+    {
+        BB_ASSERT_EQ(opening_claims.size(), transcripts.size(), "Each IPA claim needs a transcript.");
+        std::vector<NativeProofData> proofs(opening_claims.size());
+        // The claims whose proof could be read, a malformed proof only fails its own claim
+        std::vector<size_t> indices;
+        indices.reserve(opening_claims.size());
+        for (size_t j = 0; j < opening_claims.size(); j++) {
+#ifndef BB_NO_EXCEPTIONS
+            try {
+                proofs[j] = receive_proof_native(vk, opening_claims[j], transcripts[j]);
+            } catch (const std::exception& e) {
+                info("Failed to read IPA proof ", j, " of the batch: ", e.what());
+                continue;
+            }
+#else
+            proofs[j] = receive_proof_native(vk, opening_claims[j], transcripts[j]);
+#endif
+            indices.emplace_back(j);
+        }
+
+        std::vector<bool> verified(opening_claims.size(), false);
+        if (indices.empty()) {
+            return verified;
+        }
+        batch_verify_bisect_native(vk, opening_claims, proofs, indices, verified);
+        return verified;
+    }
+
     /**
      * @brief Recursively verify the correctness of a proof
      *
@@ -245,6 +245,39 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
 }
 
+TEST_F(IPATest, BatchVerify)
+{
+    // Proofs for polynomials of different sizes, including a zero polynomial
+    const std::vector<size_t> sizes{ n, small_n, n, 2, small_n };
+    std::vector<OpeningClaim<Curve>> opening_claims;
+    std::vector<HonkProof> proofs;
+    for (size_t i = 0; i < sizes.size(); i++) {
+        auto poly = i == 1 ? Polynomial(sizes[i]) : Polynomial::random(sizes[i]);
+        auto [x, eval] = this->random_eval(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        opening_claims.push_back({ opening_pair, ck.commit(poly) });
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        PCS::compute_opening_proof(ck, { poly, opening_pair }, prover_transcript);
+        proofs.push_back(prover_transcript->export_proof());
+    }
+
+    auto batch_verify = [&](const std::vector<OpeningClaim<Curve>>& claims) {
+        std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts;
+        for (const auto& proof : proofs) {
+            verifier_transcripts.emplace_back(std::make_shared<NativeTranscript>());
+            verifier_transcripts.back()->load_proof(proof);
+        }
+        return PCS::batch_reduce_verify<NativeTranscript>(vk, claims, verifier_transcripts);
+    };
+    EXPECT_EQ(batch_verify(opening_claims), std::vector<bool>(sizes.size(), true));
+
+    // Wrong evaluations are reported for exactly the claims they belong to
+    auto bad_claims = opening_claims;
+    bad_claims[2].opening_pair.evaluation += Fr::one();
+    bad_claims[4].opening_pair.evaluation += Fr::one();
+    EXPECT_EQ(batch_verify(bad_claims), std::vector<bool>({ true, true, false, true, false }));
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     // Generate multilinear polynomials, their commitments (genuine and mocked) and evaluations (genuine) at a random
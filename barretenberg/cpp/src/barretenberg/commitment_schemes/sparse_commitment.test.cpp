@@ -178,6 +178,40 @@ TYPED_TEST(CommitmentKeyTest, CommitSRSCheck)
     EXPECT_EQ(commit_result, full_commit_result);
 }
 
+// Check that batch_commit agrees with committing to each polynomial individually, including for polynomials with
+// different start indices and sizes and for empty polynomials
+TYPED_TEST(CommitmentKeyTest, BatchCommit)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 4096;
+    // (start index, number of nonzero coefficients) of each polynomial
+    std::vector<std::pair<size_t, size_t>> shapes = {
+        { 0, 4096 }, { 1, 1000 }, { 1402, 1392 }, { 0, 0 }, { 4000, 96 }
+    };
+
+    std::vector<Polynomial> polynomials;
+    for (auto [start_index, num_nonzero] : shapes) {
+        Polynomial poly{ num_nonzero, num_points, start_index };
+        for (size_t i = start_index; i < start_index + num_nonzero; ++i) {
+            poly.at(i) = Fr::random_element();
+        }
+        polynomials.push_back(std::move(poly));
+    }
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    std::vector<G1> batch_commit_result = key.batch_commit(RefVector(polynomials));
+
+    ASSERT_EQ(batch_commit_result.size(), polynomials.size());
+    for (size_t i = 0; i < polynomials.size(); ++i) {
+        EXPECT_EQ(batch_commit_result[i], key.commit(polynomials[i]));
+    }
+}
+
 /**
  * @brief Test commit_structured on polynomial with blocks of non-zero values (like wires when using structured trace)
  *
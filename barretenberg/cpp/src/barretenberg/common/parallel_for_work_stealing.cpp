@@ -0,0 +1,304 @@
+#ifndef NO_MULTITHREADING
+#include "log.hpp"
+#include "thread.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "barretenberg/common/compiler_hints.hpp"
+
+namespace {
+
+/**
+ * @brief Completion state shared by all tasks forked from a single parallel_for / parallel_invoke call.
+ */
+struct JoinState {
+    std::atomic<size_t> pending = 0;
+#ifndef BB_NO_EXCEPTIONS
+    std::mutex exception_mutex;
+    std::exception_ptr exception;
+#endif
+};
+
+struct Task {
+    std::function<void()> func;
+    JoinState* join_state = nullptr;
+};
+
+/**
+ * @brief A per-thread task deque. The owner pushes and pops at the back (LIFO keeps its working set hot), thieves
+ * take from the front, where recursively split ranges leave the largest remaining pieces of work.
+ */
+class TaskDeque {
+  public:
+    void push(Task&& task)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+    }
+
+    std::optional<Task> pop()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (tasks_.empty()) {
+            return std::nullopt;
+        }
+        Task task = std::move(tasks_.back());
+        tasks_.pop_back();
+        return task;
+    }
+
+    std::optional<Task> steal()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (tasks_.empty()) {
+            return std::nullopt;
+        }
+        Task task = std::move(tasks_.front());
+        tasks_.pop_front();
+        return task;
+    }
+
+  private:
+    std::mutex mutex_;
+    std::deque<Task> tasks_;
+};
+
+class WorkStealingPool {
+  public:
+    WorkStealingPool(size_t num_threads);
+    WorkStealingPool(const WorkStealingPool& other) = delete;
+    WorkStealingPool(WorkStealingPool&& other) = delete;
+    ~WorkStealingPool();
+
+    WorkStealingPool& operator=(const WorkStealingPool& other) = delete;
+    WorkStealingPool& operator=(WorkStealingPool&& other) = delete;
+
+    /**
+     * @brief Make a task available to the pool. The caller must have accounted for it in `join_state->pending`.
+     */
+    void fork(Task&& task)
+    {
+        deques_[current_deque_index()].push(std::move(task));
+        epoch_.fetch_add(1);
+        if (num_sleeping_.load() > 0) {
+            // Taking the lock guarantees a thread that decided to sleep is already waiting when we notify
+            {
+                std::unique_lock<std::mutex> lock(sleep_mutex_);
+            }
+            sleep_condition_.notify_one();
+        }
+    }
+
+    /**
+     * @brief Execute (our own or stolen) tasks until every task of `join_state` has completed.
+     * @details Helping rather than blocking is what makes nested calls safe: a job that forks and joins never holds a
+     * thread hostage while its children wait in a queue. When there is nothing left to help with, the remaining tasks
+     * are running on other threads and we sleep until one of them completes the join or forks more work.
+     */
+    void join(JoinState& join_state)
+    {
+        while (join_state.pending.load() != 0) {
+            // As in worker_loop, a fork after this point bumps the epoch and a completion is notified under the lock
+            const size_t observed_epoch = epoch_.load();
+            std::optional<Task> task = find_task(current_deque_index());
+            if (task.has_value()) {
+                execute(*task);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            num_sleeping_.fetch_add(1);
+            sleep_condition_.wait(lock,
+                                  [&] { return join_state.pending.load() == 0 || epoch_.load() != observed_epoch; });
+            num_sleeping_.fetch_sub(1);
+        }
+    }
+
+    void execute(Task& task)
+    {
+        JoinState* join_state = task.join_state;
+#ifndef BB_NO_EXCEPTIONS
+        try {
+            task.func();
+        } catch (...) {
+            std::unique_lock<std::mutex> lock(join_state->exception_mutex);
+            if (!join_state->exception) {
+                join_state->exception = std::current_exception();
+            }
+        }
+#else
+        task.func();
+#endif
+        if (join_state->pending.fetch_sub(1) == 1 && num_sleeping_.load() > 0) {
+            // The thread joining these tasks may be asleep. Sleeping workers recheck their condition and go back to
+            // sleep.
+            {
+                std::unique_lock<std::mutex> lock(sleep_mutex_);
+            }
+            sleep_condition_.notify_all();
+        }
+    }
+
+  private:
+    // One deque per worker, plus a shared deque (the last one) for threads that are not part of the pool
+    std::vector<TaskDeque> deques_;
+    std::vector<std::thread> workers_;
+    std::atomic<size_t> epoch_ = 0;
+    std::atomic<size_t> num_sleeping_ = 0;
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_condition_;
+    bool stop_ = false;
+
+    static inline thread_local size_t worker_index_ = static_cast<size_t>(-1);
+
+    size_t current_deque_index() const
+    {
+        return worker_index_ < workers_.size() ? worker_index_ : deques_.size() - 1;
+    }
+
+    std::optional<Task> find_task(size_t deque_index)
+    {
+        std::optional<Task> task = deques_[deque_index].pop();
+        for (size_t i = 1; i < deques_.size() && !task.has_value(); ++i) {
+            task = deques_[(deque_index + i) % deques_.size()].steal();
+        }
+        return task;
+    }
+
+    BB_NO_PROFILE void worker_loop(size_t thread_index);
+};
+
+WorkStealingPool::WorkStealingPool(size_t num_threads)
+    : deques_(num_threads + 1)
+{
+    workers_.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        workers_.emplace_back(&WorkStealingPool::worker_loop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        stop_ = true;
+    }
+    sleep_condition_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::worker_loop(size_t thread_index)
+{
+    worker_index_ = thread_index;
+    while (true) {
+        // Any fork after this point bumps the epoch, so we cannot miss a task by going to sleep below
+        const size_t observed_epoch = epoch_.load();
+        std::optional<Task> task = find_task(thread_index);
+        if (task.has_value()) {
+            execute(*task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        num_sleeping_.fetch_add(1);
+        sleep_condition_.wait(lock, [&] { return stop_ || epoch_.load() != observed_epoch; });
+        num_sleeping_.fetch_sub(1);
+        if (stop_) {
+            break;
+        }
+    }
+}
+
+WorkStealingPool& get_pool()
+{
+    static WorkStealingPool pool(bb::get_num_cpus() - 1);
+    return pool;
+}
+
+/**
+ * @brief Run `func` on [start, end), forking the upper half of the range until it is no larger than `grain_size`.
+ */
+void run_range(WorkStealingPool& pool,
+               size_t start,
+               size_t end,
+               size_t grain_size,
+               const std::function<void(size_t)>& func,
+               JoinState& join_state)
+{
+    while (end - start > grain_size) {
+        const size_t mid = start + ((end - start) / 2);
+        join_state.pending.fetch_add(1, std::memory_order_relaxed);
+        auto upper_half = [&pool, mid, end, grain_size, &func, &join_state] {
+            run_range(pool, mid, end, grain_size, func, join_state);
+        };
+        pool.fork(Task{ upper_half, &join_state });
+        end = mid;
+    }
+    for (size_t i = start; i < end; ++i) {
+        func(i);
+    }
+}
+
+/**
+ * @brief Run `func` on the calling thread, join the tasks of `join_state` and propagate the first exception thrown.
+ */
+void run_and_join(WorkStealingPool& pool, JoinState& join_state, const std::function<void()>& func)
+{
+    // The caller's own share is tracked like any other task, so it is joined even if it throws
+    join_state.pending.fetch_add(1, std::memory_order_relaxed);
+    Task own_share{ func, &join_state };
+    pool.execute(own_share);
+    pool.join(join_state);
+#ifndef BB_NO_EXCEPTIONS
+    if (join_state.exception) {
+        std::rethrow_exception(join_state.exception);
+    }
+#endif
+}
+} // namespace
+
+namespace bb {
+/**
+ * A work-stealing strategy. Every worker owns a task deque; the iteration range is recursively halved, with one half
+ * pushed as a task that idle threads can steal. A thread waiting for its tasks to complete executes queued tasks
+ * instead of blocking, so (unlike the other strategies) parallel_for may be nested inside a parallel_for job. The
+ * calling thread participates as a worker.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    if (num_iterations == 0) {
+        return;
+    }
+    WorkStealingPool& pool = get_pool();
+    // Split finely enough that stolen work balances uneven iterations, but not so finely that task overhead shows
+    constexpr size_t TASKS_PER_THREAD = 4;
+    const size_t grain_size = std::max(num_iterations / (get_num_cpus() * TASKS_PER_THREAD), static_cast<size_t>(1));
+    JoinState join_state;
+    run_and_join(pool, join_state, [&] { run_range(pool, 0, num_iterations, grain_size, func, join_state); });
+}
+
+/**
+ * Fork/join over a set of independent jobs using the work-stealing pool. The first job runs on the calling thread.
+ */
+void parallel_invoke_work_stealing(const std::vector<std::function<void()>>& jobs)
+{
+    if (jobs.empty()) {
+        return;
+    }
+    WorkStealingPool& pool = get_pool();
+    JoinState join_state;
+    for (size_t i = 1; i < jobs.size(); ++i) {
+        join_state.pending.fetch_add(1, std::memory_order_relaxed);
+        pool.fork(Task{ jobs[i], &join_state });
+    }
+    run_and_join(pool, join_state, jobs[0]);
+}
+} // namespace bb
+#endif
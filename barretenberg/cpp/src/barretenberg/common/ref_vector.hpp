@@ -97,7 +97,7 @@ template <typename T> class RefVector {
 
     std::size_t size() const { return storage.size(); }
 
-    void push_back(T& element) { storage.push_back(element); }
+    void push_back(T& element) { storage.push_back(&element); }
     iterator begin() const { return iterator(this, 0); }
     iterator end() const { return iterator(this, storage.size()); }
 
@@ -34,6 +34,11 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: None of the above support nesting, which forced callers with independent jobs that themselves use
+ * parallel_for (polynomial construction, commitments, trace generation) to run them serially. "work_stealing" keeps
+ * per-thread task deques and has waiting threads execute queued tasks, so parallel_for and parallel_invoke can be
+ * nested freely without oversubscribing the machine. Defaulting to work_stealing.
  */
 
 namespace bb {
@@ -69,6 +74,9 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_invoke_work_stealing(const std::vector<std::function<void()>>& jobs);
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -82,12 +90,24 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
     // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
+    // parallel_for_mutex_pool(num_iterations, func);
     // parallel_for_queued(num_iterations, func);
+    parallel_for_work_stealing(num_iterations, func);
 #endif
 #endif
 }
 
+void parallel_invoke(const std::vector<std::function<void()>>& jobs)
+{
+#if defined(NO_MULTITHREADING) || defined(OMP_MULTITHREADING)
+    for (const auto& job : jobs) {
+        job();
+    }
+#else
+    parallel_invoke_work_stealing(jobs);
+#endif
+}
+
 /**
  * @brief Split a loop into several loops running in parallel
  *
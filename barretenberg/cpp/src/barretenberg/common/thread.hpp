@@ -28,6 +28,13 @@ inline size_t get_num_cpus_pow2()
  * The size will be chosen based on the hardware concurrency (i.e., env or cpus).
  */
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
+
+/**
+ * @brief Fork/join: run independent jobs, potentially in parallel, and return once all of them have completed.
+ * @details Both this and parallel_for may be called from within a job; nested work is picked up by idle threads of the
+ * same pool rather than serialized or run on extra threads. The first exception thrown by a job is rethrown here.
+ */
+void parallel_invoke(const std::vector<std::function<void()>>& jobs);
 void parallel_for_range(size_t num_points,
                         const std::function<void(size_t, size_t)>& func,
                         size_t no_multhreading_if_less_or_equal = 0);
@@ -0,0 +1,106 @@
+#include "thread.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace bb;
+
+TEST(Thread, ParallelForRunsEveryIterationOnce)
+{
+    constexpr size_t NUM_ITERATIONS = 10000;
+    std::vector<std::atomic<size_t>> counts(NUM_ITERATIONS);
+    parallel_for(NUM_ITERATIONS, [&](size_t i) { counts[i].fetch_add(1); });
+    for (auto& count : counts) {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+TEST(Thread, NestedParallelFor)
+{
+    constexpr size_t NUM_OUTER = 16;
+    constexpr size_t NUM_INNER = 1000;
+    std::vector<std::atomic<size_t>> counts(NUM_OUTER * NUM_INNER);
+    parallel_for(NUM_OUTER, [&](size_t i) {
+        parallel_for(NUM_INNER, [&](size_t j) {
+            // Nest a third level in some of the iterations, so that the tasks are uneven
+            if (j % 100 == 0) {
+                parallel_for(4, [](size_t) {});
+            }
+            counts[(i * NUM_INNER) + j].fetch_add(1);
+        });
+    });
+    for (auto& count : counts) {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+TEST(Thread, ParallelInvokeRunsEveryJob)
+{
+    std::vector<std::atomic<size_t>> counts(8);
+    std::vector<std::function<void()>> jobs;
+    for (size_t i = 0; i < counts.size(); ++i) {
+        jobs.emplace_back([&counts, i] {
+            // A nested parallel_for and a slow job, whose completion has to wake a joining thread
+            parallel_for(100, [&](size_t) { counts[i].fetch_add(1); });
+            if (i == counts.size() - 1) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            }
+        });
+    }
+    parallel_invoke(jobs);
+    for (auto& count : counts) {
+        EXPECT_EQ(count.load(), 100);
+    }
+    // No jobs is a no-op
+    parallel_invoke({});
+}
+
+// The serial and OpenMP backends do not run the remaining iterations of a failed call
+#if !defined(BB_NO_EXCEPTIONS) && !defined(NO_MULTITHREADING) && !defined(OMP_MULTITHREADING)
+TEST(Thread, ParallelForPropagatesExceptions)
+{
+    std::atomic<size_t> num_completed = 0;
+    EXPECT_THROW(parallel_for(1000,
+                              [&](size_t i) {
+                                  if (i == 517) {
+                                      throw std::runtime_error("iteration failed");
+                                  }
+                                  num_completed.fetch_add(1);
+                              }),
+                 std::runtime_error);
+    // The call only returns once all of its tasks are done, none of them is still running
+    const size_t num_completed_on_return = num_completed.load();
+    EXPECT_LT(num_completed_on_return, 1000);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(num_completed.load(), num_completed_on_return);
+
+    // From a nested call, and the pool is still usable afterwards
+    EXPECT_THROW(parallel_for(8,
+                              [](size_t i) {
+                                  parallel_for(100, [i](size_t j) {
+                                      if (i == 3 && j == 42) {
+                                          throw std::runtime_error("nested iteration failed");
+                                      }
+                                  });
+                              }),
+                 std::runtime_error);
+    std::atomic<size_t> count = 0;
+    parallel_for(100, [&](size_t) { count.fetch_add(1); });
+    EXPECT_EQ(count.load(), 100);
+}
+
+TEST(Thread, ParallelInvokePropagatesExceptions)
+{
+    std::atomic<size_t> num_completed = 0;
+    auto job = [&] { num_completed.fetch_add(1); };
+    auto failing_job = [] { throw std::runtime_error("job failed"); };
+    // From the job run on the calling thread and from a forked one
+    EXPECT_THROW(parallel_invoke({ failing_job, job, job }), std::runtime_error);
+    EXPECT_THROW(parallel_invoke({ job, job, failing_job }), std::runtime_error);
+    EXPECT_EQ(num_completed.load(), 4);
+}
+#endif
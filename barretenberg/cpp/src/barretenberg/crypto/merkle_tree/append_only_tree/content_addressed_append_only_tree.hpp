@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -15,11 +16,14 @@
 #include <optional>
 #include <ostream>
 #include <random>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/crypto/merkle_tree/hash_path.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
@@ -53,6 +57,7 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     using HashPathCallback = std::function<void(TypedResponse<GetSiblingPathResponse>&)>;
     using FindLeafCallback = std::function<void(TypedResponse<FindLeafIndexResponse>&)>;
     using FindSiblingPathCallback = std::function<void(TypedResponse<FindLeafPathResponse>&)>;
+    using GetSiblingPathsCallback = std::function<void(TypedResponse<GetSiblingPathsResponse>&)>;
     using GetLeafCallback = std::function<void(TypedResponse<GetLeafResponse>&)>;
     using CommitCallback = std::function<void(TypedResponse<CommitResponse>&)>;
     using RollbackCallback = EmptyResponseCallback;
@@ -109,6 +114,30 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
                           const HashPathCallback& on_completion,
                           bool includeUncommitted) const;
 
+    /**
+     * @brief Returns the sibling paths from the leaves at the given indices to the root
+     * @details The tree is walked once for the whole batch, the nodes shared by several paths being read once and
+     * returned once
+     * @param indices The indices at which to read the sibling paths
+     * @param includeUncommitted Whether to include uncommitted changes
+     * @param on_completion Callback to be called on completion
+     */
+    void get_sibling_paths(const std::vector<index_t>& indices,
+                           bool includeUncommitted,
+                           const GetSiblingPathsCallback& on_completion) const;
+
+    /**
+     * @brief Returns the sibling paths from the leaves at the given indices to the root
+     * @param indices The indices at which to read the sibling paths
+     * @param blockNumber The block number of the tree to use as a reference
+     * @param includeUncommitted Whether to include uncommitted changes
+     * @param on_completion Callback to be called on completion
+     */
+    void get_sibling_paths(const std::vector<index_t>& indices,
+                           const block_number_t& blockNumber,
+                           bool includeUncommitted,
+                           const GetSiblingPathsCallback& on_completion) const;
+
     /**
      * @brief Get the subtree sibling path object
      *
@@ -235,6 +264,24 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
      */
     void commit(const CommitCallback& on_completion);
 
+    /**
+     * @brief Stage the uncommitted changes as the next block, to be written to the backing store by
+     * persist_staged_block. The staged block is included in the uncommitted state.
+     */
+    void stage_block(const CommitCallback& on_completion);
+
+    /**
+     * @brief Write the oldest staged block to the backing store
+     * @details Unlike the other operations, this runs on the calling thread rather than on the tree's workers. It is
+     * intended to be called from a thread dedicated to writing blocks.
+     */
+    void persist_staged_block(const CommitCallback& on_completion);
+
+    /**
+     * @brief Discard the staged blocks that have not yet been written along with the uncommitted changes
+     */
+    void discard_staged_blocks(const RollbackCallback& on_completion);
+
     /**
      * @brief Rollback the uncommitted changes
      */
@@ -279,6 +326,15 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
                                                           const RequestContext& requestContext,
                                                           ReadTransaction& tx) const;
 
+    SiblingPathsBatch get_sibling_paths_internal(const std::vector<index_t>& leaf_indices,
+                                                 const RequestContext& requestContext,
+                                                 ReadTransaction& tx) const;
+
+    void find_leaf_sibling_paths_internal(const std::vector<typename Store::LeafType>& leaves,
+                                          const RequestContext& requestContext,
+                                          ReadTransaction& tx,
+                                          FindLeafPathResponse& response) const;
+
     std::optional<fr> find_leaf_hash(const index_t& leaf_index,
                                      const RequestContext& requestContext,
                                      ReadTransaction& tx,
@@ -289,6 +345,8 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     void add_batch_internal(
         std::vector<fr>& values, fr& new_root, index_t& new_size, bool update_index, ReadTransaction& tx);
 
+    static void hash_level(std::span<const fr> children, std::span<fr> parents);
+
     std::unique_ptr<Store> store_;
     uint32_t depth_;
     uint64_t max_size_;
@@ -438,6 +496,55 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_path(cons
     workers_->enqueue(job);
 }
 
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths(
+    const std::vector<index_t>& indices, bool includeUncommitted, const GetSiblingPathsCallback& on_completion) const
+{
+    auto job = [=, this]() {
+        execute_and_report<GetSiblingPathsResponse>(
+            [=, this](TypedResponse<GetSiblingPathsResponse>& response) {
+                ReadTransactionPtr tx = store_->create_read_transaction();
+                RequestContext requestContext;
+                requestContext.includeUncommitted = includeUncommitted;
+                requestContext.root = store_->get_current_root(*tx, includeUncommitted);
+                response.inner.paths = get_sibling_paths_internal(indices, requestContext, *tx);
+            },
+            on_completion);
+    };
+    workers_->enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths(
+    const std::vector<index_t>& indices,
+    const block_number_t& blockNumber,
+    bool includeUncommitted,
+    const GetSiblingPathsCallback& on_completion) const
+{
+    auto job = [=, this]() {
+        execute_and_report<GetSiblingPathsResponse>(
+            [=, this](TypedResponse<GetSiblingPathsResponse>& response) {
+                if (blockNumber == 0) {
+                    throw std::runtime_error("Unable to get sibling paths at block 0");
+                }
+                ReadTransactionPtr tx = store_->create_read_transaction();
+                BlockPayload blockData;
+                if (!store_->get_block_data(blockNumber, blockData, *tx)) {
+                    throw std::runtime_error(
+                        format("Unable to get sibling paths at block ", blockNumber, ", failed to get block data."));
+                }
+
+                RequestContext requestContext;
+                requestContext.blockNumber = blockNumber;
+                requestContext.includeUncommitted = includeUncommitted;
+                requestContext.root = blockData.root;
+                response.inner.paths = get_sibling_paths_internal(indices, requestContext, *tx);
+            },
+            on_completion);
+    };
+    workers_->enqueue(job);
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_block_numbers(
     const std::vector<index_t>& indices, const GetBlockForIndexCallback& on_completion) const
@@ -565,7 +672,7 @@ std::optional<fr> ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_lea
 
         // Extract the node data
         NodePayload nodePayload;
-        bool success = store_->get_node_by_hash(hash, nodePayload, tx, requestContext.includeUncommitted);
+        bool success = store_->get_node_by_hash(hash, nodePayload, tx, requestContext.includeUncommitted, i);
         if (!success) {
             // std::cout << "No root " << hash << std::endl;
             return std::nullopt;
@@ -645,7 +752,7 @@ ContentAddressedAppendOnlyTree<Store, HashingPolicy>::OptionalSiblingPath Conten
 
     for (uint32_t level = 0; level < depth_ - subtree_depth; ++level) {
         NodePayload nodePayload;
-        store_->get_node_by_hash(hash, nodePayload, tx, requestContext.includeUncommitted);
+        store_->get_node_by_hash(hash, nodePayload, tx, requestContext.includeUncommitted, level);
         bool is_right = static_cast<bool>(leaf_index & mask);
         // std::cout << "Level: " << level << ", mask: " << mask << ", is right: " << is_right << ", parent: " << hash
         //           << ", left has value: " << nodePayload.left.has_value()
@@ -668,6 +775,93 @@ ContentAddressedAppendOnlyTree<Store, HashingPolicy>::OptionalSiblingPath Conten
     return path;
 }
 
+template <typename Store, typename HashingPolicy>
+SiblingPathsBatch ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths_internal(
+    const std::vector<index_t>& leaf_indices, const RequestContext& requestContext, ReadTransaction& tx) const
+{
+    SiblingPathsBatch batch;
+    if (leaf_indices.empty() || depth_ == 0) {
+        batch.paths.resize(leaf_indices.size());
+        return batch;
+    }
+
+    // The paths are computed for the distinct indices in order, the leaves below any node then being a contiguous range
+    std::vector<index_t> sorted(leaf_indices);
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    std::vector<std::vector<uint32_t>> sortedPaths(sorted.size(), std::vector<uint32_t>(depth_));
+
+    std::unordered_map<fr, uint32_t> nodePositions;
+    auto add_node = [&](const fr& node) {
+        auto [it, inserted] = nodePositions.try_emplace(node, static_cast<uint32_t>(batch.nodes.size()));
+        if (inserted) {
+            batch.nodes.push_back(node);
+        }
+        return it->second;
+    };
+
+    // A node to visit, with the range of leaves below it. A node without a value is the root of an empty subtree.
+    struct Visit {
+        std::optional<fr> hash;
+        uint32_t level;
+        size_t begin;
+        size_t end;
+    };
+    std::vector<Visit> toVisit{ { requestContext.root, 0, 0, sorted.size() } };
+    while (!toVisit.empty()) {
+        Visit visit = toVisit.back();
+        toVisit.pop_back();
+
+        // Below an empty subtree every sibling is the root of an empty subtree
+        if (!visit.hash.has_value()) {
+            for (uint32_t level = visit.level; level < depth_; ++level) {
+                uint32_t sibling = add_node(zero_hashes_[level + 1]);
+                for (size_t i = visit.begin; i < visit.end; ++i) {
+                    sortedPaths[i][depth_ - 1 - level] = sibling;
+                }
+            }
+            continue;
+        }
+
+        NodePayload nodePayload;
+        store_->get_node_by_hash(visit.hash.value(), nodePayload, tx, requestContext.includeUncommitted, visit.level);
+
+        // The leaves going left are those before the first one going right
+        index_t mask = index_t(1) << (depth_ - 1 - visit.level);
+        size_t split = static_cast<size_t>(
+            std::partition_point(sorted.begin() + static_cast<std::ptrdiff_t>(visit.begin),
+                                 sorted.begin() + static_cast<std::ptrdiff_t>(visit.end),
+                                 [mask](index_t index) { return (index & mask) == 0; }) -
+            sorted.begin());
+        bool has_children = visit.level + 1 < depth_;
+
+        auto add_branch = [&](const std::optional<fr>& child,
+                              const std::optional<fr>& sibling,
+                              size_t begin,
+                              size_t end) {
+            if (begin == end) {
+                return;
+            }
+            uint32_t siblingPosition = add_node(sibling.has_value() ? sibling.value() : zero_hashes_[visit.level + 1]);
+            for (size_t i = begin; i < end; ++i) {
+                sortedPaths[i][depth_ - 1 - visit.level] = siblingPosition;
+            }
+            if (has_children) {
+                toVisit.push_back({ child, visit.level + 1, begin, end });
+            }
+        };
+        add_branch(nodePayload.left, nodePayload.right, visit.begin, split);
+        add_branch(nodePayload.right, nodePayload.left, split, visit.end);
+    }
+
+    batch.paths.reserve(leaf_indices.size());
+    for (const index_t& index : leaf_indices) {
+        auto it = std::lower_bound(sorted.begin(), sorted.end(), index);
+        batch.paths.push_back(sortedPaths[static_cast<size_t>(it - sorted.begin())]);
+    }
+    return batch;
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_leaf(const index_t& leaf_index,
                                                                     bool includeUncommitted,
@@ -844,19 +1038,7 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_sibling_pat
                 requestContext.includeUncommitted = includeUncommitted;
                 requestContext.root = store_->get_current_root(*tx, includeUncommitted);
 
-                for (const auto& leaf : leaves) {
-                    std::optional<index_t> leaf_index = store_->find_leaf_index_from(leaf, 0, requestContext, *tx);
-                    if (!leaf_index.has_value()) {
-                        response.inner.leaf_paths.emplace_back(std::nullopt);
-                        continue;
-                    }
-                    OptionalSiblingPath optional_path =
-                        get_subtree_sibling_path_internal(leaf_index.value(), 0, requestContext, *tx);
-                    SiblingPathAndIndex sibling_path_and_index;
-                    sibling_path_and_index.path = optional_sibling_path_to_full_sibling_path(optional_path);
-                    sibling_path_and_index.index = leaf_index.value();
-                    response.inner.leaf_paths.emplace_back(sibling_path_and_index);
-                }
+                find_leaf_sibling_paths_internal(leaves, requestContext, *tx, response.inner);
             },
             on_completion);
     };
@@ -890,25 +1072,42 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_sibling_pat
                 requestContext.maxIndex = blockData.size;
                 requestContext.root = blockData.root;
 
-                for (const auto& leaf : leaves) {
-                    std::optional<index_t> leaf_index = store_->find_leaf_index_from(leaf, 0, requestContext, *tx);
-                    if (!leaf_index.has_value()) {
-                        response.inner.leaf_paths.emplace_back(std::nullopt);
-                        continue;
-                    }
-                    OptionalSiblingPath optional_path =
-                        get_subtree_sibling_path_internal(leaf_index.value(), 0, requestContext, *tx);
-                    SiblingPathAndIndex sibling_path_and_index;
-                    sibling_path_and_index.path = optional_sibling_path_to_full_sibling_path(optional_path);
-                    sibling_path_and_index.index = leaf_index.value();
-                    response.inner.leaf_paths.emplace_back(sibling_path_and_index);
-                }
+                find_leaf_sibling_paths_internal(leaves, requestContext, *tx, response.inner);
             },
             on_completion);
     };
     workers_->enqueue(job);
 }
 
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_sibling_paths_internal(
+    const std::vector<typename Store::LeafType>& leaves,
+    const RequestContext& requestContext,
+    ReadTransaction& tx,
+    FindLeafPathResponse& response) const
+{
+    std::vector<std::optional<index_t>> leaf_indices;
+    leaf_indices.reserve(leaves.size());
+    std::vector<index_t> found_indices;
+    for (const auto& leaf : leaves) {
+        std::optional<index_t> leaf_index = store_->find_leaf_index_from(leaf, 0, requestContext, tx);
+        leaf_indices.emplace_back(leaf_index);
+        if (leaf_index.has_value()) {
+            found_indices.push_back(leaf_index.value());
+        }
+    }
+
+    SiblingPathsBatch batch = get_sibling_paths_internal(found_indices, requestContext, tx);
+    size_t next_path = 0;
+    for (const auto& leaf_index : leaf_indices) {
+        if (!leaf_index.has_value()) {
+            response.leaf_paths.emplace_back(std::nullopt);
+            continue;
+        }
+        response.leaf_paths.emplace_back(SiblingPathAndIndex(leaf_index.value(), batch.get_path(next_path++)));
+    }
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_value(const fr& value,
                                                                      const AppendCompletionCallback& on_completion)
@@ -951,6 +1150,36 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::commit(const CommitCa
     workers_->enqueue(job);
 }
 
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::stage_block(const CommitCallback& on_completion)
+{
+    auto job = [=, this]() {
+        execute_and_report<CommitResponse>(
+            [=, this](TypedResponse<CommitResponse>& response) {
+                store_->stage_block(response.inner.meta, response.inner.stats);
+            },
+            on_completion);
+    };
+    workers_->enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::persist_staged_block(const CommitCallback& on_completion)
+{
+    execute_and_report<CommitResponse>(
+        [=, this](TypedResponse<CommitResponse>& response) {
+            store_->persist_staged_block(response.inner.meta, response.inner.stats);
+        },
+        on_completion);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::discard_staged_blocks(const RollbackCallback& on_completion)
+{
+    auto job = [=, this]() { execute_and_report([=, this]() { store_->discard_staged_blocks(); }, on_completion); };
+    workers_->enqueue(job);
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::rollback(const RollbackCallback& on_completion)
 {
@@ -1096,6 +1325,24 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_values_internal(s
     }
 }
 
+/**
+ * @brief Hash consecutive pairs of `children` into `parents`, splitting the level across threads when it is large
+ * @details Levels below a few dozen pairs are not worth the hand-off to other threads and are hashed on the caller's.
+ */
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::hash_level(std::span<const fr> children,
+                                                                      std::span<fr> parents)
+{
+    constexpr size_t MIN_PAIRS_TO_PARALLELISE = 64;
+    parallel_for_range(
+        parents.size(),
+        [&](size_t start, size_t end) {
+            HashingPolicy::hash_pairs(children.subspan(2 * start, 2 * (end - start)),
+                                      parents.subspan(start, end - start));
+        },
+        MIN_PAIRS_TO_PARALLELISE);
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
     std::vector<fr>& values, fr& new_root, index_t& new_size, bool update_index, ReadTransaction& tx)
@@ -1140,22 +1387,21 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
         }
     }
 
-    // Hash the values as a sub tree and insert them
+    // Hash the values as a sub tree and insert them. Every level is hashed as one batch into a buffer of its own,
+    // then its nodes are written to the store from this thread
+    std::vector<fr> parents(number_to_insert / 2);
     while (number_to_insert > 1) {
         number_to_insert >>= 1;
         index >>= 1;
         --level;
-        // std::cout << "To INSERT " << number_to_insert << std::endl;
+        hash_level(std::span<const fr>(hashes_local.data(), 2 * size_t(number_to_insert)),
+                   std::span<fr>(parents.data(), number_to_insert));
         for (uint32_t i = 0; i < number_to_insert; ++i) {
-            fr left = hashes_local[i * 2];
-            fr right = hashes_local[i * 2 + 1];
-            hashes_local[i] = HashingPolicy::hash_pair(left, right);
-            // std::cout << "Left: " << left << ", right: " << right << ", parent: " << hashes_local[i] << std::endl;
-            store_->put_node_by_hash(hashes_local[i], { .left = left, .right = right, .ref = 1 });
-            store_->put_cached_node_by_index(level, index + i, hashes_local[i]);
-            // std::cout << "Writing node hash " << hashes_local[i] << " level " << level << " index " << index + i
-            //           << std::endl;
+            store_->put_node_by_hash(parents[i],
+                                     { .left = hashes_local[i * 2], .right = hashes_local[i * 2 + 1], .ref = 1 });
+            store_->put_cached_node_by_index(level, index + i, parents[i]);
         }
+        std::copy_n(parents.begin(), number_to_insert, hashes_local.begin());
     }
 
     fr new_hash = hashes_local[0];
@@ -1153,6 +1153,201 @@ TEST_F(PersistedContentAddressedAppendOnlyTreeTest, returns_sibling_path)
     }
 }
 
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, returns_batched_sibling_paths)
+{
+    constexpr size_t depth = 10;
+    std::string name = random_string();
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    ThreadPoolPtr pool = make_thread_pool(1);
+    TreeType tree(std::move(store), pool);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    std::vector<fr> values = create_values(40);
+    add_values(tree, std::vector<fr>(values.begin(), values.begin() + 20));
+    commit_tree(tree);
+    add_values(tree, std::vector<fr>(values.begin() + 20, values.end()));
+    for (size_t i = 0; i < values.size(); ++i) {
+        memdb.update_element(i, values[i]);
+    }
+
+    // Unsorted, with a duplicate and indices beyond the filled part of the tree
+    std::vector<index_t> indices = { 5, 0, 39, 5, 21, 100, 1023, 4 };
+    auto check_paths = [&](const SiblingPathsBatch& batch, MemoryTree<Poseidon2HashPolicy>& expected) {
+        EXPECT_EQ(batch.paths.size(), indices.size());
+        for (size_t i = 0; i < indices.size(); ++i) {
+            EXPECT_EQ(batch.get_path(i), expected.get_sibling_path(indices[i]));
+        }
+        // The nodes near the root and the empty subtrees are shared by several paths
+        EXPECT_LT(batch.nodes.size(), indices.size() * depth);
+    };
+
+    {
+        Signal signal;
+        tree.get_sibling_paths(indices, true, [&](const TypedResponse<GetSiblingPathsResponse>& response) {
+            EXPECT_TRUE(response.success);
+            check_paths(response.inner.paths, memdb);
+            signal.signal_level();
+        });
+        signal.wait_for_level();
+    }
+
+    // The paths at block 1 only include the first 20 values
+    MemoryTree<Poseidon2HashPolicy> block1(depth);
+    for (size_t i = 0; i < 20; ++i) {
+        block1.update_element(i, values[i]);
+    }
+    {
+        Signal signal;
+        tree.get_sibling_paths(indices, 1, false, [&](const TypedResponse<GetSiblingPathsResponse>& response) {
+            EXPECT_TRUE(response.success);
+            check_paths(response.inner.paths, block1);
+            signal.signal_level();
+        });
+        signal.wait_for_level();
+    }
+
+    // Finding the paths of leaves by value shares the walk
+    check_sibling_path_by_value(tree, values[21], memdb.get_sibling_path(21), 21);
+}
+
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, pins_upper_levels_shared_across_forks)
+{
+    constexpr size_t depth = 10;
+    constexpr uint32_t pinned_levels = 4;
+    std::string name = random_string();
+    ThreadPoolPtr pool = make_thread_pool(1);
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    PinnedNodeCache& pinnedNodes = db->get_pinned_node_cache();
+    pinnedNodes.set_levels(pinned_levels);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    TreeType tree(std::move(store), pool);
+
+    std::vector<fr> values{ 30, 10, 20, 40, 15, 18 };
+    add_values(tree, values);
+    for (size_t i = 0; i < values.size(); ++i) {
+        memdb.update_element(i, values[i]);
+    }
+    // Uncommitted nodes are not pinned
+    check_sibling_path(tree, 3, memdb.get_sibling_path(3));
+    EXPECT_EQ(pinnedNodes.size(), 0);
+
+    commit_tree(tree);
+    fr_sibling_path block1Path = memdb.get_sibling_path(3);
+    check_sibling_path(tree, 3, block1Path, false);
+    EXPECT_EQ(pinnedNodes.size(), pinned_levels);
+    check_sibling_path(tree, 3, block1Path, false);
+    check_sibling_path(tree, 5, memdb.get_sibling_path(5), false);
+
+    // A fork reads the same committed nodes
+    const size_t numPinned = pinnedNodes.size();
+    std::unique_ptr<Store> forkStore = std::make_unique<Store>(name, depth, 1, db);
+    TreeType fork(std::move(forkStore), pool);
+    check_sibling_path(fork, 3, block1Path, false);
+    check_sibling_path(fork, 5, memdb.get_sibling_path(5), false);
+    EXPECT_EQ(pinnedNodes.size(), numPinned);
+
+    // Committing a block clears the cache
+    add_values(tree, { 26, 2 });
+    memdb.update_element(6, 26);
+    memdb.update_element(7, 2);
+    commit_tree(tree);
+    EXPECT_EQ(pinnedNodes.size(), 0);
+    check_sibling_path(tree, 3, memdb.get_sibling_path(3), false);
+    check_historic_sibling_path(tree, 3, block1Path, 1);
+
+    // As does unwinding one, after which the paths of the previous block are served again
+    unwind_block(tree, 2);
+    EXPECT_EQ(pinnedNodes.size(), 0);
+    check_sibling_path(tree, 3, block1Path, false);
+    check_sibling_path(fork, 3, block1Path, false);
+}
+
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, filters_absent_leaf_keys)
+{
+    constexpr size_t depth = 10;
+    std::string name = random_string();
+    ThreadPoolPtr pool = make_thread_pool(1);
+    {
+        LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+        std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+        TreeType tree(std::move(store), pool);
+
+        add_values(tree, { 30, 10, 20, 40 });
+        commit_tree(tree);
+
+        // The filter is built from the keys already committed
+        db->enable_leaf_key_filter();
+        EXPECT_EQ(db->get_leaf_key_filter().get_stats().numKeys, 4);
+        check_find_leaf_index(tree, fr(10), 1, true, false);
+        for (uint64_t i = 0; i < 1000; ++i) {
+            check_find_leaf_index<fr, TreeType>(tree, { fr(1000 + i) }, { std::nullopt }, true, false);
+        }
+        LeafKeyFilterStats stats = db->get_leaf_key_filter().get_stats();
+        EXPECT_EQ(stats.lookups, 1001);
+        EXPECT_EQ(stats.negatives + stats.falsePositives, 1000);
+        EXPECT_LT(stats.falsePositives, 20);
+
+        // Keys are added as blocks are committed, and seen by forks
+        add_values(tree, { 15, 18 });
+        commit_tree(tree);
+        check_find_leaf_index(tree, fr(18), 5, true, false);
+        {
+            std::unique_ptr<Store> forkStore = std::make_unique<Store>(name, depth, 2, db);
+            TreeType fork(std::move(forkStore), pool);
+            check_find_leaf_index(fork, fr(18), 5, true, false);
+        }
+
+        // Unwinding a block leaves its keys in the filter, which is only marked stale
+        unwind_block(tree, 2);
+        stats = db->get_leaf_key_filter().get_stats();
+        EXPECT_EQ(stats.rebuilds, 0);
+        EXPECT_EQ(stats.numKeys, 6);
+        EXPECT_TRUE(stats.stale);
+        check_find_leaf_index<fr, TreeType>(tree, { fr(18) }, { std::nullopt }, true, false);
+
+        // Committing a block does not rebuild a stale filter, the rebuild after the last unwind does
+        db->rebuild_leaf_key_filter_if_needed(false);
+        EXPECT_EQ(db->get_leaf_key_filter().get_stats().rebuilds, 0);
+        db->rebuild_leaf_key_filter_if_needed(true);
+        stats = db->get_leaf_key_filter().get_stats();
+        EXPECT_EQ(stats.rebuilds, 1);
+        EXPECT_EQ(stats.numKeys, 4);
+        EXPECT_FALSE(stats.stale);
+        check_find_leaf_index<fr, TreeType>(tree, { fr(18) }, { std::nullopt }, true, false);
+        check_find_leaf_index(tree, fr(10), 1, true, false);
+
+        add_values(tree, { 50 });
+        commit_tree(tree);
+    }
+    {
+        // The filter saved at the committed block is loaded back
+        LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+        std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+        TreeType tree(std::move(store), pool);
+        db->enable_leaf_key_filter();
+        EXPECT_EQ(db->get_leaf_key_filter().get_stats().numKeys, 5);
+        check_find_leaf_index(tree, fr(50), 4, true, false);
+
+        // Commit a block without the filter, leaving the saved one behind the tree
+        db->disable_leaf_key_filter();
+        add_values(tree, { 60 });
+        commit_tree(tree);
+    }
+    {
+        // A filter saved at an earlier block is not used, it is built again from the store
+        LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+        std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+        TreeType tree(std::move(store), pool);
+        db->enable_leaf_key_filter();
+        EXPECT_EQ(db->get_leaf_key_filter().get_stats().numKeys, 6);
+        check_find_leaf_index(tree, fr(60), 5, true, false);
+        check_find_leaf_index<fr, TreeType>(tree, { fr(18) }, { std::nullopt }, true, false);
+    }
+}
+
 TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_create_images_at_historic_blocks)
 {
     constexpr size_t depth = 5;
@@ -0,0 +1,187 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <stdexcept>
+
+namespace bb::crypto::merkle_tree::fixed_width {
+
+/**
+ * Fixed layout binary records for the values of the nodes and leaf preimages databases.
+ *
+ * A record is the marker byte, the version of the layout and the fields of the value at fixed offsets. Field
+ * elements are stored as their 4 limbs in Montgomery form, exactly as they are held in memory, and integers in native
+ * byte order. An LMDB environment can not be moved between machines of different endianness anyway.
+ *
+ * The marker is a byte that msgpack never emits, so a value can be told apart from one written in msgpack by the
+ * earlier versions of the store.
+ */
+constexpr uint8_t RECORD_MARKER = 0xc1;
+constexpr uint8_t RECORD_VERSION = 1;
+constexpr size_t HEADER_SIZE = 2;
+
+inline bool is_record(std::span<const uint8_t> data)
+{
+    return !data.empty() && data[0] == RECORD_MARKER;
+}
+
+inline void check_header(std::span<const uint8_t> data)
+{
+    if (data.size() < HEADER_SIZE || data[1] != RECORD_VERSION) {
+        int version = data.size() < HEADER_SIZE ? 0 : static_cast<int>(data[1]);
+        throw std::runtime_error(format("Unsupported fixed width record version ", version));
+    }
+}
+
+// Codec<T> has a size, a write and a read for each type with a fixed width layout
+template <typename T> struct Codec {};
+
+template <typename T> concept HasCodec = requires(uint8_t* out, const uint8_t* in, T& value) {
+    { Codec<T>::size } -> std::convertible_to<size_t>;
+    Codec<T>::write(out, value);
+    Codec<T>::read(in, value);
+};
+
+template <> struct Codec<fr> {
+    static constexpr size_t size = sizeof(fr::data);
+    static void write(uint8_t* out, const fr& value) { std::memcpy(out, &value.data[0], size); }
+    static void read(const uint8_t* in, fr& value) { std::memcpy(&value.data[0], in, size); }
+};
+
+template <> struct Codec<uint64_t> {
+    static constexpr size_t size = sizeof(uint64_t);
+    static void write(uint8_t* out, const uint64_t& value) { std::memcpy(out, &value, size); }
+    static void read(const uint8_t* in, uint64_t& value) { std::memcpy(&value, in, size); }
+};
+
+template <> struct Codec<NullifierLeafValue> {
+    static constexpr size_t size = Codec<fr>::size;
+    static void write(uint8_t* out, const NullifierLeafValue& value) { Codec<fr>::write(out, value.nullifier); }
+    static void read(const uint8_t* in, NullifierLeafValue& value) { Codec<fr>::read(in, value.nullifier); }
+};
+
+template <> struct Codec<PublicDataLeafValue> {
+    static constexpr size_t size = 2 * Codec<fr>::size;
+    static void write(uint8_t* out, const PublicDataLeafValue& value)
+    {
+        Codec<fr>::write(out, value.slot);
+        Codec<fr>::write(out + Codec<fr>::size, value.value);
+    }
+    static void read(const uint8_t* in, PublicDataLeafValue& value)
+    {
+        Codec<fr>::read(in, value.slot);
+        Codec<fr>::read(in + Codec<fr>::size, value.value);
+    }
+};
+
+template <HasCodec LeafType> struct Codec<IndexedLeaf<LeafType>> {
+    static constexpr size_t size = Codec<LeafType>::size + Codec<index_t>::size + Codec<fr>::size;
+    static void write(uint8_t* out, const IndexedLeaf<LeafType>& value)
+    {
+        Codec<LeafType>::write(out, value.leaf);
+        Codec<index_t>::write(out + Codec<LeafType>::size, value.nextIndex);
+        Codec<fr>::write(out + Codec<LeafType>::size + Codec<index_t>::size, value.nextKey);
+    }
+    static void read(const uint8_t* in, IndexedLeaf<LeafType>& value)
+    {
+        Codec<LeafType>::read(in, value.leaf);
+        Codec<index_t>::read(in + Codec<LeafType>::size, value.nextIndex);
+        Codec<fr>::read(in + Codec<LeafType>::size + Codec<index_t>::size, value.nextKey);
+    }
+};
+
+template <HasCodec T> using RecordBuffer = std::array<uint8_t, HEADER_SIZE + Codec<T>::size>;
+
+template <HasCodec T> std::span<const uint8_t> encode(const T& value, RecordBuffer<T>& buffer)
+{
+    buffer[0] = RECORD_MARKER;
+    buffer[1] = RECORD_VERSION;
+    Codec<T>::write(buffer.data() + HEADER_SIZE, value);
+    return { buffer.data(), buffer.size() };
+}
+
+template <HasCodec T> void decode(std::span<const uint8_t> data, T& value)
+{
+    check_header(data);
+    if (data.size() != HEADER_SIZE + Codec<T>::size) {
+        throw std::runtime_error(format("Invalid fixed width record size ", data.size()));
+    }
+    Codec<T>::read(data.data() + HEADER_SIZE, value);
+}
+
+/**
+ * The record of a node is followed by a byte flagging which of its children are present, its reference count and the
+ * children that are present
+ */
+constexpr uint8_t NODE_HAS_LEFT = 1;
+constexpr uint8_t NODE_HAS_RIGHT = 2;
+constexpr size_t NODE_FIXED_SIZE = HEADER_SIZE + 1 + Codec<uint64_t>::size;
+using NodeRecordBuffer = std::array<uint8_t, NODE_FIXED_SIZE + 2 * Codec<fr>::size>;
+
+inline std::span<const uint8_t> encode_node(const std::optional<fr>& left,
+                                            const std::optional<fr>& right,
+                                            uint64_t ref,
+                                            NodeRecordBuffer& buffer)
+{
+    buffer[0] = RECORD_MARKER;
+    buffer[1] = RECORD_VERSION;
+    const int hasLeft = left.has_value() ? NODE_HAS_LEFT : 0;
+    const int hasRight = right.has_value() ? NODE_HAS_RIGHT : 0;
+    buffer[2] = static_cast<uint8_t>(hasLeft | hasRight);
+    Codec<uint64_t>::write(buffer.data() + HEADER_SIZE + 1, ref);
+    size_t size = NODE_FIXED_SIZE;
+    if (left.has_value()) {
+        Codec<fr>::write(buffer.data() + size, left.value());
+        size += Codec<fr>::size;
+    }
+    if (right.has_value()) {
+        Codec<fr>::write(buffer.data() + size, right.value());
+        size += Codec<fr>::size;
+    }
+    return { buffer.data(), size };
+}
+
+inline void decode_node(std::span<const uint8_t> data,
+                        std::optional<fr>& left,
+                        std::optional<fr>& right,
+                        uint64_t& ref)
+{
+    check_header(data);
+    if (data.size() < NODE_FIXED_SIZE) {
+        throw std::runtime_error(format("Invalid fixed width node record size ", data.size()));
+    }
+    uint8_t flags = data[2];
+    size_t expected = NODE_FIXED_SIZE;
+    expected += (flags & NODE_HAS_LEFT) != 0 ? Codec<fr>::size : 0;
+    expected += (flags & NODE_HAS_RIGHT) != 0 ? Codec<fr>::size : 0;
+    if (data.size() != expected) {
+        throw std::runtime_error(format("Invalid fixed width node record size ", data.size()));
+    }
+    Codec<uint64_t>::read(data.data() + HEADER_SIZE + 1, ref);
+    size_t offset = NODE_FIXED_SIZE;
+    left = std::nullopt;
+    right = std::nullopt;
+    if ((flags & NODE_HAS_LEFT) != 0) {
+        Codec<fr>::read(data.data() + offset, left.emplace());
+        offset += Codec<fr>::size;
+    }
+    if ((flags & NODE_HAS_RIGHT) != 0) {
+        Codec<fr>::read(data.data() + offset, right.emplace());
+    }
+}
+
+} // namespace bb::crypto::merkle_tree::fixed_width
@@ -22,6 +22,7 @@
 #include <exception>
 #include <lmdb.h>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <unordered_map>
 #include <vector>
@@ -95,6 +96,15 @@ LMDBTreeStore::LMDBTreeStore(std::string directory, std::string name, uint64_t m
     }
 }
 
+LMDBTreeStore::~LMDBTreeStore()
+{
+    try {
+        save_leaf_key_filter();
+    } catch (std::exception& e) {
+        info("Failed to save leaf key filter of tree ", _name, ": ", e.what());
+    }
+}
+
 const std::string& LMDBTreeStore::get_name() const
 {
     return _name;
@@ -316,21 +326,196 @@ fr LMDBTreeStore::find_low_leaf(const fr& leafValue,
 bool LMDBTreeStore::read_node(const fr& nodeHash, NodePayload& nodeData, ReadTransaction& tx)
 {
     FrKeyType key(nodeHash);
-    std::vector<uint8_t> data;
+    std::span<const uint8_t> data;
     bool success = tx.get_value<FrKeyType>(key, data, *_nodeDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
+        decode_node_payload(data, nodeData);
     }
     return success;
 }
 
 void LMDBTreeStore::write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, nodeData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    fixed_width::NodeRecordBuffer buffer;
     FrKeyType key(nodeHash);
-    tx.put_value<FrKeyType>(key, encoded, *_nodeDatabase);
+    tx.put_value<FrKeyType>(
+        key, fixed_width::encode_node(nodeData.left, nodeData.right, nodeData.ref, buffer), *_nodeDatabase);
+}
+
+uint64_t LMDBTreeStore::migrate_database(const LMDBDatabase& db, const RecordConverter& convert, uint64_t batchSize)
+{
+    uint64_t numMigrated = 0;
+    std::optional<Key> resumeKey;
+    bool complete = false;
+    while (!complete) {
+        std::vector<std::pair<Key, Value>> batch;
+        WriteTransaction::Ptr tx = create_write_transaction();
+        MDB_cursor* cursor = nullptr;
+        call_lmdb_func("mdb_cursor_open", mdb_cursor_open, tx->underlying(), db.underlying(), &cursor);
+        try {
+            MDB_val dbKey;
+            MDB_val dbVal;
+            int code = 0;
+            if (resumeKey.has_value()) {
+                dbKey.mv_size = resumeKey->size();
+                dbKey.mv_data = (void*)resumeKey->data();
+                code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_SET_RANGE);
+            } else {
+                code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_FIRST);
+            }
+            for (uint64_t numRead = 0; code == MDB_SUCCESS && numRead < batchSize; ++numRead) {
+                std::span<const uint8_t> value(static_cast<const uint8_t*>(dbVal.mv_data), dbVal.mv_size);
+                Value encoded;
+                if (convert(value, encoded)) {
+                    batch.emplace_back(mdb_val_to_vector(dbKey), std::move(encoded));
+                }
+                code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_NEXT);
+            }
+            if (code == MDB_SUCCESS) {
+                // The batch is full, the next one starts from the value the cursor is on
+                resumeKey = mdb_val_to_vector(dbKey);
+            } else if (code == MDB_NOTFOUND) {
+                complete = true;
+            } else {
+                throw_error("migrate_database::mdb_cursor_get", code);
+            }
+        } catch (std::exception& e) {
+            call_lmdb_func(mdb_cursor_close, cursor);
+            throw;
+        }
+        call_lmdb_func(mdb_cursor_close, cursor);
+
+        // The batch was read through the cursor, it is written once the cursor is closed
+        for (auto& [key, value] : batch) {
+            tx->put_value(key, value, db);
+        }
+        tx->commit();
+        numMigrated += batch.size();
+    }
+    return numMigrated;
+}
+
+std::filesystem::path LMDBTreeStore::leaf_key_filter_path() const
+{
+    return std::filesystem::path(_dbDirectory) / (_name + "_leaf_key_filter.bin");
+}
+
+void LMDBTreeStore::enable_leaf_key_filter(double falsePositiveRate)
+{
+    std::lock_guard lock(_leafKeyFilterMtx);
+    // The write transaction is not committed, it only keeps blocks from being committed while the filter is built
+    WriteTransaction::Ptr tx = create_write_transaction();
+    try {
+        TreeMeta meta;
+        BloomFilter filter;
+        bool loaded = read_meta_data(meta, *tx) &&
+                      LeafKeyFilter::load(
+                          leaf_key_filter_path(), meta.unfinalisedBlockHeight, meta.root, falsePositiveRate, filter);
+        if (!loaded) {
+            filter = build_leaf_key_filter(falsePositiveRate, *tx);
+        }
+        _leafKeyFilter.enable(std::move(filter), falsePositiveRate);
+    } catch (std::exception& e) {
+        tx->try_abort();
+        throw std::runtime_error(format("Unable to enable leaf key filter of tree ", _name, ": ", e.what()));
+    }
+    tx->try_abort();
+}
+
+void LMDBTreeStore::disable_leaf_key_filter()
+{
+    std::lock_guard lock(_leafKeyFilterMtx);
+    _leafKeyFilter.disable();
+}
+
+void LMDBTreeStore::add_leaf_key_to_filter(const fr& leafKey)
+{
+    FrKeyType key(leafKey);
+    _leafKeyFilter.add(key);
+}
+
+bool LMDBTreeStore::leaf_key_may_exist(const fr& leafKey) const
+{
+    FrKeyType key(leafKey);
+    return _leafKeyFilter.may_contain(key);
+}
+
+void LMDBTreeStore::record_leaf_key_filter_false_positive() const
+{
+    _leafKeyFilter.record_false_positive();
+}
+
+void LMDBTreeStore::commit_leaf_keys(WriteTransaction& tx, bool keysRemoved)
+{
+    tx.commit();
+    if (keysRemoved) {
+        _leafKeyFilter.mark_stale();
+    }
+}
+
+void LMDBTreeStore::rebuild_leaf_key_filter_if_needed(bool includeRemovedKeys)
+{
+    if (!_leafKeyFilter.needs_rebuild(includeRemovedKeys)) {
+        return;
+    }
+    std::unique_lock lock(_leafKeyFilterMtx, std::try_to_lock);
+    if (!lock.owns_lock() || !_leafKeyFilter.begin_rebuild()) {
+        return;
+    }
+    try {
+        // Keys are added within the write transaction committing them, waiting for any transaction in progress ensures
+        // that the read transaction sees all of the keys added before the rebuild began
+        create_write_transaction()->try_abort();
+        ReadTransaction::Ptr tx = create_read_transaction();
+        BloomFilter rebuilt = build_leaf_key_filter(_leafKeyFilter.get_false_positive_rate(), *tx);
+        tx.reset();
+        _leafKeyFilter.finish_rebuild(std::move(rebuilt));
+    } catch (std::exception& e) {
+        _leafKeyFilter.abort_rebuild();
+        info("Failed to rebuild leaf key filter of tree ", _name, ": ", e.what());
+    }
+}
+
+void LMDBTreeStore::save_leaf_key_filter()
+{
+    if (!_leafKeyFilter.is_enabled()) {
+        return;
+    }
+    TreeMeta meta;
+    ReadTransaction::Ptr tx = create_read_transaction();
+    if (!read_meta_data(meta, *tx)) {
+        return;
+    }
+    _leafKeyFilter.save(leaf_key_filter_path(), meta.unfinalisedBlockHeight, meta.root);
+}
+
+BloomFilter LMDBTreeStore::build_leaf_key_filter(double falsePositiveRate, LMDBTransaction& tx)
+{
+    MDB_stat stat;
+    call_lmdb_func("mdb_stat", mdb_stat, tx.underlying(), _leafKeyToIndexDatabase->underlying(), &stat);
+    BloomFilter filter(LeafKeyFilter::capacity_for(stat.ms_entries), falsePositiveRate);
+
+    MDB_cursor* cursor = nullptr;
+    call_lmdb_func("mdb_cursor_open", mdb_cursor_open, tx.underlying(), _leafKeyToIndexDatabase->underlying(), &cursor);
+    try {
+        MDB_val dbKey;
+        MDB_val dbVal;
+        int code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_FIRST);
+        while (code == MDB_SUCCESS) {
+            FrKeyType key;
+            deserialise_key(dbKey.mv_data, key);
+            filter.add(key);
+            code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_NEXT);
+        }
+        if (code != MDB_NOTFOUND) {
+            throw_error("build_leaf_key_filter::mdb_cursor_get", code);
+        }
+    } catch (std::exception& e) {
+        call_lmdb_func(mdb_cursor_close, cursor);
+        throw;
+    }
+    call_lmdb_func(mdb_cursor_close, cursor);
+    return filter;
 }
 
 } // namespace bb::crypto::merkle_tree
@@ -8,6 +8,9 @@
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/fixed_width_records.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/leaf_key_filter.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/pinned_node_cache.hpp"
 #include "barretenberg/crypto/merkle_tree/node_store/tree_meta.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
@@ -20,8 +23,12 @@
 #include "barretenberg/world_state/types.hpp"
 #include "lmdb.h"
 #include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
 #include <optional>
 #include <ostream>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
@@ -66,6 +73,16 @@ struct NodePayload {
     }
 };
 
+// Nodes are stored as fixed width records, those written by earlier versions of the store are msgpack encoded
+inline void decode_node_payload(std::span<const uint8_t> data, NodePayload& nodeData)
+{
+    if (fixed_width::is_record(data)) {
+        fixed_width::decode_node(data, nodeData.left, nodeData.right, nodeData.ref);
+        return;
+    }
+    msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
+}
+
 struct BlockIndexPayload {
     std::vector<block_number_t> blockNumbers;
 
@@ -175,7 +192,7 @@ class LMDBTreeStore : public LMDBStoreBase {
     LMDBTreeStore(LMDBTreeStore&& other) = delete;
     LMDBTreeStore& operator=(const LMDBTreeStore& other) = delete;
     LMDBTreeStore& operator=(LMDBTreeStore&& other) = delete;
-    ~LMDBTreeStore() override = default;
+    ~LMDBTreeStore() override;
 
     const std::string& get_name() const;
 
@@ -238,8 +255,61 @@ class LMDBTreeStore : public LMDBStoreBase {
 
     void delete_all_leaf_keys_before_or_equal_index(const index_t& index, WriteTransaction& tx);
 
+    // The cache of the upper levels of the tree, shared by all the forks reading from this store
+    PinnedNodeCache& get_pinned_node_cache() { return _pinnedNodes; }
+
+    // The filter of the committed leaf keys, shared by all the forks reading from this store
+    const LeafKeyFilter& get_leaf_key_filter() const { return _leafKeyFilter; }
+
+    /**
+     * Enables the filter of the committed leaf keys. The filter saved alongside the store is used if it was saved at
+     * the committed block of the tree, otherwise the filter is built from the leaf indices database.
+     */
+    void enable_leaf_key_filter(double falsePositiveRate = LeafKeyFilter::DEFAULT_FALSE_POSITIVE_RATE);
+
+    void disable_leaf_key_filter();
+
+    // Adds a key to the filter, to be called before the write transaction persisting it commits
+    void add_leaf_key_to_filter(const fr& leafKey);
+
+    // Whether a key may be committed, false only if it is certainly absent from the leaf indices database
+    bool leaf_key_may_exist(const fr& leafKey) const;
+
+    void record_leaf_key_filter_false_positive() const;
+
+    /**
+     * Commits a transaction that changed the leaf indices database. Removed keys are left in the filter, which remains
+     * correct, and it is marked stale until it is rebuilt.
+     */
+    void commit_leaf_keys(WriteTransaction& tx, bool keysRemoved);
+
+    /**
+     * Rebuilds the filter from a read transaction if it holds more keys than it was sized for, its observed false
+     * positive rate exceeds the target or, if includeRemovedKeys, it is stale. Must not be called while holding a write
+     * transaction of this store. A failed rebuild is logged and leaves the current filter in place.
+     */
+    void rebuild_leaf_key_filter_if_needed(bool includeRemovedKeys);
+
+    // Saves the filter alongside the store, labelled with the committed block number and root of the tree
+    void save_leaf_key_filter();
+
+    static constexpr uint64_t DEFAULT_MIGRATION_BATCH_SIZE = 100000;
+
+    /**
+     * Rewrites the nodes and leaf preimages written in msgpack by earlier versions of the store as fixed width records.
+     * Each write transaction covers at most batchSize values of a database, so the migration of a large store does not
+     * hold a single transaction open and can be interrupted and run again. Values that are already fixed width records
+     * are left untouched. Returns the number of values rewritten.
+     */
+    template <typename LeafType>
+    uint64_t migrate_to_fixed_width_records(uint64_t batchSize = DEFAULT_MIGRATION_BATCH_SIZE);
+
   private:
     std::string _name;
+    PinnedNodeCache _pinnedNodes;
+    LeafKeyFilter _leafKeyFilter;
+    // Held while the filter is enabled, disabled or rebuilt
+    std::mutex _leafKeyFilterMtx;
     LMDBDatabase::Ptr _blockDatabase;
     LMDBDatabase::Ptr _nodeDatabase;
     LMDBDatabase::Ptr _leafKeyToIndexDatabase;
@@ -247,6 +317,15 @@ class LMDBTreeStore : public LMDBStoreBase {
     LMDBDatabase::Ptr _indexToBlockDatabase;
 
     template <typename TxType> bool get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx);
+
+    // Re-encodes a value of a database, returning false if it does not need to be rewritten
+    using RecordConverter = std::function<bool(std::span<const uint8_t>, Value&)>;
+
+    uint64_t migrate_database(const LMDBDatabase& db, const RecordConverter& convert, uint64_t batchSize);
+
+    BloomFilter build_leaf_key_filter(double falsePositiveRate, LMDBTransaction& tx);
+
+    std::filesystem::path leaf_key_filter_path() const;
 };
 
 template <typename TxType> bool LMDBTreeStore::read_leaf_index(const fr& leafValue, index_t& leafIndex, TxType& tx)
@@ -259,32 +338,76 @@ template <typename LeafType, typename TxType>
 bool LMDBTreeStore::read_leaf_by_hash(const fr& leafHash, LeafType& leafData, TxType& tx)
 {
     FrKeyType key(leafHash);
-    std::vector<uint8_t> data;
+    std::span<const uint8_t> data;
     bool success = tx.template get_value<FrKeyType>(key, data, *_leafHashToPreImageDatabase);
-    if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(leafData);
+    if (!success) {
+        return false;
     }
-    return success;
+    if constexpr (fixed_width::HasCodec<LeafType>) {
+        if (fixed_width::is_record(data)) {
+            fixed_width::decode(data, leafData);
+            return true;
+        }
+    }
+    msgpack::unpack((const char*)data.data(), data.size()).get().convert(leafData);
+    return true;
 }
 
 template <typename LeafType>
 void LMDBTreeStore::write_leaf_by_hash(const fr& leafHash, const LeafType& leafData, WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, leafData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
     FrKeyType key(leafHash);
-    tx.put_value<FrKeyType>(key, encoded, *_leafHashToPreImageDatabase);
+    if constexpr (fixed_width::HasCodec<LeafType>) {
+        fixed_width::RecordBuffer<LeafType> buffer;
+        tx.put_value<FrKeyType>(key, fixed_width::encode(leafData, buffer), *_leafHashToPreImageDatabase);
+    } else {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, leafData);
+        std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+        tx.put_value<FrKeyType>(key, encoded, *_leafHashToPreImageDatabase);
+    }
 }
 
 template <typename TxType> bool LMDBTreeStore::get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx)
 {
     FrKeyType key(nodeHash);
-    std::vector<uint8_t> data;
+    std::span<const uint8_t> data;
     bool success = tx.template get_value<FrKeyType>(key, data, *_nodeDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
+        decode_node_payload(data, nodeData);
     }
     return success;
 }
+
+template <typename LeafType> uint64_t LMDBTreeStore::migrate_to_fixed_width_records(uint64_t batchSize)
+{
+    auto convertNode = [](std::span<const uint8_t> data, Value& encoded) {
+        if (fixed_width::is_record(data)) {
+            return false;
+        }
+        NodePayload nodeData;
+        decode_node_payload(data, nodeData);
+        fixed_width::NodeRecordBuffer buffer;
+        auto record = fixed_width::encode_node(nodeData.left, nodeData.right, nodeData.ref, buffer);
+        encoded.assign(record.begin(), record.end());
+        return true;
+    };
+    uint64_t numMigrated = migrate_database(*_nodeDatabase, convertNode, batchSize);
+
+    if constexpr (fixed_width::HasCodec<LeafType>) {
+        auto convertLeaf = [](std::span<const uint8_t> data, Value& encoded) {
+            if (fixed_width::is_record(data)) {
+                return false;
+            }
+            LeafType leafData;
+            msgpack::unpack((const char*)data.data(), data.size()).get().convert(leafData);
+            fixed_width::RecordBuffer<LeafType> buffer;
+            auto record = fixed_width::encode(leafData, buffer);
+            encoded.assign(record.begin(), record.end());
+            return true;
+        };
+        numMigrated += migrate_database(*_leafHashToPreImageDatabase, convertLeaf, batchSize);
+    }
+    return numMigrated;
+}
 } // namespace bb::crypto::merkle_tree
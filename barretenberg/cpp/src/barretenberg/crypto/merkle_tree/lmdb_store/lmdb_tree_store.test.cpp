@@ -15,6 +15,8 @@
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/node_store/tree_meta.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/lmdblib/lmdb_db_transaction.hpp"
+#include "barretenberg/lmdblib/lmdb_environment.hpp"
 #include "barretenberg/lmdblib/lmdb_helpers.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/numeric/uint128/uint128.hpp"
@@ -300,6 +302,87 @@ TEST_F(LMDBTreeStoreTest, can_write_and_read_leaves_by_hash)
     }
 }
 
+TEST_F(LMDBTreeStoreTest, can_write_and_read_nodes_with_missing_children)
+{
+    std::vector<NodePayload> nodes = {
+        NodePayload{ VALUES[0], std::nullopt, 1 },
+        NodePayload{ std::nullopt, VALUES[1], 2 },
+        NodePayload{ std::nullopt, std::nullopt, 3 },
+    };
+    LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        for (size_t i = 0; i < nodes.size(); i++) {
+            store.write_node(VALUES[10 + i], nodes[i], *transaction);
+        }
+        transaction->commit();
+    }
+
+    {
+        LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+        for (size_t i = 0; i < nodes.size(); i++) {
+            NodePayload readBack;
+            EXPECT_TRUE(store.read_node(VALUES[10 + i], readBack, *transaction));
+            EXPECT_EQ(readBack, nodes[i]);
+        }
+    }
+}
+
+TEST_F(LMDBTreeStoreTest, can_read_and_migrate_msgpack_records)
+{
+    NodePayload nodePayload{ VALUES[4], VALUES[5], 4 };
+    IndexedLeaf<PublicDataLeafValue> leafData(PublicDataLeafValue(VALUES[0], VALUES[1]), 7, VALUES[3]);
+    bb::fr nodeKey = VALUES[6];
+    bb::fr leafKey = VALUES[2];
+
+    // Create the databases, then write values to them as msgpack like earlier versions of the store did
+    { LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders); }
+    {
+        auto environment =
+            std::make_shared<LMDBEnvironment>(_directory, _mapSize, 5, static_cast<uint32_t>(_maxReaders));
+        LMDBDatabase::Ptr nodes;
+        LMDBDatabase::Ptr leaves;
+        {
+            LMDBDatabaseCreationTransaction tx(environment);
+            nodes = std::make_unique<LMDBDatabase>(
+                environment, tx, "DB1" + NODES_DB, false, false, false, value_cmp<bb::numeric::uint256_t>);
+            leaves = std::make_unique<LMDBDatabase>(
+                environment, tx, "DB1" + LEAF_PREIMAGES_DB, false, false, false, value_cmp<bb::numeric::uint256_t>);
+            tx.commit();
+        }
+        auto pack = [](const auto& value) {
+            msgpack::sbuffer buffer;
+            msgpack::pack(buffer, value);
+            return std::vector<uint8_t>(buffer.data(), buffer.data() + buffer.size());
+        };
+        LMDBWriteTransaction tx(environment);
+        FrKeyType key(nodeKey);
+        std::vector<uint8_t> encoded = pack(nodePayload);
+        tx.put_value<FrKeyType>(key, encoded, *nodes);
+        key = FrKeyType(leafKey);
+        encoded = pack(leafData);
+        tx.put_value<FrKeyType>(key, encoded, *leaves);
+        tx.commit();
+    }
+
+    LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+    auto check_values = [&]() {
+        LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+        NodePayload nodeReadBack;
+        EXPECT_TRUE(store.read_node(nodeKey, nodeReadBack, *transaction));
+        EXPECT_EQ(nodeReadBack, nodePayload);
+        IndexedLeaf<PublicDataLeafValue> leafReadBack;
+        EXPECT_TRUE(store.read_leaf_by_hash(leafKey, leafReadBack, *transaction));
+        EXPECT_EQ(leafReadBack, leafData);
+    };
+    check_values();
+
+    // Both values are rewritten once, in batches of a single value
+    EXPECT_EQ(store.migrate_to_fixed_width_records<IndexedLeaf<PublicDataLeafValue>>(1), 2UL);
+    EXPECT_EQ(store.migrate_to_fixed_width_records<IndexedLeaf<PublicDataLeafValue>>(1), 0UL);
+    check_values();
+}
+
 TEST_F(LMDBTreeStoreTest, can_write_and_retrieve_block_numbers_by_index)
 {
     struct BlockAndIndex {
@@ -10,6 +10,7 @@
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
 #include "barretenberg/crypto/merkle_tree/node_store/content_addressed_cache.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/pinned_node_cache.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/lmdblib/lmdb_helpers.hpp"
@@ -18,7 +19,9 @@
 #include "barretenberg/serialize/msgpack.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include "msgpack/assert.hpp"
+#include <algorithm>
 #include <cstdint>
+#include <deque>
 #include <exception>
 #include <iostream>
 #include <memory>
@@ -95,11 +98,15 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     /**
      * @brief Returns the data at the given node coordinates if available. Reads from uncommitted state if requested.
+     * @details If the level of the node is given (0 being the root) and is one of the levels pinned by the persisted
+     * store, committed nodes are read through its PinnedNodeCache. Only the children of the node are then guaranteed to
+     * be read, not its reference count.
      */
     bool get_node_by_hash(const fr& nodeHash,
                           NodePayload& payload,
                           ReadTransaction& transaction,
-                          bool includeUncommitted) const;
+                          bool includeUncommitted,
+                          std::optional<uint32_t> level = std::nullopt) const;
 
     /**
      * @brief Writes the provided data at the given node coordinates. Only writes to uncommitted data.
@@ -151,6 +158,27 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
      */
     void commit_block(TreeMeta& finalMeta, TreeDBStats& dbStats);
 
+    /**
+     * @brief Stages the uncommitted data as the next block, to be written to the underlying store later by
+     * persist_staged_block
+     * @details The staged block is read as uncommitted data and the next block is built on top of it. Committed reads
+     * only see the block once it has been written.
+     */
+    void stage_block(TreeMeta& finalMeta, TreeDBStats& dbStats);
+
+    /**
+     * @brief Writes the oldest staged block that has not yet been written to the underlying store
+     * @details Blocks are written by a single thread at a time. This may run alongside reads of uncommitted data and
+     * the staging of further blocks, but not alongside any other operation writing to the underlying store.
+     */
+    void persist_staged_block(TreeMeta& finalMeta, TreeDBStats& dbStats);
+
+    /**
+     * @brief Discards the staged blocks that have not been written and rolls back the uncommitted state. Must not be
+     * called while a block is being written.
+     */
+    void discard_staged_blocks();
+
     /**
      * @brief Commits the initial state of uncommitted data to the underlying store
      */
@@ -212,6 +240,15 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     Cache cache_;
 
+    // A block that has been staged by stage_block. Its data is not modified once staged
+    struct StagedBlock {
+        Cache cache;
+        TreeMeta meta;
+        bool persisted = false;
+    };
+    // The staged blocks, oldest first. Written blocks are released at the next stage_block or rollback
+    std::deque<std::shared_ptr<StagedBlock>> staged_;
+
     void initialise();
 
     void initialise_from_block(const block_number_t& blockNumber);
@@ -222,7 +259,7 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     void persist_meta(TreeMeta& m, WriteTransaction& tx);
 
-    void persist_node(const std::optional<fr>& optional_hash, uint32_t level, WriteTransaction& tx);
+    void persist_node(const Cache& cache, const std::optional<fr>& optional_hash, uint32_t level, WriteTransaction& tx);
 
     void remove_node(const std::optional<fr>& optional_hash,
                      uint32_t level,
@@ -239,7 +276,15 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     void persist_block_for_index(const block_number_t& blockNumber, const index_t& index, WriteTransaction& tx);
 
-    void persist_leaf_indices(WriteTransaction& tx);
+    void persist_leaf_indices(const Cache& cache, WriteTransaction& tx);
+
+    void write_block(const Cache& cache, TreeMeta& meta);
+
+    static void advance_meta_to_next_block(TreeMeta& meta);
+
+    void release_persisted_blocks();
+
+    void release_staged_blocks(const std::string& operation);
 
     void delete_block_for_index(const block_number_t& blockNumber, const index_t& index, WriteTransaction& tx);
 
@@ -382,8 +427,24 @@ std::pair<bool, index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_lo
         return std::make_pair(false, db_index);
     }
 
-    // Accessing the cache from here under a lock
+    // Accessing the staged blocks and the cache from here under a lock
     std::unique_lock lock(mtx_);
+    // The keys of the staged blocks lie between those of the store and those of the cache, oldest block first
+    for (const auto& block : staged_) {
+        const std::map<uint256_t, index_t>& indices = block->cache.get_indices();
+        auto it = indices.lower_bound(new_value_as_number);
+        if (it != indices.end() && it->first == new_value_as_number) {
+            return std::make_pair(true, it->second);
+        }
+        if (it == indices.begin()) {
+            continue;
+        }
+        --it;
+        if (it->first > retrieved_value) {
+            retrieved_value = it->first;
+            db_index = it->second;
+        }
+    }
     return cache_.find_low_value(new_leaf_key, retrieved_value, db_index);
 }
 
@@ -400,6 +461,11 @@ ContentAddressedCachedTreeStore<LeafValueType>::get_leaf_by_hash(const fr& leaf_
         if (cache_.get_leaf_preimage_by_hash(leaf_hash, leafData)) {
             return leafData;
         }
+        for (auto it = staged_.rbegin(); it != staged_.rend(); ++it) {
+            if ((*it)->cache.get_leaf_preimage_by_hash(leaf_hash, leafData)) {
+                return leafData;
+            }
+        }
     }
     if (dataStore_->read_leaf_by_hash(leaf_hash, leafData, tx)) {
         return leafData;
@@ -472,7 +538,11 @@ std::optional<index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_leaf
     if (requestContext.includeUncommitted) {
         // Accessing the cache under a lock
         std::unique_lock lock(mtx_);
-        std::optional<index_t> cached = cache_.get_leaf_key_index(preimage_to_key(leaf));
+        fr key = preimage_to_key(leaf);
+        std::optional<index_t> cached = cache_.get_leaf_key_index(key);
+        for (auto it = staged_.rbegin(); it != staged_.rend() && !cached.has_value(); ++it) {
+            cached = (*it)->cache.get_leaf_key_index(key);
+        }
         if (cached.has_value()) {
             // The is a cached value for the leaf
             // We will return from here regardless
@@ -486,6 +556,10 @@ std::optional<index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_leaf
     // we have been asked to not include uncommitted data, or there is none available
     index_t committed = 0;
     FrKeyType key = leaf;
+    // Most keys looked up are not in the tree, the key filter answers for these without reading the store
+    if (!dataStore_->leaf_key_may_exist(key)) {
+        return std::nullopt;
+    }
     bool success = dataStore_->read_leaf_index(key, committed, tx);
     if (success) {
         // We must constrin the search to only the data committed from our perspective
@@ -500,6 +574,7 @@ std::optional<index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_leaf
         }
         return std::make_optional(committed);
     }
+    dataStore_->record_leaf_key_filter_false_positive();
     return std::nullopt;
 }
 
@@ -515,7 +590,8 @@ template <typename LeafValueType>
 bool ContentAddressedCachedTreeStore<LeafValueType>::get_node_by_hash(const fr& nodeHash,
                                                                       NodePayload& payload,
                                                                       ReadTransaction& transaction,
-                                                                      bool includeUncommitted) const
+                                                                      bool includeUncommitted,
+                                                                      std::optional<uint32_t> level) const
 {
     if (includeUncommitted) {
         // Accessing nodes_ under a lock
@@ -523,8 +599,28 @@ bool ContentAddressedCachedTreeStore<LeafValueType>::get_node_by_hash(const fr&
         if (cache_.get_node(nodeHash, payload)) {
             return true;
         }
+        for (auto it = staged_.rbegin(); it != staged_.rend(); ++it) {
+            if ((*it)->cache.get_node(nodeHash, payload)) {
+                return true;
+            }
+        }
+    }
+    PinnedNodeCache& pinnedNodes = dataStore_->get_pinned_node_cache();
+    if (!level.has_value() || !pinnedNodes.pins(level.value())) {
+        return dataStore_->read_node(nodeHash, payload, transaction);
+    }
+    PinnedNodeCache::Children children;
+    if (pinnedNodes.get(nodeHash, children)) {
+        payload.left = children.left;
+        payload.right = children.right;
+        return true;
     }
-    return dataStore_->read_node(nodeHash, payload, transaction);
+    uint64_t generation = pinnedNodes.get_generation();
+    if (!dataStore_->read_node(nodeHash, payload, transaction)) {
+        return false;
+    }
+    pinnedNodes.put(nodeHash, level.value(), { .left = payload.left, .right = payload.right }, generation);
+    return true;
 }
 
 template <typename LeafValueType>
@@ -637,11 +733,12 @@ fr ContentAddressedCachedTreeStore<LeafValueType>::get_current_root(ReadTransact
 // are in progress, hence no data synchronisation is used.
 
 template <typename LeafValueType>
-void ContentAddressedCachedTreeStore<LeafValueType>::persist_leaf_indices(WriteTransaction& tx)
+void ContentAddressedCachedTreeStore<LeafValueType>::persist_leaf_indices(const Cache& cache, WriteTransaction& tx)
 {
-    const std::map<uint256_t, index_t>& indices = cache_.get_indices();
+    const std::map<uint256_t, index_t>& indices = cache.get_indices();
     for (const auto& idx : indices) {
         FrKeyType key = idx.first;
+        dataStore_->add_leaf_key_to_filter(key);
         dataStore_->write_leaf_index(key, idx.second, tx);
     }
 }
@@ -662,13 +759,13 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
         WriteTransactionPtr tx = create_write_transaction();
         try {
             if (dataPresent) {
-                persist_leaf_indices(*tx);
-                persist_node(std::optional<fr>(meta.root), 0, *tx);
+                persist_leaf_indices(cache_, *tx);
+                persist_node(cache_, std::optional<fr>(meta.root), 0, *tx);
             }
 
             meta.committedSize = meta.size;
             persist_meta(meta, *tx);
-            tx->commit();
+            dataStore_->commit_leaf_keys(*tx, false);
         } catch (std::exception& e) {
             tx->try_abort();
             throw std::runtime_error(
@@ -682,23 +779,107 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::commit_block(TreeMeta& finalMeta, TreeDBStats& dbStats)
 {
-    bool dataPresent = false;
     TreeMeta meta;
 
     // We don't allow commits using images/forks
     if (forkConstantData_.initialised_from_block_.has_value()) {
         throw std::runtime_error("Committing a fork is forbidden");
     }
+    release_staged_blocks("commit block");
     get_meta(meta);
+    advance_meta_to_next_block(meta);
+    write_block(cache_, meta);
+    finalMeta = meta;
+
+    // rolling back destroys all cache stores and also refreshes the cached meta_ from persisted state
+    rollback();
+
+    extract_db_stats(dbStats);
+}
+
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::stage_block(TreeMeta& finalMeta, TreeDBStats& dbStats)
+{
+    // We don't allow commits using images/forks
+    if (forkConstantData_.initialised_from_block_.has_value()) {
+        throw std::runtime_error("Committing a fork is forbidden");
+    }
+    {
+        // Accessing the staged blocks and the cache under a lock
+        std::unique_lock lock(mtx_);
+        // A staged block is not modified, the checkpoints would no longer refer to the uncommitted state
+        if (cache_.has_checkpoints()) {
+            throw std::runtime_error(
+                format("Unable to stage a block with active checkpoints. Tree name: ", forkConstantData_.name_));
+        }
+        release_persisted_blocks();
+        TreeMeta meta = cache_.get_meta();
+        advance_meta_to_next_block(meta);
+        staged_.push_back(std::make_shared<StagedBlock>(StagedBlock{ .cache = std::move(cache_), .meta = meta }));
+        // The next block starts from an empty cache on top of the staged block
+        cache_.reset(forkConstantData_.depth_);
+        cache_.put_meta(meta);
+        finalMeta = meta;
+    }
+    // The stats are those of the store as it was last written
+    extract_db_stats(dbStats);
+}
+
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::persist_staged_block(TreeMeta& finalMeta, TreeDBStats& dbStats)
+{
+    std::shared_ptr<StagedBlock> block;
+    {
+        // Accessing the staged blocks under a lock
+        std::unique_lock lock(mtx_);
+        auto it = std::find_if(staged_.begin(), staged_.end(), [](const auto& b) { return !b->persisted; });
+        if (it == staged_.end()) {
+            throw std::runtime_error(format("No staged block to write. Tree name: ", forkConstantData_.name_));
+        }
+        block = *it;
+    }
+    // The staged data is not modified once staged, it is written without holding the lock so that readers of the
+    // uncommitted state are not held up
+    finalMeta = block->meta;
+    write_block(block->cache, finalMeta);
+    {
+        std::unique_lock lock(mtx_);
+        block->persisted = true;
+    }
+    extract_db_stats(dbStats);
+}
+
+template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::discard_staged_blocks()
+{
+    {
+        std::unique_lock lock(mtx_);
+        staged_.clear();
+    }
+    rollback();
+}
+
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::advance_meta_to_next_block(TreeMeta& meta)
+{
+    ++meta.unfinalisedBlockHeight;
+    if (meta.oldestHistoricBlock == 0) {
+        meta.oldestHistoricBlock = 1;
+    }
+    meta.committedSize = meta.size;
+}
+
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::write_block(const Cache& cache, TreeMeta& meta)
+{
     NodePayload rootPayload;
-    dataPresent = cache_.get_node(meta.root, rootPayload);
+    bool dataPresent = cache.get_node(meta.root, rootPayload);
     {
         WriteTransactionPtr tx = create_write_transaction();
         try {
             if (dataPresent) {
-                // std::cout << "Persisting data for block " << uncommittedMeta.unfinalisedBlockHeight + 1 << std::endl;
+                // std::cout << "Persisting data for block " << meta.unfinalisedBlockHeight << std::endl;
                 // Persist the leaf indices
-                persist_leaf_indices(*tx);
+                persist_leaf_indices(cache, *tx);
             }
             // If we are commiting a block, we need to persist the root, since the new block "references" this root
             // However, if the root is the empty root we can't persist it, since it's not a real node and doesn't have
@@ -707,32 +888,47 @@ void ContentAddressedCachedTreeStore<LeafValueType>::commit_block(TreeMeta& fina
             // only issue is this needs to be recognised when we unwind or remove historic blocks i.e. there will be no
             // node date to remove for these blocks
             if (dataPresent || meta.size > 0) {
-                persist_node(std::optional<fr>(meta.root), 0, *tx);
-            }
-            ++meta.unfinalisedBlockHeight;
-            if (meta.oldestHistoricBlock == 0) {
-                meta.oldestHistoricBlock = 1;
+                persist_node(cache, std::optional<fr>(meta.root), 0, *tx);
             }
-            // std::cout << "New root " << uncommittedMeta.root << std::endl;
+            // std::cout << "New root " << meta.root << std::endl;
             BlockPayload block{ .size = meta.size, .blockNumber = meta.unfinalisedBlockHeight, .root = meta.root };
             dataStore_->write_block_data(meta.unfinalisedBlockHeight, block, *tx);
             dataStore_->write_block_index_data(block.blockNumber, block.size, *tx);
 
-            meta.committedSize = meta.size;
             persist_meta(meta, *tx);
-            tx->commit();
+            dataStore_->commit_leaf_keys(*tx, false);
         } catch (std::exception& e) {
             tx->try_abort();
             throw std::runtime_error(
                 format("Unable to commit data to tree: ", forkConstantData_.name_, " Error: ", e.what()));
         }
     }
-    finalMeta = meta;
+    dataStore_->get_pinned_node_cache().invalidate();
+    // Outside of the write transaction, so that the next block can be written while the key filter is rebuilt
+    dataStore_->rebuild_leaf_key_filter_if_needed(false);
+}
 
-    // rolling back destroys all cache stores and also refreshes the cached meta_ from persisted state
-    rollback();
+// Must be called under the lock
+template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::release_persisted_blocks()
+{
+    // Blocks are written in order, a written block is now read from the store
+    while (!staged_.empty() && staged_.front()->persisted) {
+        staged_.pop_front();
+    }
+}
 
-    extract_db_stats(dbStats);
+// Operations that write to the store other than persist_staged_block require all staged blocks to have been written
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::release_staged_blocks(const std::string& operation)
+{
+    std::unique_lock lock(mtx_);
+    if (std::any_of(staged_.begin(), staged_.end(), [](const auto& b) { return !b->persisted; })) {
+        throw std::runtime_error(format("Unable to ",
+                                        operation,
+                                        ": there are staged blocks that have not been written. Tree name: ",
+                                        forkConstantData_.name_));
+    }
+    staged_.clear();
 }
 
 template <typename LeafValueType>
@@ -755,7 +951,8 @@ void ContentAddressedCachedTreeStore<LeafValueType>::extract_db_stats(TreeDBStat
 }
 
 template <typename LeafValueType>
-void ContentAddressedCachedTreeStore<LeafValueType>::persist_node(const std::optional<fr>& optional_hash,
+void ContentAddressedCachedTreeStore<LeafValueType>::persist_node(const Cache& cache,
+                                                                  const std::optional<fr>& optional_hash,
                                                                   uint32_t level,
                                                                   WriteTransaction& tx)
 {
@@ -781,14 +978,14 @@ void ContentAddressedCachedTreeStore<LeafValueType>::persist_node(const std::opt
         if (so.lvl == forkConstantData_.depth_) {
             // this is a leaf, we need to persist the pre-image
             IndexedLeafValueType leafPreImage;
-            if (cache_.get_leaf_preimage_by_hash(hash, leafPreImage)) {
+            if (cache.get_leaf_preimage_by_hash(hash, leafPreImage)) {
                 dataStore_->write_leaf_by_hash(hash, leafPreImage, tx);
             }
         }
 
         // std::cout << "Persisting node hash " << hash << " at level " << so.lvl << std::endl;
         NodePayload nodePayload;
-        if (!cache_.get_node(hash, nodePayload)) {
+        if (!cache.get_node(hash, nodePayload)) {
             //  need to increase the stored node's reference count here
             dataStore_->increment_node_reference_count(hash, tx);
             continue;
@@ -809,6 +1006,15 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
 {
     // Extract the committed meta data and destroy the cache
     cache_.reset(forkConstantData_.depth_);
+    {
+        // The uncommitted state rolls back to the latest staged block if there is one
+        std::unique_lock lock(mtx_);
+        release_persisted_blocks();
+        if (!staged_.empty()) {
+            cache_.put_meta(staged_.back()->meta);
+            return;
+        }
+    }
     {
         ReadTransactionPtr tx = create_read_transaction();
         TreeMeta committedMeta;
@@ -836,6 +1042,7 @@ void ContentAddressedCachedTreeStore<LeafValueType>::advance_finalised_block(con
     if (forkConstantData_.initialised_from_block_.has_value()) {
         throw std::runtime_error("Advancing the finalised block on a fork is forbidden");
     }
+    release_staged_blocks("advance finalised block");
     {
         // read both committed and uncommitted meta values
         ReadTransactionPtr readTx = create_read_transaction();
@@ -901,6 +1108,7 @@ void ContentAddressedCachedTreeStore<LeafValueType>::unwind_block(const block_nu
     if (forkConstantData_.initialised_from_block_.has_value()) {
         throw std::runtime_error("Removing a block on a fork is forbidden");
     }
+    release_staged_blocks("remove block");
     {
         ReadTransactionPtr readTx = create_read_transaction();
         get_meta(uncommittedMeta);
@@ -978,7 +1186,8 @@ void ContentAddressedCachedTreeStore<LeafValueType>::unwind_block(const block_nu
             // std::cout << "New block root " << previousBlockData.root << std::endl;
             //  commit this new meta data
             persist_meta(uncommittedMeta, *writeTx);
-            writeTx->commit();
+            // The unwound keys are removed from the leaf indices, they remain in the key filter until it is rebuilt
+            dataStore_->commit_leaf_keys(*writeTx, true);
         } catch (std::exception& e) {
             writeTx->try_abort();
             throw std::runtime_error(format("Unable to commit unwind of block: ",
@@ -989,6 +1198,7 @@ void ContentAddressedCachedTreeStore<LeafValueType>::unwind_block(const block_nu
                                             e.what()));
         }
     }
+    dataStore_->get_pinned_node_cache().invalidate();
 
     // now update the uncommitted meta
     put_meta(uncommittedMeta);
@@ -1012,6 +1222,7 @@ void ContentAddressedCachedTreeStore<LeafValueType>::remove_historical_block(con
     if (forkConstantData_.initialised_from_block_.has_value()) {
         throw std::runtime_error("Removing a block on a fork is forbidden");
     }
+    release_staged_blocks("remove block");
     {
         // retrieve both the committed and uncommitted meta data, validate the provide block is the oldest historical
         // block
@@ -1074,6 +1285,7 @@ void ContentAddressedCachedTreeStore<LeafValueType>::remove_historical_block(con
                                             e.what()));
         }
     }
+    dataStore_->get_pinned_node_cache().invalidate();
 
     // commit was successful, update the uncommitted meta
     uncommittedMeta.oldestHistoricBlock = committedMeta.oldestHistoricBlock;
@@ -52,6 +52,7 @@ template <typename LeafValueType> class ContentAddressedCache {
     void commit();
     void revert_all();
     void commit_all();
+    bool has_checkpoints() const { return !journals_.empty(); }
 
     void reset(uint32_t depth);
     std::pair<bool, index_t> find_low_value(const uint256_t& new_leaf_key,
@@ -0,0 +1,453 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief A Bloom filter over the keys of the leaf indices database of a tree
+ * @details Each key sets numHashes bits, derived by double hashing from two 64 bit hashes of its limbs. The filter is
+ * sized for a number of keys and a target false positive rate, it does not grow. Once more keys than its capacity have
+ * been added, the false positive rate exceeds the target and it should be rebuilt with a larger capacity.
+ */
+class BloomFilter {
+  public:
+    static constexpr uint64_t MIN_CAPACITY = 1024;
+
+    BloomFilter() = default;
+
+    BloomFilter(uint64_t capacity, double falsePositiveRate)
+        : capacity_(std::max(capacity, MIN_CAPACITY))
+    {
+        if (falsePositiveRate <= 0.0 || falsePositiveRate >= 1.0) {
+            throw std::runtime_error(format("Invalid leaf key filter false positive rate ", falsePositiveRate));
+        }
+        const double ln2 = std::log(2.0);
+        const double bits = -static_cast<double>(capacity_) * std::log(falsePositiveRate) / (ln2 * ln2);
+        const auto numBits = static_cast<uint64_t>(std::ceil(bits));
+        words_.resize((numBits + 63) / 64, 0);
+        const double bitsPerKey = static_cast<double>(words_.size() * 64) / static_cast<double>(capacity_);
+        numHashes_ = std::clamp(static_cast<uint32_t>(std::lround(bitsPerKey * ln2)), 1U, 16U);
+    }
+
+    bool is_empty() const { return words_.empty(); }
+    uint64_t get_capacity() const { return capacity_; }
+    uint64_t get_num_keys() const { return numKeys_; }
+    uint64_t get_num_bits() const { return words_.size() * 64; }
+    uint32_t get_num_hashes() const { return numHashes_; }
+    bool is_overfilled() const { return numKeys_ > capacity_; }
+
+    void add(const uint256_t& key)
+    {
+        uint64_t h1 = 0;
+        uint64_t h2 = 0;
+        hash(key, h1, h2);
+        const uint64_t numBits = get_num_bits();
+        for (uint32_t i = 0; i < numHashes_; ++i) {
+            const uint64_t bit = (h1 + i * h2) % numBits;
+            words_[bit / 64] |= 1ULL << (bit % 64);
+        }
+        ++numKeys_;
+    }
+
+    bool may_contain(const uint256_t& key) const
+    {
+        if (words_.empty()) {
+            return true;
+        }
+        uint64_t h1 = 0;
+        uint64_t h2 = 0;
+        hash(key, h1, h2);
+        const uint64_t numBits = get_num_bits();
+        for (uint32_t i = 0; i < numHashes_; ++i) {
+            const uint64_t bit = (h1 + i * h2) % numBits;
+            if ((words_[bit / 64] & (1ULL << (bit % 64))) == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // The false positive rate expected for the number of keys added so far
+    double estimated_false_positive_rate() const
+    {
+        if (words_.empty()) {
+            return 1.0;
+        }
+        const double exponent = -static_cast<double>(numHashes_) * static_cast<double>(numKeys_) /
+                                static_cast<double>(get_num_bits());
+        return std::pow(1.0 - std::exp(exponent), static_cast<double>(numHashes_));
+    }
+
+    void write(std::ostream& os) const
+    {
+        os.write(reinterpret_cast<const char*>(&capacity_), sizeof(capacity_));
+        os.write(reinterpret_cast<const char*>(&numKeys_), sizeof(numKeys_));
+        os.write(reinterpret_cast<const char*>(&numHashes_), sizeof(numHashes_));
+        const uint64_t numWords = words_.size();
+        os.write(reinterpret_cast<const char*>(&numWords), sizeof(numWords));
+        os.write(reinterpret_cast<const char*>(words_.data()),
+                 static_cast<std::streamsize>(numWords * sizeof(uint64_t)));
+    }
+
+    bool read(std::istream& is)
+    {
+        uint64_t numWords = 0;
+        is.read(reinterpret_cast<char*>(&capacity_), sizeof(capacity_));
+        is.read(reinterpret_cast<char*>(&numKeys_), sizeof(numKeys_));
+        is.read(reinterpret_cast<char*>(&numHashes_), sizeof(numHashes_));
+        is.read(reinterpret_cast<char*>(&numWords), sizeof(numWords));
+        if (!is || numWords == 0 || numHashes_ == 0) {
+            return false;
+        }
+        words_.resize(numWords);
+        is.read(reinterpret_cast<char*>(words_.data()), static_cast<std::streamsize>(numWords * sizeof(uint64_t)));
+        return static_cast<bool>(is);
+    }
+
+  private:
+    uint64_t capacity_ = 0;
+    uint64_t numKeys_ = 0;
+    uint32_t numHashes_ = 0;
+    std::vector<uint64_t> words_;
+
+    static uint64_t mix(uint64_t x)
+    {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return x;
+    }
+
+    // Keys such as public data slots are not uniformly distributed, so all of the limbs are mixed
+    static void hash(const uint256_t& key, uint64_t& h1, uint64_t& h2)
+    {
+        h1 = mix(key.data[0] + mix(key.data[1] + mix(key.data[2] + mix(key.data[3]))));
+        h2 = mix(h1 ^ 0x9e3779b97f4a7c15ULL) | 1;
+    }
+};
+
+struct LeafKeyFilterStats {
+    bool enabled = false;
+    uint64_t numKeys = 0;
+    uint64_t capacity = 0;
+    uint64_t numBits = 0;
+    uint32_t numHashes = 0;
+    // The number of committed lookups checked against the filter
+    uint64_t lookups = 0;
+    // The lookups answered by the filter without reading the store
+    uint64_t negatives = 0;
+    // The lookups the filter passed on to the store that did not find the key
+    uint64_t falsePositives = 0;
+    uint64_t rebuilds = 0;
+    double estimatedFalsePositiveRate = 0;
+    // Whether keys have been removed from the store since the filter was built
+    bool stale = false;
+
+    MSGPACK_FIELDS(enabled,
+                   numKeys,
+                   capacity,
+                   numBits,
+                   numHashes,
+                   lookups,
+                   negatives,
+                   falsePositives,
+                   rebuilds,
+                   estimatedFalsePositiveRate,
+                   stale);
+};
+
+/**
+ * @brief An optional filter of the keys committed to the leaf indices database of a tree
+ * @details Most lookups of a key in the committed state of a tree are for keys that do not exist, such as the
+ * nullifiers of a new transaction. The filter answers these without an LMDB lookup. It belongs to the persisted store
+ * of the tree and is thus shared by the canonical fork and all other forks reading from it.
+ *
+ * The filter must never reject a key that a read transaction can find in the store. Keys are added before the write
+ * transaction committing them, so that the filter always holds a superset of the committed keys, at any block. Keys
+ * removed by an unwind remain in the filter, which only raises its false positive rate, until it is replaced by one
+ * rebuilt from the store. A rebuild reads the store outside of any write transaction, the keys added while it runs are
+ * recorded and added to the rebuilt filter before it replaces the current one.
+ *
+ * The filter can be saved to a file alongside the store, labelled with the block number and root of the tree. It is
+ * only loaded back if these match the committed state of the tree, otherwise it is rebuilt.
+ */
+class LeafKeyFilter {
+  public:
+    static constexpr double DEFAULT_FALSE_POSITIVE_RATE = 0.001;
+    static constexpr uint32_t FILE_MAGIC = 0x464b4c42;
+    static constexpr uint32_t FILE_VERSION = 1;
+    // The number of lookups rejected or passed in error since the last rebuild before the observed rate is trusted
+    static constexpr uint64_t MIN_OBSERVED_LOOKUPS = 10000;
+    // How far the observed false positive rate may exceed the target before the filter is rebuilt
+    static constexpr double OBSERVED_RATE_TOLERANCE = 2.0;
+
+    bool is_enabled() const
+    {
+        std::shared_lock lock(mtx_);
+        return enabled_;
+    }
+
+    double get_false_positive_rate() const
+    {
+        std::shared_lock lock(mtx_);
+        return falsePositiveRate_;
+    }
+
+    bool is_overfilled() const
+    {
+        std::shared_lock lock(mtx_);
+        return enabled_ && filter_.is_overfilled();
+    }
+
+    // Whether the filter holds removed keys, more keys than it was sized for or misses its target in practice
+    bool needs_rebuild(bool includeRemovedKeys) const
+    {
+        std::shared_lock lock(mtx_);
+        if (!enabled_ || rebuilding_) {
+            return false;
+        }
+        return (includeRemovedKeys && stale_) || filter_.is_overfilled() || observed_rate_exceeds_target();
+    }
+
+    // To be called once keys have been removed from the store
+    void mark_stale()
+    {
+        std::unique_lock lock(mtx_);
+        stale_ = enabled_;
+    }
+
+    // The capacity a rebuilt filter is given for the number of keys it will hold
+    static uint64_t capacity_for(uint64_t numKeys) { return std::max(numKeys * 2, BloomFilter::MIN_CAPACITY); }
+
+    // Returns false only if the key is certainly not committed, always true when the filter is disabled
+    bool may_contain(const uint256_t& key) const
+    {
+        std::shared_lock lock(mtx_);
+        if (!enabled_) {
+            return true;
+        }
+        lookups_.fetch_add(1, std::memory_order_relaxed);
+        if (filter_.may_contain(key)) {
+            return true;
+        }
+        negatives_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // To be called when a key passed by the filter is not found in the store
+    void record_false_positive() const
+    {
+        std::shared_lock lock(mtx_);
+        if (enabled_) {
+            falsePositives_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void add(const uint256_t& key)
+    {
+        std::unique_lock lock(mtx_);
+        if (enabled_) {
+            filter_.add(key);
+            if (rebuilding_) {
+                addedDuringRebuild_.push_back(key);
+            }
+        }
+    }
+
+    void enable(BloomFilter filter, double falsePositiveRate)
+    {
+        std::unique_lock lock(mtx_);
+        filter_ = std::move(filter);
+        falsePositiveRate_ = falsePositiveRate;
+        enabled_ = true;
+        stale_ = false;
+        reset_observed_rate();
+    }
+
+    void disable()
+    {
+        std::unique_lock lock(mtx_);
+        filter_ = BloomFilter();
+        enabled_ = false;
+        stale_ = false;
+    }
+
+    /**
+     * Starts recording the keys added, returns false if the filter is disabled or already being rebuilt. The store
+     * must be read for the rebuilt filter after this call, by a transaction that sees every commit whose keys were
+     * added before it.
+     */
+    bool begin_rebuild()
+    {
+        std::unique_lock lock(mtx_);
+        if (!enabled_ || rebuilding_) {
+            return false;
+        }
+        rebuilding_ = true;
+        stale_ = false;
+        addedDuringRebuild_.clear();
+        return true;
+    }
+
+    // Replaces the filter by one rebuilt from the store, together with the keys added since the rebuild began
+    void finish_rebuild(BloomFilter filter)
+    {
+        std::unique_lock lock(mtx_);
+        if (enabled_ && rebuilding_) {
+            for (const auto& key : addedDuringRebuild_) {
+                filter.add(key);
+            }
+            filter_ = std::move(filter);
+            ++rebuilds_;
+            reset_observed_rate();
+        }
+        rebuilding_ = false;
+        addedDuringRebuild_.clear();
+    }
+
+    // Keeps the current filter, which still holds every committed key, and leaves it to be rebuilt again
+    void abort_rebuild()
+    {
+        std::unique_lock lock(mtx_);
+        stale_ = stale_ || (enabled_ && rebuilding_);
+        rebuilding_ = false;
+        addedDuringRebuild_.clear();
+    }
+
+    LeafKeyFilterStats get_stats() const
+    {
+        std::shared_lock lock(mtx_);
+        LeafKeyFilterStats stats;
+        stats.enabled = enabled_;
+        stats.numKeys = filter_.get_num_keys();
+        stats.capacity = filter_.get_capacity();
+        stats.numBits = filter_.get_num_bits();
+        stats.numHashes = filter_.get_num_hashes();
+        stats.lookups = lookups_.load(std::memory_order_relaxed);
+        stats.negatives = negatives_.load(std::memory_order_relaxed);
+        stats.falsePositives = falsePositives_.load(std::memory_order_relaxed);
+        stats.rebuilds = rebuilds_;
+        stats.estimatedFalsePositiveRate = enabled_ ? filter_.estimated_false_positive_rate() : 0;
+        stats.stale = stale_;
+        return stats;
+    }
+
+    // Writes the filter to a temporary file first, so that the file at path is always complete
+    void save(const std::filesystem::path& path, const block_number_t& blockNumber, const fr& root) const
+    {
+        std::shared_lock lock(mtx_);
+        if (!enabled_) {
+            return;
+        }
+        std::filesystem::path tmpPath = path;
+        tmpPath += ".tmp";
+        {
+            std::ofstream os(tmpPath, std::ios::binary | std::ios::trunc);
+            write_header(os, blockNumber, root, falsePositiveRate_);
+            filter_.write(os);
+            if (!os) {
+                throw std::runtime_error(format("Failed to write leaf key filter to ", tmpPath.string()));
+            }
+        }
+        std::filesystem::rename(tmpPath, path);
+    }
+
+    // Reads a filter saved at the given block and root, returns false if there is none
+    static bool load(const std::filesystem::path& path,
+                     const block_number_t& blockNumber,
+                     const fr& root,
+                     double falsePositiveRate,
+                     BloomFilter& filter)
+    {
+        std::ifstream is(path, std::ios::binary);
+        if (!is) {
+            return false;
+        }
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        block_number_t savedBlockNumber = 0;
+        fr savedRoot;
+        double savedRate = 0;
+        is.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+        is.read(reinterpret_cast<char*>(&version), sizeof(version));
+        is.read(reinterpret_cast<char*>(&savedBlockNumber), sizeof(savedBlockNumber));
+        is.read(reinterpret_cast<char*>(&savedRoot.data[0]), sizeof(savedRoot.data));
+        is.read(reinterpret_cast<char*>(&savedRate), sizeof(savedRate));
+        if (!is || magic != FILE_MAGIC || version != FILE_VERSION || savedBlockNumber != blockNumber ||
+            savedRoot != root || savedRate != falsePositiveRate) {
+            return false;
+        }
+        return filter.read(is);
+    }
+
+  private:
+    mutable std::shared_mutex mtx_;
+    bool enabled_ = false;
+    bool stale_ = false;
+    bool rebuilding_ = false;
+    double falsePositiveRate_ = DEFAULT_FALSE_POSITIVE_RATE;
+    BloomFilter filter_;
+    std::vector<uint256_t> addedDuringRebuild_;
+    uint64_t rebuilds_ = 0;
+    mutable std::atomic<uint64_t> lookups_ = 0;
+    mutable std::atomic<uint64_t> negatives_ = 0;
+    mutable std::atomic<uint64_t> falsePositives_ = 0;
+    // The counters when the current filter was built, the observed false positive rate is measured from these
+    uint64_t negativesAtBuild_ = 0;
+    uint64_t falsePositivesAtBuild_ = 0;
+
+    void reset_observed_rate()
+    {
+        negativesAtBuild_ = negatives_.load(std::memory_order_relaxed);
+        falsePositivesAtBuild_ = falsePositives_.load(std::memory_order_relaxed);
+    }
+
+    bool observed_rate_exceeds_target() const
+    {
+        const uint64_t falsePositives = falsePositives_.load(std::memory_order_relaxed) - falsePositivesAtBuild_;
+        const uint64_t absent = falsePositives + negatives_.load(std::memory_order_relaxed) - negativesAtBuild_;
+        if (absent < MIN_OBSERVED_LOOKUPS) {
+            return false;
+        }
+        const double observedRate = static_cast<double>(falsePositives) / static_cast<double>(absent);
+        return observedRate > falsePositiveRate_ * OBSERVED_RATE_TOLERANCE;
+    }
+
+    static void write_header(std::ostream& os,
+                             const block_number_t& blockNumber,
+                             const fr& root,
+                             double falsePositiveRate)
+    {
+        const uint32_t magic = FILE_MAGIC;
+        const uint32_t version = FILE_VERSION;
+        os.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
+        os.write(reinterpret_cast<const char*>(&version), sizeof(version));
+        os.write(reinterpret_cast<const char*>(&blockNumber), sizeof(blockNumber));
+        os.write(reinterpret_cast<const char*>(&root.data[0]), sizeof(root.data));
+        os.write(reinterpret_cast<const char*>(&falsePositiveRate), sizeof(falsePositiveRate));
+    }
+};
+
+} // namespace bb::crypto::merkle_tree
@@ -0,0 +1,111 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief Cache of the children of the committed nodes in the upper levels of a tree
+ * @details Every path query walks down from the root, so the upper levels of a tree are read by all of them. This
+ * cache holds the children of the nodes read at levels below `levels` (the root being at level 0), so that these are
+ * served from memory rather than by an LMDB lookup and a msgpack decode. It belongs to the persisted store of the tree
+ * and is thus shared by the canonical fork and all other forks reading from it.
+ *
+ * Nodes are content addressed, so a cached entry is correct for as long as the node exists. The cache is cleared when
+ * the persisted tree changes (a block is committed, unwound or removed), which bounds its size to the nodes read since
+ * the last block and drops the nodes that no longer exist. A node read from the store while the cache is cleared is
+ * not inserted. A read transaction older than the last clear may still insert a node that has since been removed, but
+ * such a node is only reachable from the roots that were removed with it.
+ *
+ * Only the children are cached, not the reference count of the node.
+ */
+class PinnedNodeCache {
+  public:
+    struct Children {
+        std::optional<fr> left;
+        std::optional<fr> right;
+    };
+
+    explicit PinnedNodeCache(uint32_t levels = 0)
+        : levels_(levels)
+    {}
+
+    uint32_t get_levels() const
+    {
+        std::shared_lock lock(mtx_);
+        return levels_;
+    }
+
+    void set_levels(uint32_t levels)
+    {
+        std::unique_lock lock(mtx_);
+        levels_ = levels;
+        nodes_.clear();
+        ++generation_;
+    }
+
+    // Whether nodes at the given level (0 being the root) are cached
+    bool pins(uint32_t level) const
+    {
+        std::shared_lock lock(mtx_);
+        return level < levels_;
+    }
+
+    // Changes every time the cache is cleared, to be read before the node being inserted is read from the store
+    uint64_t get_generation() const
+    {
+        std::shared_lock lock(mtx_);
+        return generation_;
+    }
+
+    bool get(const fr& nodeHash, Children& children) const
+    {
+        std::shared_lock lock(mtx_);
+        auto it = nodes_.find(nodeHash);
+        if (it == nodes_.end()) {
+            return false;
+        }
+        children = it->second;
+        return true;
+    }
+
+    void put(const fr& nodeHash, uint32_t level, const Children& children, uint64_t generation)
+    {
+        std::unique_lock lock(mtx_);
+        if (generation != generation_ || level >= levels_) {
+            return;
+        }
+        nodes_.emplace(nodeHash, children);
+    }
+
+    void invalidate()
+    {
+        std::unique_lock lock(mtx_);
+        nodes_.clear();
+        ++generation_;
+    }
+
+    size_t size() const
+    {
+        std::shared_lock lock(mtx_);
+        return nodes_.size();
+    }
+
+  private:
+    mutable std::shared_mutex mtx_;
+    std::unordered_map<fr, Children> nodes_;
+    uint32_t levels_;
+    uint64_t generation_ = 0;
+};
+
+} // namespace bb::crypto::merkle_tree
@@ -153,6 +153,38 @@ struct FindLeafPathResponse {
     FindLeafPathResponse& operator=(FindLeafPathResponse&& other) noexcept = default;
 };
 
+/**
+ * The sibling paths of a batch of leaves, with each distinct node held once. paths[i][j] is the position in nodes of
+ * the sibling at level j (counted from the leaves) of the i'th requested leaf.
+ */
+struct SiblingPathsBatch {
+    std::vector<fr> nodes;
+    std::vector<std::vector<uint32_t>> paths;
+
+    MSGPACK_FIELDS(nodes, paths);
+
+    fr_sibling_path get_path(size_t i) const
+    {
+        fr_sibling_path path;
+        path.reserve(paths[i].size());
+        for (uint32_t node : paths[i]) {
+            path.push_back(nodes[node]);
+        }
+        return path;
+    }
+};
+
+struct GetSiblingPathsResponse {
+    SiblingPathsBatch paths;
+
+    GetSiblingPathsResponse() = default;
+    ~GetSiblingPathsResponse() = default;
+    GetSiblingPathsResponse(const GetSiblingPathsResponse& other) = default;
+    GetSiblingPathsResponse(GetSiblingPathsResponse&& other) noexcept = default;
+    GetSiblingPathsResponse& operator=(const GetSiblingPathsResponse& other) = default;
+    GetSiblingPathsResponse& operator=(GetSiblingPathsResponse&& other) noexcept = default;
+};
+
 struct GetLeafResponse {
     std::optional<bb::fr> leaf;
 
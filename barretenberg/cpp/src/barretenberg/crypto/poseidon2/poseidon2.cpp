@@ -5,8 +5,20 @@
 // =====================
 
 #include "poseidon2.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "poseidon2_batch_permutation.hpp"
+#include <algorithm>
 
 namespace bb::crypto {
+namespace {
+// Domain separator of a sponge hashing two elements into one, see FieldSponge::hash_internal
+template <typename FF> const FF& pair_iv()
+{
+    static const FF iv = FF(static_cast<uint256_t>(2) << 64);
+    return iv;
+}
+} // namespace
+
 /**
  * @brief Hashes a vector of field elements
  */
@@ -16,6 +28,37 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash(const std::vector<typenam
     return Sponge::hash_internal(input);
 }
 
+/**
+ * @brief Hashes two field elements
+ * @details A one-block sponge absorbing two elements and squeezing one is a single permutation of
+ * { lhs, rhs, 0, iv }.
+ */
+template <typename Params>
+typename Poseidon2<Params>::FF Poseidon2<Params>::hash_pair(const FF& lhs, const FF& rhs)
+{
+    typename Poseidon2Permutation<Params>::State state{ lhs, rhs, FF(0), pair_iv<FF>() };
+    return Poseidon2Permutation<Params>::permutation(state)[0];
+}
+
+template <typename Params> void Poseidon2<Params>::hash_pairs(std::span<const FF> inputs, std::span<FF> outputs)
+{
+    BB_ASSERT_EQ(inputs.size(), 2 * outputs.size());
+    // Permute the pairs in blocks, so that the batch permutation can work on several of them at once
+    using State = typename Poseidon2Permutation<Params>::State;
+    constexpr size_t BLOCK_SIZE = 64;
+    std::array<State, BLOCK_SIZE> states;
+    for (size_t start = 0; start < outputs.size(); start += BLOCK_SIZE) {
+        const size_t block_size = std::min(BLOCK_SIZE, outputs.size() - start);
+        for (size_t i = 0; i < block_size; ++i) {
+            states[i] = { inputs[2 * (start + i)], inputs[2 * (start + i) + 1], FF(0), pair_iv<FF>() };
+        }
+        Poseidon2BatchPermutation<Params>::permute(std::span<State>(states.data(), block_size));
+        for (size_t i = 0; i < block_size; ++i) {
+            outputs[start + i] = states[i][0];
+        }
+    }
+}
+
 /**
  * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
  * @details Slice function cuts out the required number of bytes from the byte vector
@@ -9,6 +9,7 @@
 #include "poseidon2_params.hpp"
 #include "poseidon2_permutation.hpp"
 #include "sponge/sponge.hpp"
+#include <span>
 
 namespace bb::crypto {
 
@@ -23,6 +24,17 @@ template <typename Params> class Poseidon2 {
      * @brief Hashes a vector of field elements
      */
     static FF hash(const std::vector<FF>& input);
+    /**
+     * @brief Hashes two field elements; equal to hash({ lhs, rhs }) without going through a sponge or the heap
+     */
+    static FF hash_pair(const FF& lhs, const FF& rhs);
+    /**
+     * @brief Hashes consecutive pairs of `inputs` into `outputs`, i.e. outputs[i] = hash_pair(inputs[2i], inputs[2i+1])
+     * @details The batch entry point for callers that hash many independent pairs at once, e.g. a level of a merkle
+     * tree, permuting the pairs through Poseidon2BatchPermutation. `inputs` must hold exactly twice as many elements as
+     * `outputs`; the two may not overlap.
+     */
+    static void hash_pairs(std::span<const FF> inputs, std::span<FF> outputs);
     /**
      * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
      * @details Slice function cuts out the required number of bytes from the byte vector
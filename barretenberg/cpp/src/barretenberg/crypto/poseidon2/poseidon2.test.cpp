@@ -46,6 +46,25 @@ TEST(Poseidon2, HashConsistencyCheck)
     EXPECT_EQ(result, expected);
 }
 
+TEST(Poseidon2, HashPairMatchesHash)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+    constexpr size_t num_pairs = 37;
+
+    std::vector<fr> inputs(2 * num_pairs);
+    for (auto& input : inputs) {
+        input = fr::random_element(&engine);
+    }
+    std::vector<fr> outputs(num_pairs);
+    Poseidon2::hash_pairs(inputs, outputs);
+
+    for (size_t i = 0; i < num_pairs; ++i) {
+        const fr expected = Poseidon2::hash({ inputs[2 * i], inputs[2 * i + 1] });
+        EXPECT_EQ(Poseidon2::hash_pair(inputs[2 * i], inputs[2 * i + 1]), expected);
+        EXPECT_EQ(outputs[i], expected);
+    }
+}
+
 TEST(Poseidon2, HashBufferConsistencyCheck)
 {
     // 31 byte inputs because hash_buffer slicing is only injective with 31 bytes, as it slices 31 bytes for each field
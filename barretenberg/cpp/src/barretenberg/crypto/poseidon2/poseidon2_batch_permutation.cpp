@@ -0,0 +1,256 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#include "poseidon2_batch_permutation.hpp"
+#include "barretenberg/ecc/fields/ifma_limbs.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+
+namespace bb::crypto {
+namespace {
+
+#ifdef BB_IFMA_LIMBS_KERNEL
+
+/**
+ * The IFMA kernel works in the representation of ifma_limbs: a field element x is held as x * 2^260 mod p (up to a
+ * small multiple of p) in five 52-bit limbs. No conditional subtractions are performed. With p < 2^254 this keeps
+ * every intermediate of the permutation below 25p, comfortably inside the 260 bits the limbs can hold, provided that
+ * the running sum of the internal rounds is reduced every round and the state once before the internal rounds.
+ */
+namespace ifma {
+
+using Params = Poseidon2Bn254ScalarFieldParams;
+using FF = Params::FF;
+using Permutation = Poseidon2Permutation<Params>;
+using State = Permutation::State;
+
+constexpr size_t t = Permutation::t;
+constexpr size_t NUM_LANES = Poseidon2BatchPermutation<Params>::NUM_LANES;
+using ifma_limbs::broadcast;
+using ifma_limbs::Element;
+using ifma_limbs::Limbs;
+using ifma_limbs::normalize;
+using ifma_limbs::NUM_LIMBS;
+static_assert(t == 4);
+
+struct Constants {
+    // 1 in the kernel domain: multiplying by it reduces a value without changing it
+    Limbs one;
+    std::array<std::array<Limbs, t>, Permutation::NUM_ROUNDS> round_constants;
+    std::array<Limbs, t> internal_matrix_diagonal;
+};
+
+const Constants& constants()
+{
+    static const Constants constants = []() {
+        Constants result{};
+        result.one = ifma_limbs::to_limbs_domain(FF::one());
+        for (size_t round = 0; round < Permutation::NUM_ROUNDS; ++round) {
+            for (size_t i = 0; i < t; ++i) {
+                result.round_constants[round][i] = ifma_limbs::to_limbs_domain(Permutation::round_constants[round][i]);
+            }
+        }
+        for (size_t i = 0; i < t; ++i) {
+            result.internal_matrix_diagonal[i] = ifma_limbs::to_limbs_domain(Permutation::internal_matrix_diagonal[i]);
+        }
+        return result;
+    }();
+    return constants;
+}
+
+// Limb-wise addition; the result has to be normalised before it is multiplied
+BB_IFMA_INLINE void add(Element& x, const Element& y)
+{
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        x[i] = _mm512_add_epi64(x[i], y[i]);
+    }
+}
+
+struct Kernel {
+    Element modulus;
+    __m512i modulus_inverse;
+
+    BB_IFMA_INLINE Element mul(const Element& a, const Element& b) const
+    {
+        return ifma_limbs::montgomery_mul(a, b, modulus, modulus_inverse);
+    }
+
+    BB_IFMA_INLINE void apply_single_sbox(Element& x) const
+    {
+        normalize(x);
+        const Element xx = mul(x, x);
+        const Element xxxx = mul(xx, xx);
+        x = mul(xxxx, x);
+    }
+
+    // See Poseidon2Permutation::matrix_multiplication_4x4
+    BB_IFMA_INLINE static void matrix_multiplication_external(std::array<Element, t>& s)
+    {
+        Element t0 = s[0];
+        add(t0, s[1]);
+        Element t1 = s[2];
+        add(t1, s[3]);
+        Element t2 = s[1];
+        add(t2, s[1]);
+        add(t2, t1);
+        Element t3 = s[3];
+        add(t3, s[3]);
+        add(t3, t0);
+        Element t4 = t1;
+        add(t4, t1);
+        add(t4, t4);
+        add(t4, t3);
+        Element t5 = t0;
+        add(t5, t0);
+        add(t5, t5);
+        add(t5, t2);
+        Element t6 = t3;
+        add(t6, t5);
+        Element t7 = t2;
+        add(t7, t4);
+        s[0] = t6;
+        s[1] = t5;
+        s[2] = t7;
+        s[3] = t4;
+        for (auto& element : s) {
+            normalize(element);
+        }
+    }
+
+    BB_IFMA_INLINE void external_round(std::array<Element, t>& s, const std::array<Limbs, t>& round_constants) const
+    {
+        for (size_t i = 0; i < t; ++i) {
+            add(s[i], broadcast(round_constants[i]));
+            apply_single_sbox(s[i]);
+        }
+        matrix_multiplication_external(s);
+    }
+
+    BB_IFMA_INLINE void internal_round(std::array<Element, t>& s,
+                                       const Limbs& round_constant,
+                                       const std::array<Element, t>& diagonal,
+                                       const Element& one) const
+    {
+        add(s[0], broadcast(round_constant));
+        apply_single_sbox(s[0]);
+        Element sum = s[0];
+        for (size_t i = 1; i < t; ++i) {
+            add(sum, s[i]);
+        }
+        normalize(sum);
+        sum = mul(sum, one);
+        for (size_t i = 0; i < t; ++i) {
+            normalize(s[i]);
+            s[i] = mul(s[i], diagonal[i]);
+            add(s[i], sum);
+        }
+    }
+};
+
+// Permute NUM_LANES consecutive states
+BB_IFMA_TARGET void permute_lanes(State* states)
+{
+    const Constants& c = constants();
+    const auto& field_constants = ifma_limbs::Constants<FF>::get();
+    const Kernel kernel{ .modulus = broadcast(field_constants.modulus),
+                         .modulus_inverse = _mm512_set1_epi64(static_cast<int64_t>(field_constants.modulus_inverse)) };
+    const Element one = broadcast(c.one);
+    std::array<Element, t> diagonal;
+    for (size_t i = 0; i < t; ++i) {
+        diagonal[i] = broadcast(c.internal_matrix_diagonal[i]);
+    }
+
+    // Transpose the states into one vector per limb of every element
+    alignas(64) std::array<std::array<std::array<uint64_t, NUM_LANES>, NUM_LIMBS>, t> transposed;
+    for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+        for (size_t i = 0; i < t; ++i) {
+            const Limbs limbs = ifma_limbs::to_limbs(states[lane][i].data);
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                transposed[i][j][lane] = limbs[j];
+            }
+        }
+    }
+    const Element from_field = broadcast(field_constants.from_field);
+    std::array<Element, t> s;
+    for (size_t i = 0; i < t; ++i) {
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            s[i][j] = _mm512_load_si512(transposed[i][j].data());
+        }
+        s[i] = kernel.mul(s[i], from_field);
+    }
+
+    Kernel::matrix_multiplication_external(s);
+    constexpr size_t rounds_f_beginning = Permutation::rounds_f / 2;
+    for (size_t round = 0; round < rounds_f_beginning; ++round) {
+        kernel.external_round(s, c.round_constants[round]);
+    }
+    // The external rounds leave the state below 24p; bring it back below 2p before the sums of the internal rounds
+    for (auto& element : s) {
+        element = kernel.mul(element, one);
+    }
+    const size_t p_end = rounds_f_beginning + Permutation::rounds_p;
+    for (size_t round = rounds_f_beginning; round < p_end; ++round) {
+        kernel.internal_round(s, c.round_constants[round][0], diagonal, one);
+    }
+    for (auto& element : s) {
+        normalize(element);
+    }
+    for (size_t round = p_end; round < Permutation::NUM_ROUNDS; ++round) {
+        kernel.external_round(s, c.round_constants[round]);
+    }
+
+    const Element to_field = broadcast(field_constants.to_field);
+    for (size_t i = 0; i < t; ++i) {
+        s[i] = kernel.mul(s[i], to_field);
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            _mm512_store_si512(transposed[i][j].data(), s[i][j]);
+        }
+    }
+    for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+        for (size_t i = 0; i < t; ++i) {
+            Limbs limbs;
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                limbs[j] = transposed[i][j][lane];
+            }
+            // The output of the last multiplication is below 2p
+            ifma_limbs::from_limbs(limbs, states[lane][i].data);
+            states[lane][i].self_reduce_once();
+        }
+    }
+}
+
+} // namespace ifma
+
+#endif
+
+} // namespace
+
+template <typename Params> bool Poseidon2BatchPermutation<Params>::is_vectorized()
+{
+    return std::same_as<Params, Poseidon2Bn254ScalarFieldParams> && ifma_limbs::ifma_supported();
+}
+
+template <typename Params> void Poseidon2BatchPermutation<Params>::permute(std::span<State> states)
+{
+    size_t start = 0;
+#ifdef BB_IFMA_LIMBS_KERNEL
+    if constexpr (std::same_as<Params, Poseidon2Bn254ScalarFieldParams>) {
+        if (ifma_limbs::ifma_supported()) {
+            for (; start + NUM_LANES <= states.size(); start += NUM_LANES) {
+                ifma::permute_lanes(&states[start]);
+            }
+        }
+    }
+#endif
+    for (size_t i = start; i < states.size(); ++i) {
+        states[i] = Poseidon2Permutation<Params>::permutation(states[i]);
+    }
+}
+
+template class Poseidon2BatchPermutation<Poseidon2Bn254ScalarFieldParams>;
+} // namespace bb::crypto
@@ -0,0 +1,46 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+
+#include "poseidon2_params.hpp"
+#include "poseidon2_permutation.hpp"
+
+#include <span>
+
+namespace bb::crypto {
+
+/**
+ * @brief Applies the Poseidon2 permutation to many independent states at once.
+ * @details On x86-64 CPUs with AVX-512 IFMA, BN254 states are permuted eight at a time, one per SIMD lane: the states
+ * are transposed into a structure-of-arrays layout of 52-bit limbs and every round is evaluated for all lanes with
+ * 52-bit multiply-accumulate instructions. The kernel is selected at runtime, so binaries built for a generic target
+ * still use it. Without it, and for the states left over when their number is not a multiple of the lane count, each
+ * state goes through Poseidon2Permutation::permutation.
+ *
+ * Results are identical to Poseidon2Permutation::permutation up to the representation of the field elements (which may
+ * differ by a multiple of the modulus, as everywhere else in the field code).
+ */
+template <typename Params> class Poseidon2BatchPermutation {
+  public:
+    using State = typename Poseidon2Permutation<Params>::State;
+
+    // Number of states the vector kernel permutes at a time
+    static constexpr size_t NUM_LANES = 8;
+
+    /**
+     * @brief Permute each of `states` in place
+     */
+    static void permute(std::span<State> states);
+
+    /**
+     * @brief Whether permute() runs the vector kernel on this machine
+     */
+    static bool is_vectorized();
+};
+
+extern template class Poseidon2BatchPermutation<Poseidon2Bn254ScalarFieldParams>;
+} // namespace bb::crypto
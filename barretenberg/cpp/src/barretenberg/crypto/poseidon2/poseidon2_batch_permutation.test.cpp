@@ -0,0 +1,81 @@
+#include "poseidon2_batch_permutation.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2_params.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+using Params = crypto::Poseidon2Bn254ScalarFieldParams;
+using Permutation = crypto::Poseidon2Permutation<Params>;
+using BatchPermutation = crypto::Poseidon2BatchPermutation<Params>;
+using State = Permutation::State;
+} // namespace
+
+TEST(Poseidon2BatchPermutation, TestVectors)
+{
+    std::vector<State> states(BatchPermutation::NUM_LANES, Params::TEST_VECTOR_INPUT);
+    BatchPermutation::permute(states);
+    for (const auto& state : states) {
+        EXPECT_EQ(state, Params::TEST_VECTOR_OUTPUT);
+    }
+}
+
+// A number of states that is not a multiple of the lane count exercises the vector kernel and the scalar tail
+TEST(Poseidon2BatchPermutation, MatchesScalarPermutation)
+{
+    constexpr size_t num_states = 5 * BatchPermutation::NUM_LANES + 3;
+    std::vector<State> states(num_states);
+    for (auto& state : states) {
+        for (auto& element : state) {
+            element = fr::random_element(&engine);
+        }
+    }
+    std::vector<State> expected(num_states);
+    for (size_t i = 0; i < num_states; ++i) {
+        expected[i] = Permutation::permutation(states[i]);
+    }
+
+    BatchPermutation::permute(states);
+
+    for (size_t i = 0; i < num_states; ++i) {
+        EXPECT_EQ(states[i], expected[i]);
+    }
+    // Record which kernel ran in the test report rather than the log
+    RecordProperty("vectorized", BatchPermutation::is_vectorized() ? "true" : "false");
+}
+
+// Extreme inputs, including Montgomery forms that are not fully reduced, must not overflow the limbs of the kernel
+TEST(Poseidon2BatchPermutation, EdgeCaseInputs)
+{
+    const uint256_t modulus = fr::modulus;
+    const std::array<fr, 6> edge_cases{
+        fr::zero(),
+        fr::one(),
+        fr(modulus - 1),
+        fr::neg_one(),
+        // 2p - 1, the largest representation the field code produces
+        fr((modulus + modulus - 1).data[0], (modulus + modulus - 1).data[1], (modulus + modulus - 1).data[2],
+           (modulus + modulus - 1).data[3]),
+        // p, a non-reduced representation of zero
+        fr(modulus.data[0], modulus.data[1], modulus.data[2], modulus.data[3]),
+    };
+    std::vector<State> states;
+    for (const auto& a : edge_cases) {
+        for (const auto& b : edge_cases) {
+            states.push_back({ a, b, b, a });
+        }
+    }
+    std::vector<State> expected(states.size());
+    for (size_t i = 0; i < states.size(); ++i) {
+        expected[i] = Permutation::permutation(states[i]);
+    }
+
+    BatchPermutation::permute(states);
+
+    for (size_t i = 0; i < states.size(); ++i) {
+        EXPECT_EQ(states[i], expected[i]);
+    }
+}
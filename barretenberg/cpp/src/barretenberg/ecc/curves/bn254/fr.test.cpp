@@ -361,6 +361,28 @@ TEST(fr, BatchInvert)
     }
 }
 
+// Long enough to be split into several chunks, with zeroes that have to be skipped in every chunk
+TEST(fr, ParallelBatchInvert)
+{
+    size_t n = (1 << 14) + 3;
+    std::vector<fr> coeffs(n);
+    for (size_t i = 0; i < n; ++i) {
+        coeffs[i] = (i % 1000 == 0) ? fr::zero() : fr::random_element();
+    }
+    for (size_t num_threads : std::vector<size_t>{ 0, 1, 3, 8 }) {
+        std::vector<fr> inverses = coeffs;
+        fr::parallel_batch_invert(inverses, num_threads);
+
+        for (size_t i = 0; i < n; ++i) {
+            if (coeffs[i].is_zero()) {
+                EXPECT_TRUE(inverses[i].is_zero());
+            } else {
+                EXPECT_EQ(coeffs[i] * inverses[i], fr::one());
+            }
+        }
+    }
+}
+
 TEST(fr, MultiplicativeGenerator)
 {
     EXPECT_EQ(fr::multiplicative_generator(), fr(5));
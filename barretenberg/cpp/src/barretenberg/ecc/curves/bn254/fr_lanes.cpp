@@ -0,0 +1,347 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#include "fr_lanes.hpp"
+#include "barretenberg/ecc/fields/ifma_limbs.hpp"
+
+namespace bb {
+namespace {
+
+/**
+ * Both kernels below compute exactly the same limbs: every lane holds a value below 2p, with four 52-bit limbs and the
+ * rest in the top one. Sums and differences are brought back below 2p with a conditional addition or subtraction of 2p.
+ * Products are the Montgomery products of ifma_limbs, below 2p.
+ */
+constexpr size_t NUM_LANES = FrLanes::NUM_LANES;
+using ifma_limbs::LIMB_BITS;
+using ifma_limbs::LIMB_MASK;
+using ifma_limbs::NUM_LIMBS;
+static_assert(FrLanes::NUM_LIMBS == NUM_LIMBS);
+
+using Limbs = FrLanes::Limbs;
+using ElementLimbs = ifma_limbs::Limbs;
+
+const ifma_limbs::Constants<fr>& constants()
+{
+    return ifma_limbs::Constants<fr>::get();
+}
+
+Limbs broadcast(const ElementLimbs& element)
+{
+    Limbs result;
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        result[i].fill(element[i]);
+    }
+    return result;
+}
+
+namespace scalar {
+
+void add(Limbs& r, const Limbs& a, const Limbs& b)
+{
+    const ElementLimbs& twice_modulus = constants().twice_modulus;
+    for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+        ElementLimbs sum;
+        uint64_t carry = 0;
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            sum[i] = a[i][lane] + b[i][lane] + carry;
+            carry = i + 1 < NUM_LIMBS ? sum[i] >> LIMB_BITS : 0;
+            sum[i] = i + 1 < NUM_LIMBS ? sum[i] & LIMB_MASK : sum[i];
+        }
+        ElementLimbs difference;
+        int64_t borrow = 0;
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            const auto limb = static_cast<int64_t>(sum[i] - twice_modulus[i] + static_cast<uint64_t>(borrow));
+            borrow = limb >> LIMB_BITS;
+            difference[i] = i + 1 < NUM_LIMBS ? static_cast<uint64_t>(limb) & LIMB_MASK : static_cast<uint64_t>(limb);
+        }
+        const bool negative = static_cast<int64_t>(difference[NUM_LIMBS - 1]) < 0;
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            r[i][lane] = negative ? sum[i] : difference[i];
+        }
+    }
+}
+
+void sub(Limbs& r, const Limbs& a, const Limbs& b)
+{
+    const ElementLimbs& twice_modulus = constants().twice_modulus;
+    for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+        ElementLimbs difference;
+        int64_t borrow = 0;
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            const auto limb = static_cast<int64_t>(a[i][lane] - b[i][lane] + static_cast<uint64_t>(borrow));
+            borrow = limb >> LIMB_BITS;
+            difference[i] = i + 1 < NUM_LIMBS ? static_cast<uint64_t>(limb) & LIMB_MASK : static_cast<uint64_t>(limb);
+        }
+        ElementLimbs sum;
+        uint64_t carry = 0;
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            sum[i] = difference[i] + twice_modulus[i] + carry;
+            carry = i + 1 < NUM_LIMBS ? sum[i] >> LIMB_BITS : 0;
+            sum[i] = i + 1 < NUM_LIMBS ? sum[i] & LIMB_MASK : sum[i];
+        }
+        const bool negative = static_cast<int64_t>(difference[NUM_LIMBS - 1]) < 0;
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            r[i][lane] = negative ? sum[i] : difference[i];
+        }
+    }
+}
+
+void mul(Limbs& r, const Limbs& a, const Limbs& b)
+{
+    const auto& c = constants();
+    for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+        ElementLimbs x;
+        ElementLimbs y;
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            x[i] = a[i][lane];
+            y[i] = b[i][lane];
+        }
+        const ElementLimbs product = ifma_limbs::montgomery_mul(x, y, c.modulus, c.modulus_inverse);
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            r[i][lane] = product[i];
+        }
+    }
+}
+
+} // namespace scalar
+
+#ifdef BB_IFMA_LIMBS_KERNEL
+
+namespace ifma {
+
+using ifma_limbs::broadcast;
+using ifma_limbs::Element;
+using ifma_limbs::normalize;
+
+BB_IFMA_INLINE Element load(const Limbs& limbs)
+{
+    Element result;
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        result[i] = _mm512_loadu_si512(limbs[i].data());
+    }
+    return result;
+}
+
+BB_IFMA_INLINE void store(Limbs& limbs, const Element& x)
+{
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        _mm512_storeu_si512(limbs[i].data(), x[i]);
+    }
+}
+
+// The lanes of x, or of x + y in the lanes where x is negative
+BB_IFMA_INLINE Element add_if_negative(const Element& x, const Element& y)
+{
+    Element sum;
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        sum[i] = _mm512_add_epi64(x[i], y[i]);
+    }
+    normalize(sum);
+    const __mmask8 negative = _mm512_cmplt_epi64_mask(x[NUM_LIMBS - 1], _mm512_setzero_si512());
+    Element result;
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        result[i] = _mm512_mask_blend_epi64(negative, x[i], sum[i]);
+    }
+    return result;
+}
+
+BB_IFMA_TARGET void add(Limbs& r, const Limbs& a, const Limbs& b)
+{
+    const Element x = load(a);
+    const Element y = load(b);
+    const Element twice_modulus = broadcast(constants().twice_modulus);
+    Element sum;
+    Element difference;
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        sum[i] = _mm512_add_epi64(x[i], y[i]);
+    }
+    normalize(sum);
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        difference[i] = _mm512_sub_epi64(sum[i], twice_modulus[i]);
+    }
+    normalize(difference);
+    store(r, add_if_negative(difference, twice_modulus));
+}
+
+BB_IFMA_TARGET void sub(Limbs& r, const Limbs& a, const Limbs& b)
+{
+    const Element x = load(a);
+    const Element y = load(b);
+    Element difference;
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        difference[i] = _mm512_sub_epi64(x[i], y[i]);
+    }
+    normalize(difference);
+    store(r, add_if_negative(difference, broadcast(constants().twice_modulus)));
+}
+
+BB_IFMA_TARGET void mul(Limbs& r, const Limbs& a, const Limbs& b)
+{
+    const auto& c = constants();
+    const __m512i modulus_inverse = _mm512_set1_epi64(static_cast<int64_t>(c.modulus_inverse));
+    store(r, ifma_limbs::montgomery_mul(load(a), load(b), broadcast(c.modulus), modulus_inverse));
+}
+
+} // namespace ifma
+
+#define BB_FR_LANES_DISPATCH(op, ...)                                                                                  \
+    if (ifma_limbs::ifma_supported()) {                                                                                \
+        ifma::op(__VA_ARGS__);                                                                                         \
+    } else {                                                                                                           \
+        scalar::op(__VA_ARGS__);                                                                                       \
+    }
+
+#else
+
+#define BB_FR_LANES_DISPATCH(op, ...) scalar::op(__VA_ARGS__);
+
+#endif
+
+} // namespace
+
+FrLanes::FrLanes(const fr& value)
+    : limbs(broadcast(ifma_limbs::to_limbs_domain(value)))
+{}
+
+FrLanes FrLanes::zero()
+{
+    FrLanes result;
+    result.limbs = {};
+    return result;
+}
+
+FrLanes FrLanes::one()
+{
+    return FrLanes(fr::one());
+}
+
+FrLanes FrLanes::random_element(numeric::RNG* engine)
+{
+    std::array<fr, NUM_LANES> values;
+    for (auto& value : values) {
+        value = fr::random_element(engine);
+    }
+    return from_lanes(values);
+}
+
+FrLanes FrLanes::from_lanes(const std::array<fr, NUM_LANES>& values)
+{
+    FrLanes result;
+    for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+        // The field code keeps its elements below 2p < 2^255
+        const ElementLimbs element = ifma_limbs::to_limbs(values[lane].data);
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            result.limbs[i][lane] = element[i];
+        }
+    }
+    const Limbs from_field = broadcast(constants().from_field);
+    BB_FR_LANES_DISPATCH(mul, result.limbs, result.limbs, from_field);
+    return result;
+}
+
+std::array<fr, FrLanes::NUM_LANES> FrLanes::to_lanes() const
+{
+    Limbs field_limbs;
+    const Limbs to_field = broadcast(constants().to_field);
+    BB_FR_LANES_DISPATCH(mul, field_limbs, limbs, to_field);
+    std::array<fr, NUM_LANES> values;
+    for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+        ElementLimbs element;
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            element[i] = field_limbs[i][lane];
+        }
+        ifma_limbs::from_limbs(element, values[lane].data);
+        values[lane].self_reduce_once();
+    }
+    return values;
+}
+
+FrLanes FrLanes::operator+(const FrLanes& other) const
+{
+    FrLanes result;
+    BB_FR_LANES_DISPATCH(add, result.limbs, limbs, other.limbs);
+    return result;
+}
+
+FrLanes FrLanes::operator-(const FrLanes& other) const
+{
+    FrLanes result;
+    BB_FR_LANES_DISPATCH(sub, result.limbs, limbs, other.limbs);
+    return result;
+}
+
+FrLanes FrLanes::operator*(const FrLanes& other) const
+{
+    FrLanes result;
+    BB_FR_LANES_DISPATCH(mul, result.limbs, limbs, other.limbs);
+    return result;
+}
+
+FrLanes FrLanes::operator-() const
+{
+    return zero() - *this;
+}
+
+FrLanes& FrLanes::operator+=(const FrLanes& other)
+{
+    BB_FR_LANES_DISPATCH(add, limbs, limbs, other.limbs);
+    return *this;
+}
+
+FrLanes& FrLanes::operator-=(const FrLanes& other)
+{
+    BB_FR_LANES_DISPATCH(sub, limbs, limbs, other.limbs);
+    return *this;
+}
+
+FrLanes& FrLanes::operator*=(const FrLanes& other)
+{
+    BB_FR_LANES_DISPATCH(mul, limbs, limbs, other.limbs);
+    return *this;
+}
+
+FrLanes FrLanes::sqr() const
+{
+    return *this * *this;
+}
+
+void FrLanes::self_sqr()
+{
+    *this *= *this;
+}
+
+bool FrLanes::is_zero() const
+{
+    // A lane below 2p is zero if it holds 0 or p
+    const ElementLimbs& modulus = constants().modulus;
+    for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+        bool is_zero = true;
+        bool is_modulus = true;
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            is_zero = is_zero && limbs[i][lane] == 0;
+            is_modulus = is_modulus && limbs[i][lane] == modulus[i];
+        }
+        if (!is_zero && !is_modulus) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FrLanes::operator==(const FrLanes& other) const
+{
+    return (*this - other).is_zero();
+}
+
+bool FrLanes::is_vectorized()
+{
+    return ifma_limbs::ifma_supported();
+}
+
+#undef BB_FR_LANES_DISPATCH
+
+} // namespace bb
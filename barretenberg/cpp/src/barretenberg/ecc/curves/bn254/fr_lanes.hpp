@@ -0,0 +1,79 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+
+#include "fr.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+namespace bb {
+
+/**
+ * @brief FrLanes::NUM_LANES independent elements of the BN254 scalar field, on which the arithmetic acts lane by lane.
+ * @details Code written against the interface of bb::fr, such as the relations evaluated on bb::Univariate, can be
+ * instantiated with FrLanes to process several inputs at once: bb::Univariate<FrLanes, N> holds N evaluations of
+ * NUM_LANES univariates.
+ *
+ * The lanes are stored limb-major in the representation of ifma_limbs (see ecc/fields/ifma_limbs.hpp), shared with
+ * crypto::Poseidon2BatchPermutation: x is held as x * 2^260 mod p, below 2p, in five 52-bit limbs. On x86-64 CPUs with
+ * AVX-512 IFMA, every operation acts on all lanes with a handful of vector instructions; the kernel is selected at
+ * runtime. Elsewhere the same computation runs limb by limb on general purpose registers, which gives identical results
+ * but is much slower than bb::fr, so callers should only prefer FrLanes to bb::fr when is_vectorized() holds.
+ */
+class FrLanes {
+  public:
+    static constexpr size_t NUM_LANES = 8;
+    static constexpr size_t NUM_LIMBS = 5;
+
+    using Limbs = std::array<std::array<uint64_t, NUM_LANES>, NUM_LIMBS>;
+
+    // Uninitialised, as bb::fr
+    FrLanes() noexcept {} // NOLINT(cppcoreguidelines-pro-type-member-init)
+
+    // Every lane set to value
+    FrLanes(const fr& value); // NOLINT(google-explicit-constructor)
+    template <std::integral T>
+    FrLanes(T value) // NOLINT(google-explicit-constructor)
+        : FrLanes(fr(value))
+    {}
+
+    static FrLanes zero();
+    static FrLanes one();
+    static FrLanes random_element(numeric::RNG* engine = nullptr);
+
+    static FrLanes from_lanes(const std::array<fr, NUM_LANES>& values);
+    std::array<fr, NUM_LANES> to_lanes() const;
+
+    FrLanes operator+(const FrLanes& other) const;
+    FrLanes operator-(const FrLanes& other) const;
+    FrLanes operator*(const FrLanes& other) const;
+    FrLanes operator-() const;
+
+    FrLanes& operator+=(const FrLanes& other);
+    FrLanes& operator-=(const FrLanes& other);
+    FrLanes& operator*=(const FrLanes& other);
+
+    FrLanes sqr() const;
+    void self_sqr();
+
+    // Whether every lane is zero
+    bool is_zero() const;
+    bool operator==(const FrLanes& other) const;
+
+    /**
+     * @brief Whether the arithmetic runs the vector kernel on this machine
+     */
+    static bool is_vectorized();
+
+  private:
+    Limbs limbs;
+};
+
+} // namespace bb
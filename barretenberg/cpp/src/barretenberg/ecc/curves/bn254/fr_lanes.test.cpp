@@ -0,0 +1,80 @@
+#include "fr_lanes.hpp"
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+namespace {
+
+auto& engine = numeric::get_debug_randomness();
+
+// Random lanes, along with the values the lazy reduction is most likely to get wrong
+std::array<fr, FrLanes::NUM_LANES> get_lanes()
+{
+    std::array<fr, FrLanes::NUM_LANES> values;
+    for (auto& value : values) {
+        value = fr::random_element(&engine);
+    }
+    values[0] = fr::zero();
+    values[1] = fr::one();
+    values[2] = -fr::one();
+    values[3] = fr(uint256_t(fr::modulus) - 2);
+    return values;
+}
+
+} // namespace
+
+TEST(FrLanes, RoundTrip)
+{
+    const auto values = get_lanes();
+    EXPECT_EQ(FrLanes::from_lanes(values).to_lanes(), values);
+    for (const auto& value : FrLanes(values[2]).to_lanes()) {
+        EXPECT_EQ(value, values[2]);
+    }
+}
+
+TEST(FrLanes, Arithmetic)
+{
+    for (size_t i = 0; i < 32; ++i) {
+        const auto a = get_lanes();
+        auto b = get_lanes();
+        std::reverse(b.begin(), b.end());
+        const FrLanes x = FrLanes::from_lanes(a);
+        const FrLanes y = FrLanes::from_lanes(b);
+
+        const auto sum = (x + y).to_lanes();
+        const auto difference = (x - y).to_lanes();
+        const auto product = (x * y).to_lanes();
+        const auto negation = (-x).to_lanes();
+        const auto square = x.sqr().to_lanes();
+        FrLanes z = x;
+        z *= y;
+        z += x;
+        z -= y;
+        const auto compound = z.to_lanes();
+        for (size_t lane = 0; lane < FrLanes::NUM_LANES; ++lane) {
+            EXPECT_EQ(sum[lane], a[lane] + b[lane]);
+            EXPECT_EQ(difference[lane], a[lane] - b[lane]);
+            EXPECT_EQ(product[lane], a[lane] * b[lane]);
+            EXPECT_EQ(negation[lane], -a[lane]);
+            EXPECT_EQ(square[lane], a[lane].sqr());
+            EXPECT_EQ(compound[lane], a[lane] * b[lane] + a[lane] - b[lane]);
+        }
+    }
+}
+
+TEST(FrLanes, IsZero)
+{
+    EXPECT_TRUE(FrLanes::zero().is_zero());
+    EXPECT_FALSE(FrLanes::one().is_zero());
+
+    const FrLanes x = FrLanes::random_element(&engine);
+    EXPECT_TRUE((x - x).is_zero());
+    // Lanes that hold p rather than 0
+    EXPECT_TRUE((x + (-x)).is_zero());
+    EXPECT_EQ(x * FrLanes(fr(2)), x + x);
+
+    auto values = get_lanes();
+    values.fill(fr::zero());
+    values[5] = fr::one();
+    EXPECT_FALSE(FrLanes::from_lanes(values).is_zero());
+}
@@ -342,6 +342,15 @@ template <class Params_> struct alignas(32) field {
     constexpr field invert() const noexcept;
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, size_t n) noexcept;
+    /**
+     * @brief Multithreaded batch_invert, for long spans
+     * @details The span is split into chunks that are inverted in parallel, each with a batch inversion (and hence a
+     * field inversion) of its own. Zeroes are skipped, as by batch_invert. Short spans are inverted on the calling
+     * thread.
+     *
+     * @param num_threads the maximum number of chunks to split the span into; 0 for the size of the thread pool
+     */
+    static void parallel_batch_invert(std::span<field> coeffs, size_t num_threads = 0);
     /**
      * @brief Compute square root of the field element.
      *
@@ -7,9 +7,11 @@
 #pragma once
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
+#include <algorithm>
 #include <memory>
 #include <span>
 #include <type_traits>
@@ -460,6 +462,28 @@ template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
     }
 }
 
+template <class T> void field<T>::parallel_batch_invert(std::span<field> coeffs, size_t num_threads)
+{
+    PROFILE_THIS_NAME("fr::parallel_batch_invert");
+    // A chunk costs an inversion of its own, i.e. a few hundred multiplications, on top of three per element
+    constexpr size_t MIN_CHUNK_SIZE = 1 << 12;
+    const size_t n = coeffs.size();
+    if (num_threads == 0) {
+        num_threads = get_num_cpus();
+    }
+    num_threads = std::min(num_threads, n / MIN_CHUNK_SIZE);
+    if (num_threads <= 1) {
+        batch_invert(coeffs);
+        return;
+    }
+    const size_t chunk_size = (n + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t chunk_idx) {
+        const size_t start = chunk_idx * chunk_size;
+        const size_t end = std::min(start + chunk_size, n);
+        batch_invert(coeffs.subspan(start, end - start));
+    });
+}
+
 /**
  * @brief Implements an optimised variant of Tonelli-Shanks via lookup tables.
  * Algorithm taken from https://cr.yp.to/papers/sqroot-20011123-retypeset20220327.pdf
@@ -0,0 +1,221 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+
+#include "barretenberg/numeric/uint256/uint256.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define BB_IFMA_LIMBS_KERNEL 1
+#include <immintrin.h>
+#endif
+
+/**
+ * Field arithmetic in five 52-bit limbs, the layout of the AVX-512 IFMA multiply-accumulate instructions, shared by the
+ * vector kernels of FrLanes and crypto::Poseidon2BatchPermutation.
+ *
+ * A field element x is represented by x * 2^260 mod p (up to a small multiple of p), as 5 * 52 = 260. Products are
+ * reduced with Montgomery multiplication by 2^-260, whose output is below a * b / 2^260 + p; as p < 2^254, that is
+ * below 2p for inputs below 2p. The field code uses R = 2^256, so the representation of x is the Montgomery form of
+ * 16x.
+ */
+namespace bb::ifma_limbs {
+
+constexpr size_t NUM_LIMBS = 5;
+constexpr uint64_t LIMB_BITS = 52;
+constexpr uint64_t LIMB_MASK = (uint64_t(1) << LIMB_BITS) - 1;
+
+using Limbs = std::array<uint64_t, NUM_LIMBS>;
+
+// Split a 256-bit integer into 52-bit limbs
+inline Limbs to_limbs(const uint64_t* data)
+{
+    return { data[0] & LIMB_MASK,
+             ((data[0] >> 52) | (data[1] << 12)) & LIMB_MASK,
+             ((data[1] >> 40) | (data[2] << 24)) & LIMB_MASK,
+             ((data[2] >> 28) | (data[3] << 36)) & LIMB_MASK,
+             data[3] >> 16 };
+}
+
+// Inverse of to_limbs; the limbs must be normalised and hold a value below 2^256
+inline void from_limbs(const Limbs& limbs, uint64_t* data)
+{
+    data[0] = limbs[0] | (limbs[1] << 52);
+    data[1] = (limbs[1] >> 12) | (limbs[2] << 40);
+    data[2] = (limbs[2] >> 24) | (limbs[3] << 28);
+    data[3] = (limbs[3] >> 36) | (limbs[4] << 16);
+}
+
+// The representation of x, below 2p
+template <typename FF> Limbs to_limbs_domain(const FF& x)
+{
+    static_assert(FF::modulus.get_msb() < 254);
+    return to_limbs((x * FF(16)).reduce_once().data);
+}
+
+template <typename FF> struct Constants {
+    Limbs modulus;
+    Limbs twice_modulus;
+    // -p^{-1} mod 2^52
+    uint64_t modulus_inverse;
+    // 2^264 mod p: multiplying the Montgomery form x * 2^256 of a field element by it gives x * 2^260
+    Limbs from_field;
+    // 2^256 mod p: multiplying x * 2^260 by it gives back the Montgomery form of the field code
+    Limbs to_field;
+
+    static const Constants& get()
+    {
+        static const Constants constants = []() {
+            Constants result{};
+            const uint256_t modulus = FF::modulus;
+            const uint256_t twice_modulus = modulus + modulus;
+            result.modulus = to_limbs(modulus.data);
+            result.twice_modulus = to_limbs(twice_modulus.data);
+            result.modulus_inverse = FF::Params::r_inv & LIMB_MASK;
+            result.from_field = to_limbs(FF(256).reduce_once().data);
+            result.to_field = to_limbs(FF::one().reduce_once().data);
+            return result;
+        }();
+        return constants;
+    }
+};
+
+// Add the low and the high 52 bits of the product of the low 52 bits of a and b to lo and hi, as the IFMA instructions
+inline void madd52(uint64_t& lo, uint64_t& hi, uint64_t a, uint64_t b)
+{
+    __extension__ using uint128_t = unsigned __int128;
+    const auto product = static_cast<uint128_t>(a & LIMB_MASK) * static_cast<uint128_t>(b & LIMB_MASK);
+    lo += static_cast<uint64_t>(product) & LIMB_MASK;
+    hi += static_cast<uint64_t>(product >> LIMB_BITS);
+}
+
+/**
+ * @brief Montgomery multiplication a * b * 2^-260 of normalised inputs, with a normalised output
+ * @details Spells out on general purpose registers the multiply-accumulate instructions of the vector version below,
+ * which it matches limb for limb.
+ */
+inline Limbs montgomery_mul(const Limbs& a, const Limbs& b, const Limbs& modulus, uint64_t modulus_inverse)
+{
+    std::array<uint64_t, NUM_LIMBS + 1> acc{};
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            madd52(acc[j], acc[j + 1], a[j], b[i]);
+        }
+        const uint64_t m = ((acc[0] & LIMB_MASK) * modulus_inverse) & LIMB_MASK;
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            madd52(acc[j], acc[j + 1], m, modulus[j]);
+        }
+        acc[1] += acc[0] >> LIMB_BITS;
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            acc[j] = acc[j + 1];
+        }
+        acc[NUM_LIMBS] = 0;
+    }
+    Limbs result;
+    for (size_t i = 0; i + 1 < NUM_LIMBS; ++i) {
+        acc[i + 1] += acc[i] >> LIMB_BITS;
+        result[i] = acc[i] & LIMB_MASK;
+    }
+    result[NUM_LIMBS - 1] = acc[NUM_LIMBS - 1];
+    return result;
+}
+
+#ifdef BB_IFMA_LIMBS_KERNEL
+
+#define BB_IFMA_TARGET __attribute__((target("avx512f,avx512ifma")))
+#define BB_IFMA_INLINE __attribute__((target("avx512f,avx512ifma"), always_inline)) inline
+
+// The unmasked shifts trip -Wuninitialized in some versions of GCC's headers
+constexpr __mmask8 ALL_LANES = 0xff;
+
+// One field element per lane of a vector, limb-major
+struct Element {
+    __m512i limbs[NUM_LIMBS]; // NOLINT
+
+    BB_IFMA_INLINE __m512i& operator[](size_t i) { return limbs[i]; }
+    BB_IFMA_INLINE const __m512i& operator[](size_t i) const { return limbs[i]; }
+};
+
+BB_IFMA_INLINE Element broadcast(const Limbs& limbs)
+{
+    Element result;
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        result[i] = _mm512_set1_epi64(static_cast<int64_t>(limbs[i]));
+    }
+    return result;
+}
+
+// Propagate the (signed) carries of x so that every limb but the top one fits in 52 bits
+BB_IFMA_INLINE void normalize(Element& x)
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    for (size_t i = 0; i + 1 < NUM_LIMBS; ++i) {
+        x[i + 1] = _mm512_add_epi64(x[i + 1], _mm512_maskz_srai_epi64(ALL_LANES, x[i], LIMB_BITS));
+        x[i] = _mm512_and_si512(x[i], mask);
+    }
+}
+
+/**
+ * @brief Montgomery multiplication a * b * 2^-260 of normalised inputs, with a normalised output
+ * @details Operand scanning: each iteration accumulates a * b[i], adds the multiple of p that clears the lowest limb
+ * and shifts the accumulator down one limb. The accumulator limbs collect at most twenty 52-bit products, so they
+ * never overflow 64 bits.
+ */
+BB_IFMA_INLINE Element montgomery_mul(const Element& a,
+                                      const Element& b,
+                                      const Element& modulus,
+                                      const __m512i& modulus_inverse)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i acc[NUM_LIMBS + 1]; // NOLINT
+    for (auto& limb : acc) {
+        limb = zero;
+    }
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            acc[j] = _mm512_madd52lo_epu64(acc[j], a[j], b[i]);
+            acc[j + 1] = _mm512_madd52hi_epu64(acc[j + 1], a[j], b[i]);
+        }
+        const __m512i m = _mm512_madd52lo_epu64(zero, acc[0], modulus_inverse);
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            acc[j] = _mm512_madd52lo_epu64(acc[j], m, modulus[j]);
+            acc[j + 1] = _mm512_madd52hi_epu64(acc[j + 1], m, modulus[j]);
+        }
+        // The low 52 bits of acc[0] are now zero
+        acc[1] = _mm512_add_epi64(acc[1], _mm512_maskz_srli_epi64(ALL_LANES, acc[0], LIMB_BITS));
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            acc[j] = acc[j + 1];
+        }
+        acc[NUM_LIMBS] = zero;
+    }
+    Element result;
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        result[i] = acc[i];
+    }
+    normalize(result);
+    return result;
+}
+
+inline bool ifma_supported()
+{
+    static const bool supported = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+    return supported;
+}
+
+#else
+
+inline bool ifma_supported()
+{
+    return false;
+}
+
+#endif
+
+} // namespace bb::ifma_limbs
@@ -16,6 +16,7 @@
 #include "barretenberg/polynomials/polynomial.hpp"
 
 #include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/op_count.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 
 namespace bb::scalar_multiplication {
@@ -863,6 +864,283 @@ typename Curve::AffineElement MSM<Curve>::msm(std::span<const typename Curve::Af
     return result;
 }
 
+/**
+ * @brief Given a scalar that is *NOT* in Montgomery form, extract the `slice_size`-bit window starting at `lo_bit`
+ * @details Unlike `get_scalar_slice`, windows are aligned to the least significant bit, which lets the fixed-base
+ *          table store one multiple per group of `num_rounds` consecutive windows.
+ *
+ * @tparam Curve
+ * @param scalar
+ * @param lo_bit
+ * @param slice_size
+ * @return uint32_t
+ */
+template <typename Curve>
+uint32_t MSM<Curve>::get_scalar_window(const typename Curve::ScalarField& scalar,
+                                       size_t lo_bit,
+                                       size_t slice_size) noexcept
+{
+    const size_t limb = lo_bit / 64;
+    const size_t offset = lo_bit & 63;
+    uint64_t window = scalar.data[limb] >> offset;
+    if ((offset + slice_size > 64) && (limb < 3)) {
+        window |= scalar.data[limb + 1] << (64 - offset);
+    }
+    return static_cast<uint32_t>(window & ((static_cast<uint64_t>(1) << slice_size) - 1));
+}
+
+/**
+ * @brief Choose the window size, number of rounds and number of multiples per base point for a fixed-base table
+ * @details Uses the same cost model as `get_optimal_log_num_buckets`, evaluated for the per-thread share of the base
+ *          points. Every (point, window) pair costs one bucket addition regardless of the table layout, so the table
+ *          only saves on bucket accumulation (and doublings) by reducing the number of rounds, which in turn permits a
+ *          larger window. If the budget cannot hold at least two multiples per point the table would be equivalent to
+ *          the raw points and `points_per_base` is left at zero.
+ *
+ * @tparam Curve
+ * @param num_bases
+ * @param memory_budget_bytes
+ * @return MSM<Curve>::FixedBaseTable with the parameters populated and no points
+ */
+template <typename Curve>
+typename MSM<Curve>::FixedBaseTable MSM<Curve>::get_fixed_base_table_parameters(
+    const size_t num_bases, const size_t memory_budget_bytes) noexcept
+{
+    constexpr size_t COST_OF_BUCKET_OP_RELATIVE_TO_POINT = 5;
+    // Bucket memory is allocated per thread, cap the window size so this stays in the tens of megabytes
+    constexpr size_t MAX_BITS_PER_SLICE = 20;
+
+    FixedBaseTable table;
+    table.num_bases = num_bases;
+    if (num_bases == 0) {
+        return table;
+    }
+    const size_t max_points_per_base = memory_budget_bytes / (num_bases * sizeof(AffineElement));
+    if (max_points_per_base < 2) {
+        return table;
+    }
+    const size_t points_per_thread = numeric::ceil_div(num_bases, get_num_cpus());
+
+    size_t cached_cost = static_cast<size_t>(-1);
+    for (size_t bit_slice = 1; bit_slice <= MAX_BITS_PER_SLICE; ++bit_slice) {
+        const size_t num_windows = numeric::ceil_div(NUM_BITS_IN_FIELD, bit_slice);
+        const size_t num_rounds = numeric::ceil_div(num_windows, std::min(num_windows, max_points_per_base));
+        // Spread the windows evenly over the rounds so that no multiple is stored without being used
+        const size_t points_per_base = numeric::ceil_div(num_windows, num_rounds);
+        const size_t addition_cost = num_rounds * points_per_base * points_per_thread;
+        const size_t bucket_cost = num_rounds * (1UL << bit_slice) * COST_OF_BUCKET_OP_RELATIVE_TO_POINT;
+        const size_t total_cost = addition_cost + bucket_cost;
+        if (points_per_base >= 2 && total_cost < cached_cost) {
+            cached_cost = total_cost;
+            table.bits_per_slice = bit_slice;
+            table.num_rounds = num_rounds;
+            table.points_per_base = points_per_base;
+        }
+    }
+    return table;
+}
+
+/**
+ * @brief Precompute the multiples 2^{j * num_rounds * bits_per_slice} * G_i of every base point for `fixed_base_msm`
+ *
+ * @tparam Curve
+ * @param points base points, e.g. a prefix of the SRS
+ * @param memory_budget_bytes upper bound on the size of the table
+ * @return MSM<Curve>::FixedBaseTable an empty table if the budget is too small to be useful
+ */
+template <typename Curve>
+typename MSM<Curve>::FixedBaseTable MSM<Curve>::compute_fixed_base_table(std::span<const AffineElement> points,
+                                                                         const size_t memory_budget_bytes) noexcept
+{
+    PROFILE_THIS_NAME("compute_fixed_base_table");
+    FixedBaseTable table = get_fixed_base_table_parameters(points.size(), memory_budget_bytes);
+    const size_t points_per_base = table.points_per_base;
+    if (points_per_base == 0) {
+        return table;
+    }
+    // The point schedule stores point indices in the high 32 bits of each entry
+    BB_ASSERT_LTE(points.size() * points_per_base, static_cast<size_t>(UINT32_MAX));
+    const size_t doublings_per_multiple = table.num_rounds * table.bits_per_slice;
+    table.points.resize(points.size() * points_per_base);
+
+    // Normalize in blocks so that the Jacobian scratch space stays small
+    constexpr size_t BASES_PER_BLOCK = 256;
+    parallel_for_range(points.size(), [&](size_t start, size_t end) {
+        std::vector<Element> multiples(BASES_PER_BLOCK * points_per_base);
+        for (size_t block_start = start; block_start < end; block_start += BASES_PER_BLOCK) {
+            const size_t block_end = std::min(end, block_start + BASES_PER_BLOCK);
+            const size_t num_multiples = (block_end - block_start) * points_per_base;
+            for (size_t i = block_start; i < block_end; ++i) {
+                Element* base_multiples = &multiples[(i - block_start) * points_per_base];
+                base_multiples[0] = points[i];
+                for (size_t j = 1; j < points_per_base; ++j) {
+                    base_multiples[j] = base_multiples[j - 1];
+                    for (size_t k = 0; k < doublings_per_multiple; ++k) {
+                        base_multiples[j].self_dbl();
+                    }
+                }
+            }
+            Element::batch_normalize(&multiples[0], num_multiples);
+            for (size_t i = 0; i < num_multiples; ++i) {
+                table.points[block_start * points_per_base + i] = AffineElement(multiples[i].x, multiples[i].y);
+            }
+        }
+    });
+    return table;
+}
+
+/**
+ * @brief Single-threaded Pippenger over a fixed-base table
+ * @details Each nonzero scalar contributes `points_per_base` entries to the point schedule of every round, so the
+ *          bucket additions are shared with `pippenger_low_memory_with_transformed_scalars` but there are only
+ *          `table.num_rounds` bucket accumulations.
+ *
+ * @tparam Curve
+ * @param table
+ * @param scalars scalars *NOT* in Montgomery form
+ * @param scalar_indices indices of the nonzero scalars handled by this call
+ * @param base_offset index of the base point that corresponds to scalars[0]
+ * @return Curve::Element
+ */
+template <typename Curve>
+typename Curve::Element MSM<Curve>::fixed_base_pippenger_with_transformed_scalars(
+    const FixedBaseTable& table,
+    std::span<const ScalarField> scalars,
+    std::span<const uint32_t> scalar_indices,
+    const size_t base_offset) noexcept
+{
+    const size_t bits_per_slice = table.bits_per_slice;
+    const size_t num_rounds = table.num_rounds;
+    const size_t points_per_base = table.points_per_base;
+    const size_t num_windows = numeric::ceil_div(NUM_BITS_IN_FIELD, bits_per_slice);
+    const size_t num_buckets = 1 << bits_per_slice;
+    const size_t num_entries = scalar_indices.size() * points_per_base;
+    std::span<const AffineElement> points = table.points;
+
+    const bool affine_trick = use_affine_trick(num_entries, num_buckets);
+    std::vector<uint64_t> point_schedule(num_entries);
+    std::optional<AffineAdditionData> affine_data;
+    std::optional<BucketAccumulators> bucket_data;
+    std::optional<JacobianBucketAccumulators> jacobian_bucket_data;
+    if (affine_trick) {
+        affine_data.emplace();
+        bucket_data.emplace(num_buckets);
+    } else {
+        jacobian_bucket_data.emplace(num_buckets);
+    }
+
+    Element result = Curve::Group::point_at_infinity;
+    // Process rounds from the most significant window of each table entry downwards
+    for (size_t round = num_rounds - 1; round < num_rounds; --round) {
+        // Construct the round schedule: low 32 bits hold the bucket index, high 32 bits the table index
+        for (size_t i = 0; i < scalar_indices.size(); ++i) {
+            const ScalarField& scalar = scalars[scalar_indices[i]];
+            const uint64_t table_offset = (base_offset + scalar_indices[i]) * points_per_base;
+            for (size_t j = 0; j < points_per_base; ++j) {
+                const size_t window_index = (j * num_rounds) + round;
+                uint64_t bucket_index = 0;
+                if (window_index < num_windows) {
+                    bucket_index = get_scalar_window(scalar, window_index * bits_per_slice, bits_per_slice);
+                }
+                point_schedule[(i * points_per_base) + j] = bucket_index + ((table_offset + j) << 32ULL);
+            }
+        }
+
+        Element round_output;
+        round_output.self_set_infinity();
+        if (affine_trick) {
+            const size_t num_zero_entries = scalar_multiplication::process_buckets_count_zero_entries(
+                &point_schedule[0], num_entries, static_cast<uint32_t>(bits_per_slice));
+            BB_ASSERT_LTE(num_zero_entries, num_entries);
+            const size_t round_size = num_entries - num_zero_entries;
+            if (round_size > 0) {
+                std::span<const uint64_t> round_schedule(&point_schedule[num_zero_entries], round_size);
+                consume_point_schedule(round_schedule, points, *affine_data, *bucket_data, 0, 0);
+                round_output = accumulate_buckets(*bucket_data);
+                bucket_data->bucket_exists.clear();
+            }
+        } else {
+            for (const uint64_t schedule : point_schedule) {
+                const size_t bucket_index = static_cast<size_t>(schedule) & 0xFFFFFFFF;
+                const size_t point_index = static_cast<size_t>(schedule >> 32);
+                if (bucket_index > 0) {
+                    if (jacobian_bucket_data->bucket_exists.get(bucket_index)) {
+                        jacobian_bucket_data->buckets[bucket_index] += points[point_index];
+                    } else {
+                        jacobian_bucket_data->buckets[bucket_index] = points[point_index];
+                        jacobian_bucket_data->bucket_exists.set(bucket_index, true);
+                    }
+                }
+            }
+            round_output = accumulate_buckets(*jacobian_bucket_data);
+            jacobian_bucket_data->bucket_exists.clear();
+        }
+
+        for (size_t i = 0; i < bits_per_slice; ++i) {
+            result.self_dbl();
+        }
+        result += round_output;
+    }
+    return result;
+}
+
+/**
+ * @brief Evaluate an MSM against the base points of a precomputed `FixedBaseTable`
+ * @details The scalar at position k of `_scalars` is multiplied with base point `_scalars.start_index + k`. The
+ *          nonzero scalars are split evenly between threads and the per-thread results are summed.
+ *
+ * @tparam Curve
+ * @param table
+ * @param _scalars
+ * @return Curve::AffineElement
+ */
+template <typename Curve>
+typename Curve::AffineElement MSM<Curve>::fixed_base_msm(const FixedBaseTable& table,
+                                                         PolynomialSpan<const ScalarField> _scalars) noexcept
+{
+    if (_scalars.size() == 0) {
+        return Curve::Group::affine_point_at_infinity;
+    }
+    BB_ASSERT_EQ(table.empty(), false);
+    BB_ASSERT_GTE(table.num_bases, _scalars.start_index + _scalars.size());
+
+    // See `msm` for why we drop const here; scalars are restored to Montgomery form before returning
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    ScalarField* scalar_ptr = const_cast<ScalarField*>(&_scalars[_scalars.start_index]);
+    std::span<ScalarField> scalars(scalar_ptr, _scalars.size());
+
+    std::vector<uint32_t> scalar_indices;
+    transform_scalar_and_get_nonzero_scalar_indices(scalars, scalar_indices);
+
+    // only use a single thread if we don't have enough work for every thread
+    const size_t num_threads = (scalar_indices.size() < get_num_cpus()) ? 1 : get_num_cpus();
+    const size_t indices_per_thread = numeric::ceil_div(scalar_indices.size(), num_threads);
+    std::vector<Element> thread_results(num_threads);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * indices_per_thread, scalar_indices.size());
+        const size_t end = std::min(start + indices_per_thread, scalar_indices.size());
+        thread_results[thread_idx] = Curve::Group::point_at_infinity;
+        if (end > start) {
+            std::span<const uint32_t> thread_indices(&scalar_indices[start], end - start);
+            thread_results[thread_idx] =
+                fixed_base_pippenger_with_transformed_scalars(table, scalars, thread_indices, _scalars.start_index);
+        }
+    });
+
+    Element result = Curve::Group::point_at_infinity;
+    for (const Element& thread_result : thread_results) {
+        result += thread_result;
+    }
+
+    // Convert our scalars back into Montgomery form so they remain unchanged
+    parallel_for_range(scalars.size(), [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            scalars[i].self_to_montgomery_form();
+        }
+    });
+    return AffineElement(result);
+}
+
 template <typename Curve>
 typename Curve::Element pippenger(PolynomialSpan<const typename Curve::ScalarField> scalars,
                                   std::span<const typename Curve::AffineElement> points,
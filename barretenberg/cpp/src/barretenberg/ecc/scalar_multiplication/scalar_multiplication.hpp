@@ -82,6 +82,25 @@ template <typename Curve> class MSM {
             , addition_result_bucket_destinations(((BATCH_SIZE + BATCH_OVERFLOW_SIZE) / 2))
         {}
     };
+    /**
+     * @brief Precomputed multiples of a fixed set of base points, consumed by `fixed_base_msm`
+     * @details A scalar is split into R = ceil(NUM_BITS_IN_FIELD / c) windows of c = `bits_per_slice` bits. For each
+     *          base point G_i we store m = `points_per_base` multiples 2^{j * t * c} * G_i (j = 0, ..., m - 1) where
+     *          t = `num_rounds`, laid out contiguously at `points[i * m + j]`. Window w = j * t + r of a scalar is then
+     *          added into the round-r buckets using the j-th multiple, so an MSM needs t Pippenger rounds (and t - 1
+     *          doubling sequences) instead of R. Memory grows linearly in m; m = R collapses the MSM to a single round.
+     */
+    struct FixedBaseTable {
+        size_t bits_per_slice = 0;
+        size_t num_rounds = 0;
+        size_t points_per_base = 0;
+        size_t num_bases = 0;
+        std::vector<AffineElement> points;
+
+        bool empty() const { return points.empty(); }
+        size_t memory_usage() const { return points.size() * sizeof(AffineElement); }
+    };
+
     static size_t get_num_rounds(size_t num_points) noexcept
     {
         const size_t bits_per_slice = get_optimal_log_num_buckets(num_points);
@@ -129,6 +148,18 @@ template <typename Curve> class MSM {
                              PolynomialSpan<const ScalarField> _scalars,
                              bool handle_edge_cases = false) noexcept;
 
+    static uint32_t get_scalar_window(const ScalarField& scalar, size_t lo_bit, size_t slice_size) noexcept;
+    static FixedBaseTable get_fixed_base_table_parameters(const size_t num_bases,
+                                                          const size_t memory_budget_bytes) noexcept;
+    static FixedBaseTable compute_fixed_base_table(std::span<const AffineElement> points,
+                                                   const size_t memory_budget_bytes) noexcept;
+    static Element fixed_base_pippenger_with_transformed_scalars(const FixedBaseTable& table,
+                                                                 std::span<const ScalarField> scalars,
+                                                                 std::span<const uint32_t> scalar_indices,
+                                                                 const size_t base_offset) noexcept;
+    static AffineElement fixed_base_msm(const FixedBaseTable& table,
+                                        PolynomialSpan<const ScalarField> _scalars) noexcept;
+
     template <typename BucketType> static Element accumulate_buckets(BucketType& bucket_accumulators) noexcept
     {
         auto& buckets = bucket_accumulators.buckets;
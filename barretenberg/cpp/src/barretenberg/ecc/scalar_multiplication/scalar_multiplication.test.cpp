@@ -479,6 +479,42 @@ TYPED_TEST(ScalarMultiplicationTest, MSMEmptyPolynomial)
     EXPECT_EQ(result, Curve::Group::affine_point_at_infinity);
 }
 
+TYPED_TEST(ScalarMultiplicationTest, FixedBaseMSM)
+{
+    SCALAR_MULTIPLICATION_TYPE_ALIASES
+    using AffineElement = typename Curve::AffineElement;
+    using MSM = scalar_multiplication::MSM<Curve>;
+
+    const size_t num_bases = 1 << 14;
+    const size_t start_index = 123;
+    const size_t num_points = num_bases - start_index;
+    std::span<const AffineElement> bases(&TestFixture::generators[0], num_bases);
+
+    // One table that needs several rounds and one that fits every window of a scalar
+    for (const size_t multiples_budget : { 3, 64 }) {
+        auto table = MSM::compute_fixed_base_table(bases, num_bases * sizeof(AffineElement) * multiples_budget);
+        EXPECT_FALSE(table.empty());
+        EXPECT_LE(table.memory_usage(), num_bases * sizeof(AffineElement) * multiples_budget);
+
+        std::vector<ScalarField> scalars(&TestFixture::scalars[0], &TestFixture::scalars[num_points]);
+        for (size_t i = 0; i < num_points; i += 5) {
+            scalars[i] = 0;
+        }
+        const std::vector<ScalarField> scalars_copy = scalars;
+
+        PolynomialSpan<const ScalarField> scalar_span(start_index, scalars);
+        AffineElement result = MSM::fixed_base_msm(table, scalar_span);
+
+        std::span<const AffineElement> points(&TestFixture::generators[start_index], num_points);
+        AffineElement expected = TestFixture::naive_msm(scalars, points);
+        EXPECT_EQ(result, expected);
+        EXPECT_EQ(scalars, scalars_copy);
+    }
+
+    // A budget that cannot hold two multiples per point yields no table
+    EXPECT_TRUE(MSM::compute_fixed_base_table(bases, num_bases * sizeof(AffineElement)).empty());
+}
+
 TEST(ScalarMultiplication, SmallInputsExplicit)
 {
     uint256_t x0(0x68df84429941826a, 0xeb08934ed806781c, 0xc14b6a2e4f796a73, 0x08dc1a9a11a3c8db);
@@ -41,31 +41,21 @@ ECCVMProver::ECCVMProver(CircuitBuilder& builder,
  */
 void ECCVMProver::execute_wire_commitments_round()
 {
-    // To commit to the masked wires when `real_size` < `circuit_size`, we use
-    // `commit_structured` that ignores 0 coefficients between the real size and the last NUM_DISABLED_ROWS_IN_SUMCHECK
-    // wire entries.
     const size_t circuit_size = key->circuit_size;
     unmasked_witness_size = circuit_size - NUM_DISABLED_ROWS_IN_SUMCHECK;
 
-    CommitmentKey::CommitType commit_type =
-        (circuit_size > key->real_size) ? CommitmentKey::CommitType::Structured : CommitmentKey::CommitType::Default;
-
-    // Commit to wires whose length is bounded by the real size of the ECCVM
-    for (const auto& [wire, label] : zip_view(key->polynomials.get_wires_without_accumulators(),
-                                              commitment_labels.get_wires_without_accumulators())) {
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/1240) Structured Polynomials in
-        // ECCVM/Translator/MegaZK
-        const size_t start = circuit_size == wire.size() ? 0 : 1;
-        std::vector<std::pair<size_t, size_t>> active_ranges{ { start, key->real_size + start },
-                                                              { unmasked_witness_size, circuit_size } };
-        commit_to_witness_polynomial(wire, label, commit_type, active_ranges);
-    }
-
-    // The accumulators are populated until the 2^{CONST_ECCVM_LOG_N}, therefore we commit to a full-sized polynomial
-    for (const auto& [wire, label] :
-         zip_view(key->polynomials.get_accumulators(), commitment_labels.get_accumulators())) {
-        commit_to_witness_polynomial(wire, label);
+    // Both the wires whose length is bounded by the real size of the ECCVM and the accumulators, which are populated
+    // until the 2^{CONST_ECCVM_LOG_N}, resolve to a plain commit, so the whole round is committed with one batched MSM
+    // TODO(https://github.com/AztecProtocol/barretenberg/issues/1240) Structured Polynomials in
+    // ECCVM/Translator/MegaZK
+    RefVector<Polynomial> wires = concatenate(key->polynomials.get_wires_without_accumulators(),
+                                              key->polynomials.get_accumulators());
+    std::vector<std::string> labels;
+    for (const auto& label :
+         concatenate(commitment_labels.get_wires_without_accumulators(), commitment_labels.get_accumulators())) {
+        labels.push_back(label);
     }
+    batch_commit_to_witness_polynomials(wires, labels);
 }
 
 /**
@@ -321,4 +311,24 @@ void ECCVMProver::commit_to_witness_polynomial(Polynomial& polynomial,
     polynomial.mask();
     transcript->send_to_verifier(label, key->commitment_key.commit_with_type(polynomial, commit_type, active_ranges));
 }
+
+/**
+ * @brief Utility to mask a set of witness polynomials, commit to them with a single batched MSM and send the
+ * commitments to the verifier in order.
+ *
+ * @param polynomials
+ * @param labels
+ */
+void ECCVMProver::batch_commit_to_witness_polynomials(RefVector<Polynomial> polynomials,
+                                                      const std::vector<std::string>& labels)
+{
+    BB_ASSERT_EQ(polynomials.size(), labels.size());
+    for (auto& polynomial : polynomials) {
+        polynomial.mask();
+    }
+    std::vector<Commitment> commitments = key->commitment_key.batch_commit(polynomials);
+    for (size_t i = 0; i < commitments.size(); ++i) {
+        transcript->send_to_verifier(labels[i], commitments[i]);
+    }
+}
 } // namespace bb
@@ -55,6 +55,7 @@ class ECCVMProver {
                                       const std::string& label,
                                       CommitmentKey::CommitType commit_type = CommitmentKey::CommitType::Default,
                                       const std::vector<std::pair<size_t, size_t>>& active_ranges = {});
+    void batch_commit_to_witness_polynomials(RefVector<Polynomial> polynomials, const std::vector<std::string>& labels);
 
     std::shared_ptr<Transcript> transcript;
     std::shared_ptr<Transcript> ipa_transcript;
@@ -262,11 +262,11 @@ class ECCVMTranscriptBuilder {
         }
 
         // Perform all required inversions at once
-        FF::batch_invert(&inverse_trace_x[0], num_vm_entries);
-        FF::batch_invert(&inverse_trace_y[0], num_vm_entries);
-        FF::batch_invert(&transcript_msm_x_inverse_trace[0], num_vm_entries);
-        FF::batch_invert(&add_lambda_denominator[0], num_vm_entries);
-        FF::batch_invert(&msm_count_at_transition_inverse_trace[0], num_vm_entries);
+        FF::parallel_batch_invert(std::span{ &inverse_trace_x[0], num_vm_entries });
+        FF::parallel_batch_invert(std::span{ &inverse_trace_y[0], num_vm_entries });
+        FF::parallel_batch_invert(std::span{ &transcript_msm_x_inverse_trace[0], num_vm_entries });
+        FF::parallel_batch_invert(std::span{ &add_lambda_denominator[0], num_vm_entries });
+        FF::parallel_batch_invert(std::span{ &msm_count_at_transition_inverse_trace[0], num_vm_entries });
 
         // Populate the fields of the transcript row containing inverted scalars
         for (size_t i = 0; i < num_vm_entries; ++i) {
@@ -82,6 +82,7 @@
 #include "barretenberg/polynomials/barycentric.hpp"
 #include "barretenberg/polynomials/evaluation_domain.hpp"
 #include "barretenberg/polynomials/univariate.hpp"
+#include "barretenberg/relations/nested_containers.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 #include "barretenberg/stdlib/hash/poseidon2/poseidon2.hpp"
 #include "barretenberg/stdlib/primitives/field/field_conversion.hpp"
@@ -393,6 +394,19 @@ template <typename Tuple, bool ZK = false> constexpr auto create_sumcheck_tuple_
     }(seq);
 }
 
+/**
+ * @brief Same as create_sumcheck_tuple_of_tuples_of_univariates, with univariates over Fr rather than over the field of
+ * the relations. Used to evaluate the relations on several edges at once, see FrLanes.
+ */
+template <typename Tuple, typename Fr> constexpr auto create_sumcheck_tuple_of_tuples_of_univariates_over()
+{
+    constexpr auto seq = std::make_index_sequence<std::tuple_size_v<Tuple>>();
+    return []<size_t... I>(std::index_sequence<I...>) {
+        return std::make_tuple(
+            TupleOfUnivariates<Fr, std::tuple_element_t<I, Tuple>::SUBRELATION_PARTIAL_LENGTHS>{}...);
+    }(seq);
+}
+
 /**
  * @brief Construct tuple of arrays
  * @details Container for storing value of each identity in each relation. Each Relation contributes an array of
@@ -45,6 +45,8 @@ class MegaFlavor {
 
     // indicates when evaluating sumcheck, edges can be left as degree-1 monomials
     static constexpr bool USE_SHORT_MONOMIALS = true;
+    // indicates when evaluating sumcheck, relations can be evaluated on several edges at once, see FrLanes
+    static constexpr bool USE_FR_LANES = true;
     // Indicates that this flavor runs with non-ZK Sumcheck.
     static constexpr bool HasZK = false;
     // To achieve fixed proof size and that the recursive verifier circuit is constant, we are using padding in Sumcheck
@@ -25,6 +25,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -124,7 +125,23 @@ template <size_t NUM_WIRES, bool generalized> struct PermutationMapping {
     }
 };
 
-using CyclicPermutation = std::vector<cycle_node>;
+/**
+ * @brief The copy cycles of a circuit: for each real variable, the cells of the execution trace that hold its value
+ * @details The cycles are stored back to back in a single array rather than each in a vector of its own, so that
+ * building them takes a fixed number of allocations however many variables the circuit has. The nodes of the i-th cycle
+ * are nodes[offsets[i]], ..., nodes[offsets[i + 1] - 1], ordered by row and, within a row, by wire.
+ */
+struct CopyCycles {
+    std::vector<uint32_t> offsets;
+    std::vector<cycle_node> nodes;
+
+    size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+    std::span<const cycle_node> operator[](size_t cycle_idx) const
+    {
+        return { nodes.data() + offsets[cycle_idx], nodes.data() + offsets[cycle_idx + 1] };
+    }
+};
 
 namespace {
 /**
@@ -143,7 +160,7 @@ template <typename Flavor, bool generalized>
 PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     const typename Flavor::CircuitBuilder& circuit_constructor,
     typename Flavor::ProvingKey* proving_key,
-    const std::vector<CyclicPermutation>& wire_copy_cycles)
+    const CopyCycles& wire_copy_cycles)
 {
 
     // Initialize the table of permutations so that every element points to itself
@@ -152,43 +169,45 @@ PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     // Represents the idx of a variable in circuit_constructor.variables (needed only for generalized)
     std::span<const uint32_t> real_variable_tags = circuit_constructor.real_variable_tags;
 
-    // Go through each cycle
-    for (size_t cycle_idx = 0; cycle_idx < wire_copy_cycles.size(); ++cycle_idx) {
-        const CyclicPermutation& cycle = wire_copy_cycles[cycle_idx];
-        for (size_t node_idx = 0; node_idx < cycle.size(); ++node_idx) {
-            // Get the indices (column, row) of the current node in the cycle
-            const cycle_node& current_node = cycle[node_idx];
-            const auto current_row = static_cast<ptrdiff_t>(current_node.gate_idx);
-            const auto current_column = current_node.wire_idx;
-
-            // Get indices of next node; If the current node is last in the cycle, then the next is the first one
-            size_t next_node_idx = (node_idx == cycle.size() - 1 ? 0 : node_idx + 1);
-            const cycle_node& next_node = cycle[next_node_idx];
-            const auto next_row = next_node.gate_idx;
-            const auto next_column = static_cast<uint8_t>(next_node.wire_idx);
-
-            // Point current node to the next node
-            mapping.sigmas[current_column].row_idx[current_row] = next_row;
-            mapping.sigmas[current_column].col_idx[current_row] = next_column;
-
-            if constexpr (generalized) {
-                const bool first_node = (node_idx == 0);
-                const bool last_node = (next_node_idx == 0);
-
-                if (first_node) {
-                    mapping.ids[current_column].is_tag[current_row] = true;
-                    mapping.ids[current_column].row_idx[current_row] = real_variable_tags[cycle_idx];
-                }
-                if (last_node) {
-                    mapping.sigmas[current_column].is_tag[current_row] = true;
+    // Go through each cycle; the cycles are disjoint, so each entry of the mapping is written by a single thread
+    parallel_for_range(wire_copy_cycles.size(), [&](size_t start, size_t end) {
+        for (size_t cycle_idx = start; cycle_idx < end; ++cycle_idx) {
+            const std::span<const cycle_node> cycle = wire_copy_cycles[cycle_idx];
+            for (size_t node_idx = 0; node_idx < cycle.size(); ++node_idx) {
+                // Get the indices (column, row) of the current node in the cycle
+                const cycle_node& current_node = cycle[node_idx];
+                const auto current_row = static_cast<ptrdiff_t>(current_node.gate_idx);
+                const auto current_column = current_node.wire_idx;
+
+                // Get indices of next node; If the current node is last in the cycle, then the next is the first one
+                size_t next_node_idx = (node_idx == cycle.size() - 1 ? 0 : node_idx + 1);
+                const cycle_node& next_node = cycle[next_node_idx];
+                const auto next_row = next_node.gate_idx;
+                const auto next_column = static_cast<uint8_t>(next_node.wire_idx);
+
+                // Point current node to the next node
+                mapping.sigmas[current_column].row_idx[current_row] = next_row;
+                mapping.sigmas[current_column].col_idx[current_row] = next_column;
+
+                if constexpr (generalized) {
+                    const bool first_node = (node_idx == 0);
+                    const bool last_node = (next_node_idx == 0);
+
+                    if (first_node) {
+                        mapping.ids[current_column].is_tag[current_row] = true;
+                        mapping.ids[current_column].row_idx[current_row] = real_variable_tags[cycle_idx];
+                    }
+                    if (last_node) {
+                        mapping.sigmas[current_column].is_tag[current_row] = true;
 
-                    // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
-                    mapping.sigmas[current_column].row_idx[current_row] =
-                        circuit_constructor.tau.at(real_variable_tags[cycle_idx]);
+                        // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
+                        mapping.sigmas[current_column].row_idx[current_row] =
+                            circuit_constructor.tau.at(real_variable_tags[cycle_idx]);
+                    }
                 }
             }
         }
-    }
+    });
 
     // Add information about public inputs so that the cycles can be altered later; See the construction of the
     // permutation polynomials for details.
@@ -282,7 +301,7 @@ void compute_honk_style_permutation_lagrange_polynomials_from_mapping(
 template <typename Flavor>
 void compute_permutation_argument_polynomials(const typename Flavor::CircuitBuilder& circuit,
                                               typename Flavor::ProvingKey* key,
-                                              const std::vector<CyclicPermutation>& copy_cycles)
+                                              const CopyCycles& copy_cycles)
 {
     constexpr bool generalized = IsUltraOrMegaHonk<Flavor>;
     auto mapping = compute_permutation_mapping<Flavor, generalized>(circuit, key, copy_cycles);
@@ -7,7 +7,9 @@
 #pragma once
 
 #include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/thread.hpp"
 
+#include <algorithm>
 #include <typeinfo>
 
 namespace bb {
@@ -30,6 +32,11 @@ namespace bb {
  *
  * The specific algebraic relations that define read terms and write terms are defined in Flavor::LookupRelation
  *
+ * Only the rows the inverse polynomial has memory for are visited: it cannot be set anywhere else, so for sparse traces
+ * (e.g. the AVM, whose inverse columns only extend as far as the selectors of their relation) the rows outside the
+ * active range of the relation cost nothing. The rows are split into chunks that are processed in parallel, each with
+ * its own batch inversion.
+ *
  */
 template <typename FF, typename Relation, typename Polynomials>
 void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_parameters, const size_t circuit_size)
@@ -39,30 +46,43 @@ void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_para
     constexpr size_t WRITE_TERMS = Relation::WRITE_TERMS;
 
     auto& inverse_polynomial = Relation::template get_inverse_polynomial(polynomials);
-    for (size_t i = 0; i < circuit_size; ++i) {
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
-        auto row = polynomials.get_row(i);
-        bool has_inverse = Relation::operation_exists_at_row(row);
-        if (!has_inverse) {
-            continue;
-        }
-        FF denominator = 1;
-        bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
-            auto denominator_term =
-                Relation::template compute_read_term<Accumulator, read_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        bb::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
-            auto denominator_term =
-                Relation::template compute_write_term<Accumulator, write_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        inverse_polynomial.at(i) = denominator;
-    };
-
-    // Compute inverse polynomial I in place by inverting the product at each row
-    // Note: zeroes are ignored as they are not used anyway
-    FF::batch_invert(inverse_polynomial.coeffs());
+    const size_t start = inverse_polynomial.start_index();
+    const size_t end = std::min(inverse_polynomial.end_index(), circuit_size);
+    if (start >= end) {
+        return;
+    }
+
+    // Below this many rows a chunk does not pay for the extra field inversion of its batch inversion
+    constexpr size_t MIN_ROWS_PER_THREAD = 1 << 10;
+    parallel_for_range(
+        end - start,
+        [&](size_t chunk_start, size_t chunk_end) {
+            for (size_t i = start + chunk_start; i < start + chunk_end; ++i) {
+                // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
+                auto row = polynomials.get_row(i);
+                bool has_inverse = Relation::operation_exists_at_row(row);
+                if (!has_inverse) {
+                    continue;
+                }
+                FF denominator = 1;
+                bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
+                    auto denominator_term =
+                        Relation::template compute_read_term<Accumulator, read_index>(row, relation_parameters);
+                    denominator *= denominator_term;
+                });
+                bb::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
+                    auto denominator_term =
+                        Relation::template compute_write_term<Accumulator, write_index>(row, relation_parameters);
+                    denominator *= denominator_term;
+                });
+                inverse_polynomial.at(i) = denominator;
+            }
+
+            // Compute inverse polynomial I in place by inverting the product at each row
+            // Note: zeroes are ignored as they are not used anyway
+            FF::batch_invert(inverse_polynomial.coeffs().subspan(chunk_start, chunk_end - chunk_start));
+        },
+        MIN_ROWS_PER_THREAD);
 }
 
 /**
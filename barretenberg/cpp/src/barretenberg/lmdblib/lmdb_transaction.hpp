@@ -4,6 +4,7 @@
 #include "lmdb.h"
 #include <cstdint>
 #include <functional>
+#include <span>
 #include <vector>
 
 namespace bb::lmdblib {
@@ -56,6 +57,9 @@ class LMDBTransaction {
 
     template <typename T> bool get_value(T& key, uint64_t& data, const LMDBDatabase& db) const;
 
+    // The view is only valid for the lifetime of the transaction and up to the next write to the database
+    template <typename T> bool get_value(T& key, std::span<const uint8_t>& data, const LMDBDatabase& db) const;
+
     template <typename T>
     void get_all_values_greater_or_equal_key(const T& key,
                                              std::vector<std::vector<uint8_t>>& data,
@@ -70,6 +74,8 @@ class LMDBTransaction {
 
     bool get_value(std::vector<uint8_t>& key, uint64_t& data, const LMDBDatabase& db) const;
 
+    bool get_value(std::vector<uint8_t>& key, std::span<const uint8_t>& data, const LMDBDatabase& db) const;
+
   protected:
     std::shared_ptr<LMDBEnvironment> _environment;
     uint64_t _id;
@@ -83,6 +89,13 @@ template <typename T> bool LMDBTransaction::get_value(T& key, std::vector<uint8_
     return get_value(keyBuffer, data, db);
 }
 
+template <typename T>
+bool LMDBTransaction::get_value(T& key, std::span<const uint8_t>& data, const LMDBDatabase& db) const
+{
+    std::vector<uint8_t> keyBuffer = serialise_key(key);
+    return get_value(keyBuffer, data, db);
+}
+
 template <typename T> bool LMDBTransaction::get_value(T& key, uint64_t& data, const LMDBDatabase& db) const
 {
     std::vector<uint8_t> keyBuffer = serialise_key(key);
@@ -45,6 +45,11 @@ void LMDBWriteTransaction::put_value(Key& key, const uint64_t& data, const LMDBD
     lmdb_queries::put_value(key, data, db, *this, db.duplicate_keys_permitted());
 }
 
+void LMDBWriteTransaction::put_value(Key& key, std::span<const uint8_t> data, const LMDBDatabase& db)
+{
+    lmdb_queries::put_value(key, data, db, *this, db.duplicate_keys_permitted());
+}
+
 void LMDBWriteTransaction::delete_value(Key& key, const LMDBDatabase& db)
 {
     lmdb_queries::delete_value(key, db, *this);
@@ -10,6 +10,7 @@
 #include <cstdint>
 #include <exception>
 #include <memory>
+#include <span>
 
 namespace bb::lmdblib {
 
@@ -35,10 +36,14 @@ class LMDBWriteTransaction : public LMDBTransaction {
 
     template <typename T> void put_value(T& key, const uint64_t& data, const LMDBDatabase& db);
 
+    template <typename T> void put_value(T& key, std::span<const uint8_t> data, const LMDBDatabase& db);
+
     void put_value(Key& key, Value& data, const LMDBDatabase& db);
 
     void put_value(Key& key, const uint64_t& data, const LMDBDatabase& db);
 
+    void put_value(Key& key, std::span<const uint8_t> data, const LMDBDatabase& db);
+
     template <typename T> void delete_value(T& key, const LMDBDatabase& db);
 
     template <typename T> void delete_value(T& key, Value& value, const LMDBDatabase& db);
@@ -68,6 +73,13 @@ template <typename T> void LMDBWriteTransaction::put_value(T& key, const uint64_
     put_value(keyBuffer, data, db);
 }
 
+template <typename T>
+void LMDBWriteTransaction::put_value(T& key, std::span<const uint8_t> data, const LMDBDatabase& db)
+{
+    Key keyBuffer = serialise_key(key);
+    put_value(keyBuffer, data, db);
+}
+
 template <typename T> void LMDBWriteTransaction::delete_value(T& key, const LMDBDatabase& db)
 {
     Key keyBuffer = serialise_key(key);
@@ -5,6 +5,7 @@
 #include "barretenberg/lmdblib/types.hpp"
 #include "lmdb.h"
 #include <cstdint>
+#include <span>
 #include <vector>
 
 namespace bb::lmdblib::lmdb_queries {
@@ -56,6 +57,31 @@ void put_value(Key& key,
     call_lmdb_func("mdb_put", mdb_put, tx.underlying(), db.underlying(), &dbKey, &dbVal, flags);
 }
 
+void put_value(Key& key,
+               std::span<const uint8_t> data,
+               const LMDBDatabase& db,
+               bb::lmdblib::LMDBWriteTransaction& tx,
+               bool duplicatesPermitted)
+{
+    MDB_val dbKey;
+    dbKey.mv_size = key.size();
+    dbKey.mv_data = (void*)key.data();
+
+    MDB_val dbVal;
+    dbVal.mv_size = data.size();
+    dbVal.mv_data = (void*)data.data();
+
+    unsigned int flags = duplicatesPermitted ? MDB_NODUPDATA : 0U;
+    auto code = call_lmdb_func_with_return(mdb_put, tx.underlying(), db.underlying(), &dbKey, &dbVal, flags);
+    if (code == MDB_KEYEXIST && duplicatesPermitted) {
+        return;
+    }
+
+    if (code != MDB_SUCCESS) {
+        throw_error("mdb_put", code);
+    }
+}
+
 void delete_value(Key& key, const LMDBDatabase& db, bb::lmdblib::LMDBWriteTransaction& tx)
 {
     MDB_val dbKey;
@@ -114,6 +140,20 @@ bool get_value(Key& key, uint64_t& data, const LMDBDatabase& db, const bb::lmdbl
     return true;
 }
 
+bool get_value(Key& key, std::span<const uint8_t>& data, const LMDBDatabase& db, const bb::lmdblib::LMDBTransaction& tx)
+{
+    MDB_val dbKey;
+    dbKey.mv_size = key.size();
+    dbKey.mv_data = (void*)key.data();
+
+    MDB_val dbVal;
+    if (!call_lmdb_func(mdb_get, tx.underlying(), db.underlying(), &dbKey, &dbVal)) {
+        return false;
+    }
+    data = std::span<const uint8_t>(static_cast<const uint8_t*>(dbVal.mv_data), dbVal.mv_size);
+    return true;
+}
+
 bool set_at_key(const LMDBCursor& cursor, Key& key)
 {
     MDB_val dbKey;
@@ -6,6 +6,7 @@
 #include "lmdb.h"
 #include <cstdint>
 #include <functional>
+#include <span>
 #include <vector>
 
 namespace bb::lmdblib {
@@ -442,6 +443,12 @@ void put_value(
 void put_value(
     Key& key, const uint64_t& data, const LMDBDatabase& db, LMDBWriteTransaction& tx, bool duplicatesPermitted = false);
 
+void put_value(Key& key,
+               std::span<const uint8_t> data,
+               const LMDBDatabase& db,
+               LMDBWriteTransaction& tx,
+               bool duplicatesPermitted = false);
+
 void delete_value(Key& key, const LMDBDatabase& db, LMDBWriteTransaction& tx);
 
 void delete_value(Key& key, Value& value, const LMDBDatabase& db, LMDBWriteTransaction& tx);
@@ -450,6 +457,10 @@ bool get_value(Key& key, Value& data, const LMDBDatabase& db, const LMDBTransact
 
 bool get_value(Key& key, uint64_t& data, const LMDBDatabase& db, const LMDBTransaction& tx);
 
+// Returns a view of the value in the database without copying it. The view is only valid until the transaction ends
+// or, for a write transaction, until the next write to the database.
+bool get_value(Key& key, std::span<const uint8_t>& data, const LMDBDatabase& db, const LMDBTransaction& tx);
+
 bool set_at_key(const LMDBCursor& cursor, Key& key);
 bool set_at_key_gte(const LMDBCursor& cursor, Key& key);
 bool set_at_start(const LMDBCursor& cursor);
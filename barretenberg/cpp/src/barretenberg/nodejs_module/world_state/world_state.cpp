@@ -181,6 +181,10 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
         WorldStateMessageType::GET_SIBLING_PATH,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_sibling_path(obj, buffer); });
 
+    _dispatcher.register_target(
+        WorldStateMessageType::GET_SIBLING_PATHS,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_sibling_paths(obj, buffer); });
+
     _dispatcher.register_target(WorldStateMessageType::GET_BLOCK_NUMBERS_FOR_LEAF_INDICES,
                                 [this](msgpack::object& obj, msgpack::sbuffer& buffer) {
                                     return get_block_numbers_for_leaf_indices(obj, buffer);
@@ -274,6 +278,18 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
     _dispatcher.register_target(
         WorldStateMessageType::COPY_STORES,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return copy_stores(obj, buffer); });
+
+    _dispatcher.register_target(
+        WorldStateMessageType::ENABLE_LEAF_KEY_FILTER,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return enable_leaf_key_filter(obj, buffer); });
+
+    _dispatcher.register_target(
+        WorldStateMessageType::DISABLE_LEAF_KEY_FILTER,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return disable_leaf_key_filter(obj, buffer); });
+
+    _dispatcher.register_target(
+        WorldStateMessageType::GET_LEAF_KEY_FILTER_STATS,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_leaf_key_filter_stats(obj, buffer); });
 }
 
 Napi::Value WorldStateWrapper::call(const Napi::CallbackInfo& info)
@@ -451,6 +467,22 @@ bool WorldStateWrapper::get_sibling_path(msgpack::object& obj, msgpack::sbuffer&
     return true;
 }
 
+bool WorldStateWrapper::get_sibling_paths(msgpack::object& obj, msgpack::sbuffer& buffer) const
+{
+    TypedMessage<GetSiblingPathsRequest> request;
+    obj.convert(request);
+
+    SiblingPathsBatch paths =
+        _ws->get_sibling_paths(request.value.revision, request.value.treeId, request.value.leafIndices);
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<SiblingPathsBatch> resp_msg(WorldStateMessageType::GET_SIBLING_PATHS, header, paths);
+
+    msgpack::pack(buffer, resp_msg);
+
+    return true;
+}
+
 bool WorldStateWrapper::get_block_numbers_for_leaf_indices(msgpack::object& obj, msgpack::sbuffer& buffer) const
 {
     TypedMessage<GetBlockNumbersForLeafIndicesRequest> request;
@@ -924,6 +956,50 @@ bool WorldStateWrapper::copy_stores(msgpack::object& obj, msgpack::sbuffer& buff
     return true;
 }
 
+bool WorldStateWrapper::enable_leaf_key_filter(msgpack::object& obj, msgpack::sbuffer& buffer)
+{
+    TypedMessage<EnableLeafKeyFilterRequest> request;
+    obj.convert(request);
+
+    _ws->enable_leaf_key_filter(request.value.treeId,
+                                request.value.falsePositiveRate.value_or(LeafKeyFilter::DEFAULT_FALSE_POSITIVE_RATE));
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<EmptyResponse> resp_msg(WorldStateMessageType::ENABLE_LEAF_KEY_FILTER, header, {});
+    msgpack::pack(buffer, resp_msg);
+
+    return true;
+}
+
+bool WorldStateWrapper::disable_leaf_key_filter(msgpack::object& obj, msgpack::sbuffer& buffer)
+{
+    TypedMessage<TreeIdOnlyRequest> request;
+    obj.convert(request);
+
+    _ws->disable_leaf_key_filter(request.value.treeId);
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<EmptyResponse> resp_msg(WorldStateMessageType::DISABLE_LEAF_KEY_FILTER, header, {});
+    msgpack::pack(buffer, resp_msg);
+
+    return true;
+}
+
+bool WorldStateWrapper::get_leaf_key_filter_stats(msgpack::object& obj, msgpack::sbuffer& buffer) const
+{
+    TypedMessage<TreeIdOnlyRequest> request;
+    obj.convert(request);
+
+    LeafKeyFilterStats stats = _ws->get_leaf_key_filter_stats(request.value.treeId);
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<LeafKeyFilterStats> resp_msg(
+        WorldStateMessageType::GET_LEAF_KEY_FILTER_STATS, header, stats);
+    msgpack::pack(buffer, resp_msg);
+
+    return true;
+}
+
 Napi::Function WorldStateWrapper::get_class(Napi::Env env)
 {
     return DefineClass(env,
@@ -38,6 +38,7 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
     bool get_leaf_value(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_leaf_preimage(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_sibling_path(msgpack::object& obj, msgpack::sbuffer& buffer) const;
+    bool get_sibling_paths(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_block_numbers_for_leaf_indices(msgpack::object& obj, msgpack::sbuffer& buffer) const;
 
     bool find_leaf_indices(msgpack::object& obj, msgpack::sbuffer& buffer) const;
@@ -73,6 +74,10 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
     bool revert_all_checkpoints(msgpack::object& obj, msgpack::sbuffer& buffer);
 
     bool copy_stores(msgpack::object& obj, msgpack::sbuffer& buffer);
+
+    bool enable_leaf_key_filter(msgpack::object& obj, msgpack::sbuffer& buffer);
+    bool disable_leaf_key_filter(msgpack::object& obj, msgpack::sbuffer& buffer);
+    bool get_leaf_key_filter_stats(msgpack::object& obj, msgpack::sbuffer& buffer) const;
 };
 
 } // namespace bb::nodejs
@@ -59,6 +59,12 @@ enum WorldStateMessageType {
 
     COPY_STORES,
 
+    GET_SIBLING_PATHS,
+
+    ENABLE_LEAF_KEY_FILTER,
+    DISABLE_LEAF_KEY_FILTER,
+    GET_LEAF_KEY_FILTER_STATS,
+
     CLOSE = 999,
 };
 
@@ -149,6 +155,13 @@ struct GetSiblingPathRequest {
     MSGPACK_FIELDS(treeId, revision, leafIndex);
 };
 
+struct GetSiblingPathsRequest {
+    MerkleTreeId treeId;
+    WorldStateRevision revision;
+    std::vector<index_t> leafIndices;
+    MSGPACK_FIELDS(treeId, revision, leafIndices);
+};
+
 struct GetBlockNumbersForLeafIndicesRequest {
     MerkleTreeId treeId;
     WorldStateRevision revision;
@@ -256,6 +269,12 @@ struct CopyStoresRequest {
     MSGPACK_FIELDS(dstPath, compact);
 };
 
+struct EnableLeafKeyFilterRequest {
+    MerkleTreeId treeId;
+    std::optional<double> falsePositiveRate;
+    MSGPACK_FIELDS(treeId, falsePositiveRate);
+};
+
 } // namespace bb::nodejs
 
 MSGPACK_ADD_ENUM(bb::nodejs::WorldStateMessageType)
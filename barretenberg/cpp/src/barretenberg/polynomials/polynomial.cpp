@@ -124,6 +124,16 @@ Polynomial<Fr>::Polynomial(std::span<const Fr> interpolation_points,
         evaluations.data(), coefficients_.data(), interpolation_points.data(), coefficients_.size());
 }
 
+template <typename Fr>
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+Polynomial<Fr>::Polynomial(std::shared_ptr<Fr[]> backing_memory, size_t size, size_t virtual_size, size_t start_index)
+{
+    BB_ASSERT_LTE(start_index + size, virtual_size);
+    ASSERT(backing_memory != nullptr || size == 0);
+    coefficients_ =
+        SharedShiftedVirtualZeroesArray<Fr>{ start_index, size + start_index, virtual_size, std::move(backing_memory) };
+}
+
 template <typename Fr> Polynomial<Fr>::Polynomial(std::span<const Fr> coefficients, size_t virtual_size)
 {
     allocate_backing_memory(coefficients.size(), virtual_size, 0);
@@ -12,6 +12,7 @@
 #include "barretenberg/crypto/sha256/sha256.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/honk/types/circuit_type.hpp"
+#include "barretenberg/polynomials/polynomial_arena.hpp"
 #include "barretenberg/polynomials/shared_shifted_virtual_zeroes_array.hpp"
 #include "evaluation_domain.hpp"
 #include "polynomial_arithmetic.hpp"
@@ -96,6 +97,14 @@ template <typename Fr> class Polynomial {
 
     Polynomial(std::span<const Fr> coefficients, size_t virtual_size);
 
+    /**
+     * @brief Construct a polynomial that takes (shared) ownership of existing memory instead of allocating.
+     *
+     * @param backing_memory holds the coefficients of indices [start_index, start_index + size)
+     */
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    Polynomial(std::shared_ptr<Fr[]> backing_memory, size_t size, size_t virtual_size, size_t start_index = 0);
+
     Polynomial(std::span<const Fr> coefficients)
         : Polynomial(coefficients, coefficients.size())
     {}
@@ -441,6 +450,11 @@ template <typename Fr> class Polynomial {
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
 template <typename Fr> std::shared_ptr<Fr[]> _allocate_aligned_memory(size_t n_elements)
 {
+    // Take the memory from the polynomial arena of the prover running on this thread, if there is one
+    if (PolynomialArena* arena = PolynomialArena::active()) {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        return std::static_pointer_cast<Fr[]>(arena->allocate(sizeof(Fr) * n_elements));
+    }
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
     return std::static_pointer_cast<Fr[]>(get_mem_slab(sizeof(Fr) * n_elements));
 }
@@ -0,0 +1,252 @@
+#include "polynomial_arena.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/mem.hpp"
+#include <algorithm>
+#include <map>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
+#if defined(__linux__) && !defined(__wasm__)
+#include <sys/mman.h>
+#endif
+
+namespace {
+
+constexpr size_t ALIGNMENT = 64;
+constexpr size_t HUGE_PAGE_SIZE = 1 << 21;
+constexpr const char* DEFAULT_SITE = "other";
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local bb::PolynomialArena* active_arena = nullptr;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local const char* active_site = DEFAULT_SITE;
+
+size_t round_up(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+namespace bb {
+
+struct PolynomialArena::State {
+    PolynomialArenaOptions options;
+    // Released buffers, by size
+    std::map<size_t, std::vector<void*>> free_buffers;
+    size_t cached_bytes = 0;
+    size_t live_bytes = 0;
+    size_t peak_bytes = 0;
+    std::vector<PolynomialArenaSiteUsage> sites;
+    // Set once the arena is destroyed, after which released buffers are freed
+    bool closed = false;
+#ifndef NO_MULTITHREADING
+    std::mutex mutex;
+#endif
+
+    size_t buffer_size(size_t size) const
+    {
+        if (options.use_huge_pages && size >= HUGE_PAGE_SIZE) {
+            return round_up(size, HUGE_PAGE_SIZE);
+        }
+        return round_up(std::max(size, size_t(1)), ALIGNMENT);
+    }
+
+    void* allocate_buffer(size_t size) const
+    {
+        if (options.use_huge_pages && size >= HUGE_PAGE_SIZE) {
+            void* buffer = aligned_alloc(HUGE_PAGE_SIZE, size);
+#if defined(__linux__) && !defined(__wasm__)
+            // Only a hint: without transparent huge page support the buffer is backed by regular pages
+            madvise(buffer, size, MADV_HUGEPAGE);
+#endif
+            return buffer;
+        }
+        return aligned_alloc(ALIGNMENT, size);
+    }
+
+    PolynomialArenaSiteUsage& site(const char* name)
+    {
+        auto it = std::find_if(sites.begin(), sites.end(), [&](const auto& usage) { return usage.name == name; });
+        if (it != sites.end()) {
+            return *it;
+        }
+        sites.push_back(PolynomialArenaSiteUsage{ .name = name });
+        return sites.back();
+    }
+};
+
+PolynomialArena::PolynomialArena(PolynomialArenaOptions options)
+    : state(std::make_shared<State>())
+{
+    state->options = options;
+}
+
+PolynomialArena::~PolynomialArena()
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(state->mutex);
+#endif
+    state->closed = true;
+    for (auto& [size, buffers] : state->free_buffers) {
+        for (void* buffer : buffers) {
+            aligned_free(buffer);
+        }
+    }
+    state->free_buffers.clear();
+    state->cached_bytes = 0;
+}
+
+PolynomialArena::Scope::Scope(PolynomialArena& arena)
+    : previous(active_arena)
+{
+    active_arena = &arena;
+}
+
+PolynomialArena::Scope::~Scope()
+{
+    active_arena = previous;
+}
+
+PolynomialArena::Site::Site(const char* name)
+    : previous(active_site)
+{
+    active_site = name;
+}
+
+PolynomialArena::Site::~Site()
+{
+    active_site = previous;
+}
+
+PolynomialArena* PolynomialArena::active()
+{
+    return active_arena;
+}
+
+std::shared_ptr<void> PolynomialArena::allocate(size_t size)
+{
+    const size_t buffer_size = state->buffer_size(size);
+    void* buffer = nullptr;
+    size_t site_idx = 0;
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(state->mutex);
+#endif
+        auto& site = state->site(active_site);
+        site_idx = static_cast<size_t>(&site - state->sites.data());
+        auto it = state->free_buffers.find(buffer_size);
+        if (it != state->free_buffers.end()) {
+            buffer = it->second.back();
+            it->second.pop_back();
+            if (it->second.empty()) {
+                state->free_buffers.erase(it);
+            }
+            state->cached_bytes -= buffer_size;
+            site.num_recycled++;
+        }
+        site.num_allocations++;
+        site.live_bytes += buffer_size;
+        site.peak_bytes = std::max(site.peak_bytes, site.live_bytes);
+        state->live_bytes += buffer_size;
+        state->peak_bytes = std::max(state->peak_bytes, state->live_bytes);
+    }
+    if (buffer == nullptr) {
+        buffer = state->allocate_buffer(buffer_size);
+    }
+
+    return { buffer, [state = state, buffer_size, site_idx](void* released) {
+                bool keep = false;
+                {
+#ifndef NO_MULTITHREADING
+                    std::unique_lock<std::mutex> lock(state->mutex);
+#endif
+                    state->sites[site_idx].live_bytes -= buffer_size;
+                    state->live_bytes -= buffer_size;
+                    keep = !state->closed && state->cached_bytes + buffer_size <= state->options.max_cached_bytes;
+                    if (keep) {
+                        state->free_buffers[buffer_size].push_back(released);
+                        state->cached_bytes += buffer_size;
+                    }
+                }
+                if (!keep) {
+                    aligned_free(released);
+                }
+            } };
+}
+
+void PolynomialArena::release_cached()
+{
+    std::map<size_t, std::vector<void*>> free_buffers;
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(state->mutex);
+#endif
+        free_buffers.swap(state->free_buffers);
+        state->cached_bytes = 0;
+    }
+    for (auto& [size, buffers] : free_buffers) {
+        for (void* buffer : buffers) {
+            aligned_free(buffer);
+        }
+    }
+}
+
+size_t PolynomialArena::live_bytes() const
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(state->mutex);
+#endif
+    return state->live_bytes;
+}
+
+size_t PolynomialArena::peak_bytes() const
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(state->mutex);
+#endif
+    return state->peak_bytes;
+}
+
+size_t PolynomialArena::cached_bytes() const
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(state->mutex);
+#endif
+    return state->cached_bytes;
+}
+
+std::vector<PolynomialArenaSiteUsage> PolynomialArena::site_usage() const
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(state->mutex);
+#endif
+    return state->sites;
+}
+
+void PolynomialArena::print_usage() const
+{
+    constexpr double MiB = 1 << 20;
+    info("polynomial arena: peak ",
+         static_cast<double>(peak_bytes()) / MiB,
+         " MiB, live ",
+         static_cast<double>(live_bytes()) / MiB,
+         " MiB, cached ",
+         static_cast<double>(cached_bytes()) / MiB,
+         " MiB");
+    for (const auto& site : site_usage()) {
+        info("  ",
+             site.name,
+             ": peak ",
+             static_cast<double>(site.peak_bytes) / MiB,
+             " MiB, live ",
+             static_cast<double>(site.live_bytes) / MiB,
+             " MiB, ",
+             site.num_allocations,
+             " allocations (",
+             site.num_recycled,
+             " recycled)");
+    }
+}
+
+} // namespace bb
@@ -0,0 +1,114 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace bb {
+
+struct PolynomialArenaOptions {
+    // Back buffers of at least 2MiB with transparent huge pages, where the platform supports it
+    bool use_huge_pages = false;
+    // Free released buffers rather than keep them for reuse once this many bytes are kept
+    size_t max_cached_bytes = std::numeric_limits<size_t>::max();
+};
+
+/**
+ * @brief Memory usage of the buffers allocated at one named site, see PolynomialArena::Site.
+ */
+struct PolynomialArenaSiteUsage {
+    std::string name;
+    size_t live_bytes = 0;
+    size_t peak_bytes = 0;
+    size_t num_allocations = 0;
+    // Allocations served by a buffer released earlier rather than by the system allocator
+    size_t num_recycled = 0;
+};
+
+/**
+ * @brief A pool of polynomial backing buffers owned by one prover.
+ * @details Proving allocates and frees many buffers of the same few sizes: every round of Gemini, Shplonk or sumcheck
+ * builds polynomials of the circuit size (or a power of two below it) and drops them by the next. While an arena is
+ * active on a thread (see Scope), the polynomials constructed on that thread take their memory from it. A released
+ * buffer goes back to the arena, to serve the next request of the same size without going back to the system, and so
+ * without faulting in fresh pages. Allocations made on other threads, such as those made from within parallel_for,
+ * are served by the slab allocator as usual.
+ *
+ * The arena also keeps track of the bytes held by the buffers it handed out, in total and per named allocation site
+ * (see Site), so that the peak memory of a proof can be attributed to the rounds responsible for it.
+ *
+ * Buffers may outlive the arena: once it is destroyed they are freed on release instead of kept.
+ */
+class PolynomialArena {
+  public:
+    explicit PolynomialArena(PolynomialArenaOptions options = {});
+    PolynomialArena(const PolynomialArena&) = delete;
+    PolynomialArena(PolynomialArena&&) = delete;
+    PolynomialArena& operator=(const PolynomialArena&) = delete;
+    PolynomialArena& operator=(PolynomialArena&&) = delete;
+    ~PolynomialArena();
+
+    /**
+     * @brief Make `arena` the arena of the polynomials constructed on this thread for the lifetime of the scope.
+     */
+    class Scope {
+      public:
+        explicit Scope(PolynomialArena& arena);
+        Scope(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) = delete;
+        ~Scope();
+
+      private:
+        PolynomialArena* previous;
+    };
+
+    /**
+     * @brief Attribute the allocations made on this thread to the site `name` for the lifetime of the scope.
+     * @details `name` must outlive the scope; string literals are intended. Allocations made outside of any site are
+     * attributed to "other".
+     */
+    class Site {
+      public:
+        explicit Site(const char* name);
+        Site(const Site&) = delete;
+        Site(Site&&) = delete;
+        Site& operator=(const Site&) = delete;
+        Site& operator=(Site&&) = delete;
+        ~Site();
+
+      private:
+        const char* previous;
+    };
+
+    /**
+     * @brief The arena active on this thread, or nullptr.
+     */
+    static PolynomialArena* active();
+
+    /**
+     * @brief A buffer of at least `size` bytes, 64-byte aligned, which returns to the arena when released.
+     */
+    std::shared_ptr<void> allocate(size_t size);
+
+    // Free the buffers kept for reuse
+    void release_cached();
+
+    size_t live_bytes() const;
+    size_t peak_bytes() const;
+    // Bytes held by released buffers kept for reuse
+    size_t cached_bytes() const;
+    // Usage of each site that allocated from the arena, in order of first allocation
+    std::vector<PolynomialArenaSiteUsage> site_usage() const;
+
+    // Log the usage of every site
+    void print_usage() const;
+
+  private:
+    struct State;
+    std::shared_ptr<State> state;
+};
+
+} // namespace bb
@@ -0,0 +1,127 @@
+#include "polynomial_arena.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+TEST(PolynomialArena, RecyclesReleasedBuffers)
+{
+    PolynomialArena arena;
+    void* first = nullptr;
+    {
+        auto buffer = arena.allocate(1000);
+        first = buffer.get();
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(first) % 64, 0);
+        EXPECT_EQ(arena.live_bytes(), 1024);
+    }
+    EXPECT_EQ(arena.live_bytes(), 0);
+    EXPECT_EQ(arena.cached_bytes(), 1024);
+
+    // A buffer of another size is not served by the released one
+    auto other = arena.allocate(5000);
+    EXPECT_NE(other.get(), first);
+    auto same = arena.allocate(1000);
+    EXPECT_EQ(same.get(), first);
+    EXPECT_EQ(arena.cached_bytes(), 0);
+
+    other.reset();
+    arena.release_cached();
+    EXPECT_EQ(arena.cached_bytes(), 0);
+    EXPECT_EQ(arena.live_bytes(), 1024);
+}
+
+TEST(PolynomialArena, AccountsPerSite)
+{
+    PolynomialArena arena;
+    {
+        PolynomialArena::Site site("first");
+        auto a = arena.allocate(64);
+        auto b = arena.allocate(64);
+    }
+    {
+        PolynomialArena::Site site("second");
+        auto a = arena.allocate(64);
+        {
+            PolynomialArena::Site nested("third");
+            auto b = arena.allocate(128);
+        }
+        auto c = arena.allocate(64);
+    }
+    auto d = arena.allocate(64);
+
+    const auto usage = arena.site_usage();
+    ASSERT_EQ(usage.size(), 4);
+    EXPECT_EQ(usage[0].name, "first");
+    EXPECT_EQ(usage[0].peak_bytes, 128);
+    EXPECT_EQ(usage[0].num_allocations, 2);
+    EXPECT_EQ(usage[0].num_recycled, 0);
+    EXPECT_EQ(usage[1].name, "second");
+    EXPECT_EQ(usage[1].peak_bytes, 128);
+    EXPECT_EQ(usage[1].num_recycled, 2);
+    EXPECT_EQ(usage[2].name, "third");
+    EXPECT_EQ(usage[2].live_bytes, 0);
+    EXPECT_EQ(usage[3].name, "other");
+    EXPECT_EQ(usage[3].live_bytes, 64);
+    EXPECT_EQ(arena.peak_bytes(), 192);
+}
+
+TEST(PolynomialArena, BuffersOutliveArena)
+{
+    std::shared_ptr<void> buffer;
+    {
+        PolynomialArena arena({ .use_huge_pages = true, .max_cached_bytes = 0 });
+        buffer = arena.allocate(3 << 20);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer.get()) % (1 << 21), 0);
+        EXPECT_EQ(arena.live_bytes(), 4 << 20);
+        // Nothing is kept beyond max_cached_bytes
+        arena.allocate(64).reset();
+        EXPECT_EQ(arena.cached_bytes(), 0);
+    }
+    static_cast<char*>(buffer.get())[0] = 1;
+    buffer.reset();
+}
+
+TEST(PolynomialArena, Scope)
+{
+    EXPECT_EQ(PolynomialArena::active(), nullptr);
+    PolynomialArena outer;
+    PolynomialArena inner;
+    {
+        PolynomialArena::Scope outer_scope(outer);
+        EXPECT_EQ(PolynomialArena::active(), &outer);
+        {
+            PolynomialArena::Scope inner_scope(inner);
+            EXPECT_EQ(PolynomialArena::active(), &inner);
+        }
+        EXPECT_EQ(PolynomialArena::active(), &outer);
+    }
+    EXPECT_EQ(PolynomialArena::active(), nullptr);
+}
+
+TEST(PolynomialArena, PolynomialsUnderScope)
+{
+    constexpr size_t SIZE = 1 << 10;
+    PolynomialArena arena;
+    const fr* first = nullptr;
+    {
+        PolynomialArena::Scope scope(arena);
+        {
+            Polynomial<fr> poly(SIZE);
+            first = poly.data();
+            EXPECT_GE(arena.live_bytes(), SIZE * sizeof(fr));
+        }
+        EXPECT_EQ(arena.live_bytes(), 0);
+        EXPECT_GE(arena.cached_bytes(), SIZE * sizeof(fr));
+
+        // The next polynomial of the same size reuses the buffer
+        Polynomial<fr> poly(SIZE);
+        EXPECT_EQ(poly.data(), first);
+        EXPECT_EQ(arena.cached_bytes(), 0);
+    }
+    // Outside of the scope polynomials do not come from the arena
+    Polynomial<fr> poly(SIZE);
+    EXPECT_EQ(arena.live_bytes(), 0);
+    EXPECT_EQ(arena.site_usage().size(), 1);
+    EXPECT_EQ(arena.site_usage()[0].num_allocations, 2);
+}
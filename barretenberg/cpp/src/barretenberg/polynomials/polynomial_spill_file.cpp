@@ -0,0 +1,193 @@
+#include "polynomial_spill_file.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <fcntl.h>
+#include <fstream>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifndef __wasm__
+#include <sys/mman.h>
+#endif
+
+namespace {
+
+using namespace bb;
+
+// Polynomials are aligned to the largest page size we expect to run with (16KiB pages on arm64 macs), so that their
+// pages can be released independently
+constexpr size_t SPILL_ALIGNMENT = 1 << 16;
+
+size_t align_up(size_t value)
+{
+    return (value + SPILL_ALIGNMENT - 1) & ~(SPILL_ALIGNMENT - 1);
+}
+
+template <typename Fr> PolynomialSpillFileHeader expected_header(size_t num_polynomials)
+{
+    PolynomialSpillFileHeader header{};
+    header.magic = PolynomialSpillFileHeader::MAGIC;
+    header.version = PolynomialSpillFileHeader::VERSION;
+    header.element_size = static_cast<uint32_t>(sizeof(Fr));
+    header.num_polynomials = num_polynomials;
+    header.modulus = { Fr::modulus.data[0], Fr::modulus.data[1], Fr::modulus.data[2], Fr::modulus.data[3] };
+    return header;
+}
+
+} // namespace
+
+namespace bb {
+
+template <typename Fr>
+void PolynomialSpillFile<Fr>::write(const std::filesystem::path& path, const RefVector<Polynomial<Fr>>& polynomials)
+{
+    PolynomialSpillFileHeader header = expected_header<Fr>(polynomials.size());
+    std::vector<PolynomialSpillFileEntry> entries;
+    entries.reserve(polynomials.size());
+    size_t offset = align_up(sizeof(header) + (polynomials.size() * sizeof(PolynomialSpillFileEntry)));
+    for (auto& polynomial : polynomials) {
+        entries.push_back({ .start_index = polynomial.start_index(),
+                            .size = polynomial.size(),
+                            .virtual_size = polynomial.virtual_size(),
+                            .offset = offset });
+        offset = align_up(offset + (polynomial.size() * sizeof(Fr)));
+    }
+
+    auto temp_path = path;
+    temp_path += ".tmp." + std::to_string(getpid());
+    {
+        std::ofstream file(temp_path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(entries.data()),
+                   static_cast<std::streamsize>(entries.size() * sizeof(PolynomialSpillFileEntry)));
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            // Seeking past the end leaves a hole that reads back as zeroes
+            file.seekp(static_cast<std::streamoff>(entries[i].offset));
+            file.write(reinterpret_cast<const char*>(polynomials[i].data()),
+                       static_cast<std::streamsize>(entries[i].size * sizeof(Fr)));
+        }
+        if (!file) {
+            std::filesystem::remove(temp_path);
+            throw_or_abort("failed to write polynomial spill file " + temp_path.string());
+        }
+    }
+    // Pad the file to its full size, so that the mapping covers the alignment of the last polynomial
+    std::filesystem::resize_file(temp_path, offset);
+    std::filesystem::rename(temp_path, path);
+}
+
+template <typename Fr>
+std::shared_ptr<PolynomialSpillFile<Fr>> PolynomialSpillFile<Fr>::open(const std::filesystem::path& path)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat st;
+    PolynomialSpillFileHeader header;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(header) ||
+        pread(fd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))) {
+        close(fd);
+        return nullptr;
+    }
+    const auto file_size = static_cast<size_t>(st.st_size);
+    const PolynomialSpillFileHeader expected = expected_header<Fr>(header.num_polynomials);
+    const size_t table_size = header.num_polynomials * sizeof(PolynomialSpillFileEntry);
+    if (header.magic != expected.magic || header.version != expected.version ||
+        header.element_size != expected.element_size || header.modulus != expected.modulus ||
+        file_size < sizeof(header) + table_size) {
+        vinfo("ignoring polynomial spill file with unexpected header at ", path);
+        close(fd);
+        return nullptr;
+    }
+
+    std::shared_ptr<PolynomialSpillFile> file(new PolynomialSpillFile());
+    file->entries_.resize(header.num_polynomials);
+    if (pread(fd, file->entries_.data(), table_size, sizeof(header)) != static_cast<ssize_t>(table_size)) {
+        close(fd);
+        return nullptr;
+    }
+    for (const auto& entry : file->entries_) {
+        if (entry.offset % SPILL_ALIGNMENT != 0 || entry.offset + (entry.size * sizeof(Fr)) > file_size ||
+            entry.start_index + entry.size > entry.virtual_size) {
+            vinfo("ignoring corrupted polynomial spill file at ", path);
+            close(fd);
+            return nullptr;
+        }
+    }
+
+#ifndef __wasm__
+    void* mapping = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+    // The polynomials we hand out alias this pointer, so the file stays mapped until the last of them is destroyed
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    file->mapping_ = std::shared_ptr<uint8_t[]>(static_cast<uint8_t*>(mapping),
+                                                [file_size](uint8_t* data) { munmap(data, file_size); });
+#else
+    for (const auto& entry : file->entries_) {
+        Polynomial<Fr> polynomial(entry.size, entry.virtual_size, entry.start_index);
+        const auto num_bytes = static_cast<ssize_t>(entry.size * sizeof(Fr));
+        if (pread(fd, polynomial.data(), static_cast<size_t>(num_bytes), static_cast<off_t>(entry.offset)) !=
+            num_bytes) {
+            close(fd);
+            return nullptr;
+        }
+        file->polynomials_.push_back(std::move(polynomial));
+    }
+    close(fd);
+#endif
+    return file;
+}
+
+template <typename Fr> std::vector<Polynomial<Fr>> PolynomialSpillFile<Fr>::get_polynomials() const
+{
+    std::vector<Polynomial<Fr>> polynomials;
+    polynomials.reserve(entries_.size());
+#ifndef __wasm__
+    for (const auto& entry : entries_) {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        std::shared_ptr<Fr[]> coefficients(mapping_, reinterpret_cast<Fr*>(mapping_.get() + entry.offset));
+        polynomials.emplace_back(std::move(coefficients), entry.size, entry.virtual_size, entry.start_index);
+    }
+#else
+    for (const auto& polynomial : polynomials_) {
+        polynomials.push_back(polynomial.share());
+    }
+#endif
+    return polynomials;
+}
+
+template <typename Fr> void PolynomialSpillFile<Fr>::release_rows(size_t begin, size_t end) const
+{
+#ifndef __wasm__
+    static const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    for (const auto& entry : entries_) {
+        const size_t first = std::max<size_t>(begin, entry.start_index);
+        const size_t last = std::min<size_t>(end, entry.start_index + entry.size);
+        if (first >= last) {
+            continue;
+        }
+        // Round down at both ends, so that we never drop a page that still holds rows yet to be consumed
+        const size_t byte_begin = entry.offset + ((first - entry.start_index) * sizeof(Fr));
+        const size_t byte_end = entry.offset + ((last - entry.start_index) * sizeof(Fr));
+        const size_t page_begin = byte_begin / page_size * page_size;
+        // The alignment padding after a polynomial belongs to it, so its last partial page can go too
+        const size_t page_end =
+            last == entry.start_index + entry.size ? align_up(byte_end) : byte_end / page_size * page_size;
+        if (page_begin < page_end) {
+            madvise(mapping_.get() + page_begin, page_end - page_begin, MADV_DONTNEED);
+        }
+    }
+#else
+    static_cast<void>(begin);
+    static_cast<void>(end);
+#endif
+}
+
+template class PolynomialSpillFile<bb::fr>;
+template class PolynomialSpillFile<grumpkin::fr>;
+
+} // namespace bb
@@ -0,0 +1,104 @@
+#pragma once
+#include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief Header of a polynomial spill file.
+ * @details A spill file stores a set of polynomials exactly as they are laid out in memory, so that they can be
+ * memory-mapped back instead of kept resident:
+ *
+ *      | header (64 bytes) | table entry 0 | ... | table entry k - 1 | (page aligned) coefficients of polynomial 0 |
+ *      | (page aligned) coefficients of polynomial 1 | ...
+ *
+ * Every polynomial starts on a page boundary so that the pages of one polynomial can be released independently of its
+ * neighbours. Spill files are scratch files written and read back by the same build, so the header only guards against
+ * reading a file of another format or field.
+ */
+struct PolynomialSpillFileHeader {
+    static constexpr std::array<char, 8> MAGIC = { 'B', 'B', 'P', 'O', 'L', 'S', 'P', 'L' };
+    static constexpr uint32_t VERSION = 1;
+
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t element_size;
+    uint64_t num_polynomials;
+    std::array<uint64_t, 4> modulus;
+    uint64_t reserved;
+};
+static_assert(sizeof(PolynomialSpillFileHeader) == 64);
+
+/**
+ * @brief Location of one polynomial in a spill file.
+ */
+struct PolynomialSpillFileEntry {
+    uint64_t start_index;
+    uint64_t size;
+    uint64_t virtual_size;
+    // Byte offset of the coefficients from the start of the file
+    uint64_t offset;
+};
+
+/**
+ * @brief A set of polynomials spilled to disk and memory-mapped back.
+ * @details The polynomials returned by get_polynomials() are backed directly by a private mapping of the file: their
+ * pages are only read when first touched, and being clean and file backed they do not count against the memory a node
+ * has to reserve and can be dropped by the kernel (or explicitly, see release_rows()) once they have been consumed.
+ * The mapping outlives this object for as long as any of the polynomials handed out is alive. On wasm, where mmap is
+ * unavailable, the polynomials are read into memory instead.
+ *
+ * @tparam Fr the coefficient field
+ */
+template <typename Fr> class PolynomialSpillFile {
+  public:
+    PolynomialSpillFile(const PolynomialSpillFile&) = delete;
+    PolynomialSpillFile(PolynomialSpillFile&&) = delete;
+    PolynomialSpillFile& operator=(const PolynomialSpillFile&) = delete;
+    PolynomialSpillFile& operator=(PolynomialSpillFile&&) = delete;
+    ~PolynomialSpillFile() = default;
+
+    /**
+     * @brief Write `polynomials` to a spill file at `path`.
+     * @details The file is written under a temporary name and then renamed, so a reader never sees a partial file.
+     */
+    static void write(const std::filesystem::path& path, const RefVector<Polynomial<Fr>>& polynomials);
+
+    /**
+     * @brief Map the spill file at `path`.
+     * @return nullptr if the file does not exist or fails validation
+     */
+    static std::shared_ptr<PolynomialSpillFile> open(const std::filesystem::path& path);
+
+    /**
+     * @brief The spilled polynomials, in the order they were written, sharing the memory of the mapping.
+     */
+    std::vector<Polynomial<Fr>> get_polynomials() const;
+
+    /**
+     * @brief Drop the pages holding the coefficients at indices [begin, end) of every polynomial from memory.
+     * @details Meant for consuming the polynomials front to back: the page holding `begin` is released, the page
+     * holding `end` is kept. A later access reads released pages back from the file. Rows must not have been modified
+     * through the mapping, as such modifications would be lost.
+     */
+    void release_rows(size_t begin, size_t end) const;
+
+    size_t num_polynomials() const { return entries_.size(); }
+
+  private:
+    PolynomialSpillFile() = default;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    std::shared_ptr<uint8_t[]> mapping_;
+    std::vector<PolynomialSpillFileEntry> entries_;
+    // Only used when mmap is unavailable
+    std::vector<Polynomial<Fr>> polynomials_;
+};
+
+} // namespace bb
@@ -196,7 +196,7 @@ template <typename FF_> class LogDerivLookupRelationImpl {
         });
 
         // Compute inverse polynomial I in place by inverting the product at each row
-        FF::batch_invert(inverse_polynomial.coeffs());
+        FF::parallel_batch_invert(inverse_polynomial.coeffs());
     };
 
     /**
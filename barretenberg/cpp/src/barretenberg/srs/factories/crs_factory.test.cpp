@@ -3,6 +3,7 @@
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/srs/factories/mem_bn254_crs_factory.hpp"
+#include "barretenberg/srs/factories/mapped_crs_file.hpp"
 #include "barretenberg/srs/factories/mem_grumpkin_crs_factory.hpp"
 #include "barretenberg/srs/factories/native_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
@@ -100,3 +101,50 @@ TEST(CrsFactory, grumpkin)
     ASSERT_ANY_THROW(check_grumpkin_consistency(temp_crs_path, 1, /*allow_download=*/false));
     check_grumpkin_consistency(temp_crs_path, 1, /*allow_download=*/true);
 }
+
+TEST(CrsFactory, MappedCrsFile)
+{
+    using MappedFile = MappedCrsFile<curve::BN254>;
+    const fs::path temp_crs_path = "barretenberg_srs_test_mapped_crs";
+    fs::remove_all(temp_crs_path);
+    fs::create_directories(temp_crs_path);
+    const fs::path native_path = temp_crs_path / "bn254_g1.native.dat";
+
+    const size_t num_points = 100;
+    std::vector<g1::affine_element> points(num_points);
+    for (auto& point : points) {
+        point = g1::affine_element(g1::one * fr::random_element());
+    }
+    EXPECT_EQ(MappedFile::open(native_path, num_points), nullptr);
+    MappedFile::write(native_path, points);
+
+    // The points are read back in place and a mapped crs serves them like an in-memory one
+    auto mapped = MappedFile::open(native_path, num_points / 2);
+    ASSERT_NE(mapped, nullptr);
+    EXPECT_EQ(mapped->size(), num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        EXPECT_EQ(mapped->get_points()[i], points[i]);
+    }
+    MemBn254CrsFactory mem_crs(mapped, g2::one);
+    EXPECT_EQ(mem_crs.get_crs(num_points)->get_monomial_points()[num_points - 1], points[num_points - 1]);
+
+    // A file with too few points or for another curve is rejected
+    EXPECT_EQ(MappedFile::open(native_path, num_points + 1), nullptr);
+    EXPECT_EQ(MappedCrsFile<curve::Grumpkin>::open(native_path, 1), nullptr);
+    {
+        std::fstream file(native_path, std::ios::binary | std::ios::in | std::ios::out);
+        const size_t corrupted_idx = num_points / 2;
+        file.seekp(static_cast<std::streamoff>(sizeof(NativeCrsFileHeader) +
+                                               (corrupted_idx * sizeof(g1::affine_element))));
+        file.put(static_cast<char>(~points[corrupted_idx].x.data[0] & 0xff));
+    }
+    // A point corrupted between the checked ones is only caught by verifying the checksum, the first point always is
+    EXPECT_EQ(MappedFile::open(native_path, 1, /*verify_checksum=*/true), nullptr);
+    {
+        std::fstream file(native_path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(sizeof(NativeCrsFileHeader)));
+        file.put(static_cast<char>(~points[0].x.data[0] & 0xff));
+    }
+    EXPECT_EQ(MappedFile::open(native_path, 1), nullptr);
+    fs::remove_all(temp_crs_path);
+}
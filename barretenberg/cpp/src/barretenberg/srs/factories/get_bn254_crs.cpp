@@ -73,6 +73,35 @@ std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& p
     return points;
 }
 
+/**
+ * @brief Memory-map the bn254 G1 points from the native CRS file, converting the canonical file on first use
+ * @details Loading the canonical file parses every point into a vector; the native file (see NativeCrsFileHeader) is
+ * used in place, so repeated loads cost a handful of page faults instead. It is rewritten whenever more points than
+ * it holds are requested.
+ */
+std::shared_ptr<srs::factories::MappedCrsFile<curve::BN254>> get_bn254_g1_mapped_data(
+    const std::filesystem::path& path, size_t num_points, bool allow_download)
+{
+    using MappedFile = srs::factories::MappedCrsFile<curve::BN254>;
+    std::filesystem::create_directories(path);
+
+    auto native_path = path / "bn254_g1.native.dat";
+    if (auto mapped = MappedFile::open(native_path, num_points)) {
+        vinfo("using mapped bn254 crs with num points ", std::to_string(mapped->size()), " at ", native_path);
+        return mapped;
+    }
+
+    auto points = get_bn254_g1_data(path, num_points, allow_download);
+    vinfo("converting bn254 crs to native format at ", native_path);
+    MappedFile::write(native_path, points);
+    // Verify the whole file once, later loads only check its header and a few points
+    auto mapped = MappedFile::open(native_path, num_points, /*verify_checksum=*/true);
+    if (mapped == nullptr) {
+        throw_or_abort("failed to map converted bn254 crs at " + native_path.string());
+    }
+    return mapped;
+}
+
 g2::affine_element get_bn254_g2_data(const std::filesystem::path& path, bool allow_download)
 {
     std::filesystem::create_directories(path);
@@ -1,6 +1,7 @@
 #pragma once
 #include <barretenberg/ecc/curves/bn254/g1.hpp>
 #include <barretenberg/ecc/curves/bn254/g2.hpp>
+#include <barretenberg/srs/factories/mapped_crs_file.hpp>
 #include <filesystem>
 #include <fstream>
 #include <ios>
@@ -9,5 +10,7 @@ namespace bb {
 std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& path,
                                                   size_t num_points,
                                                   bool allow_download = true);
+std::shared_ptr<srs::factories::MappedCrsFile<curve::BN254>> get_bn254_g1_mapped_data(
+    const std::filesystem::path& path, size_t num_points, bool allow_download = true);
 g2::affine_element get_bn254_g2_data(const std::filesystem::path& path, bool allow_download = true);
 } // namespace bb
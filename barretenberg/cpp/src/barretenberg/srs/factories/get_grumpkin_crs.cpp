@@ -63,4 +63,31 @@ std::vector<curve::Grumpkin::AffineElement> get_grumpkin_g1_data(const std::file
     }
     return points;
 }
+
+/**
+ * @brief Memory-map the grumpkin G1 points from the native CRS file, converting the canonical file on first use
+ * @details See get_bn254_g1_mapped_data.
+ */
+std::shared_ptr<srs::factories::MappedCrsFile<curve::Grumpkin>> get_grumpkin_g1_mapped_data(
+    const std::filesystem::path& path, size_t num_points, bool allow_download)
+{
+    using MappedFile = srs::factories::MappedCrsFile<curve::Grumpkin>;
+    std::filesystem::create_directories(path);
+
+    auto native_path = path / "grumpkin_g1.native.dat";
+    if (auto mapped = MappedFile::open(native_path, num_points)) {
+        vinfo("using mapped grumpkin crs with num points ", mapped->size(), " at: ", native_path);
+        return mapped;
+    }
+
+    auto points = get_grumpkin_g1_data(path, num_points, allow_download);
+    vinfo("converting grumpkin crs to native format at ", native_path);
+    MappedFile::write(native_path, points);
+    // Verify the whole file once, later loads only check its header and a few points
+    auto mapped = MappedFile::open(native_path, num_points, /*verify_checksum=*/true);
+    if (mapped == nullptr) {
+        throw_or_abort("failed to map converted grumpkin crs at " + native_path.string());
+    }
+    return mapped;
+}
 } // namespace bb
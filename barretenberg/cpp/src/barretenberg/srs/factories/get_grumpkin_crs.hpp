@@ -1,6 +1,7 @@
 #pragma once
 #include <barretenberg/ecc/curves/bn254/g1.hpp>
 #include <barretenberg/ecc/curves/grumpkin/grumpkin.hpp>
+#include <barretenberg/srs/factories/mapped_crs_file.hpp>
 #include <filesystem>
 #include <fstream>
 #include <ios>
@@ -10,5 +11,7 @@ namespace bb {
 std::vector<curve::Grumpkin::AffineElement> get_grumpkin_g1_data(const std::filesystem::path& path,
                                                                  size_t num_points,
                                                                  bool allow_download = true);
+std::shared_ptr<srs::factories::MappedCrsFile<curve::Grumpkin>> get_grumpkin_g1_mapped_data(
+    const std::filesystem::path& path, size_t num_points, bool allow_download = true);
 
 }
@@ -0,0 +1,196 @@
+#include "mapped_crs_file.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifndef __wasm__
+#include <sys/mman.h>
+#endif
+
+namespace {
+
+using namespace bb::srs::factories;
+
+// FNV-1a
+uint64_t hash_bytes(const void* data, size_t size, uint64_t hash = 0xcbf29ce484222325ULL)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// FNV-1a over 64-bit words, for data whose size is a multiple of 8 bytes
+uint64_t hash_words(const void* data, size_t size, uint64_t hash = 0xcbf29ce484222325ULL)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        hash ^= word;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+template <typename Curve> NativeCrsFileHeader expected_header(size_t num_points)
+{
+    using BaseField = typename Curve::BaseField;
+    NativeCrsFileHeader header{};
+    header.magic = NativeCrsFileHeader::MAGIC;
+    header.version = NativeCrsFileHeader::VERSION;
+    header.point_size = static_cast<uint32_t>(sizeof(typename Curve::AffineElement));
+    header.num_points = num_points;
+    header.modulus = { BaseField::modulus.data[0],
+                       BaseField::modulus.data[1],
+                       BaseField::modulus.data[2],
+                       BaseField::modulus.data[3] };
+    const BaseField one = BaseField::one();
+    header.montgomery_one = { one.data[0], one.data[1], one.data[2], one.data[3] };
+    return header;
+}
+
+/**
+ * @brief Checksum of the header fields and all the points
+ * @details The points are hashed in fixed-size chunks in parallel and the chunk hashes are then hashed together, so
+ * the checksum does not depend on the number of threads.
+ */
+template <typename AffineElement>
+uint64_t compute_checksum(const NativeCrsFileHeader& header, std::span<const AffineElement> points)
+{
+    static_assert(sizeof(AffineElement) % sizeof(uint64_t) == 0);
+    constexpr size_t POINTS_PER_CHUNK = 1 << 14;
+    const size_t num_chunks = (points.size() + POINTS_PER_CHUNK - 1) / POINTS_PER_CHUNK;
+    std::vector<uint64_t> chunk_hashes(num_chunks);
+    parallel_for(num_chunks, [&](size_t chunk_idx) {
+        const auto chunk = points.subspan(chunk_idx * POINTS_PER_CHUNK,
+                                          std::min(POINTS_PER_CHUNK, points.size() - (chunk_idx * POINTS_PER_CHUNK)));
+        chunk_hashes[chunk_idx] = hash_words(chunk.data(), chunk.size_bytes());
+    });
+    const uint64_t hash = hash_bytes(&header, offsetof(NativeCrsFileHeader, checksum));
+    return hash_words(chunk_hashes.data(), chunk_hashes.size() * sizeof(uint64_t), hash);
+}
+
+} // namespace
+
+namespace bb::srs::factories {
+
+template <typename Curve> MappedCrsFile<Curve>::~MappedCrsFile()
+{
+#ifndef __wasm__
+    if (mapping_ != nullptr) {
+        munmap(mapping_, mapping_size_);
+    }
+#endif
+}
+
+template <typename Curve>
+std::shared_ptr<MappedCrsFile<Curve>> MappedCrsFile<Curve>::open(const std::filesystem::path& path,
+                                                                  size_t num_points,
+                                                                  bool verify_checksum)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat st;
+    NativeCrsFileHeader header;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(header) ||
+        pread(fd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))) {
+        close(fd);
+        return nullptr;
+    }
+    const auto file_size = static_cast<size_t>(st.st_size);
+
+    // Everything but the point count and checksum is fixed by the curve and the build
+    NativeCrsFileHeader expected = expected_header<Curve>(header.num_points);
+    const bool header_matches = header.magic == expected.magic && header.version == expected.version &&
+                                header.point_size == expected.point_size && header.modulus == expected.modulus &&
+                                header.montgomery_one == expected.montgomery_one;
+    if (!header_matches || header.num_points == 0 ||
+        file_size != sizeof(header) + (header.num_points * sizeof(AffineElement))) {
+        vinfo("ignoring native crs file with unexpected header at ", path);
+        close(fd);
+        return nullptr;
+    }
+    if (header.num_points < num_points) {
+        close(fd);
+        return nullptr;
+    }
+
+    std::shared_ptr<MappedCrsFile> file(new MappedCrsFile());
+#ifndef __wasm__
+    void* mapping = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+    file->mapping_ = mapping;
+    file->mapping_size_ = file_size;
+    file->points_ = { reinterpret_cast<AffineElement*>(static_cast<uint8_t*>(mapping) + sizeof(header)),
+                      header.num_points };
+#else
+    file->buffer_.resize(header.num_points);
+    const auto points_size = static_cast<ssize_t>(header.num_points * sizeof(AffineElement));
+    const bool read_ok =
+        pread(fd, file->buffer_.data(), static_cast<size_t>(points_size), sizeof(header)) == points_size;
+    close(fd);
+    if (!read_ok) {
+        return nullptr;
+    }
+    file->points_ = file->buffer_;
+#endif
+
+    // Checking the whole checksum reads every page of the file, so by default only a few points spread over the file
+    // are checked, which faults in a handful of pages
+    std::span<const AffineElement> points = file->points_;
+    bool valid = true;
+    if (verify_checksum) {
+        valid = header.checksum == compute_checksum(header, points);
+    }
+    constexpr size_t NUM_CHECKED_POINTS = 8;
+    for (size_t i = 0; valid && i < NUM_CHECKED_POINTS; ++i) {
+        valid = points[i * (points.size() - 1) / (NUM_CHECKED_POINTS - 1)].on_curve();
+    }
+    if (!valid) {
+        vinfo("ignoring corrupted native crs file at ", path);
+        return nullptr;
+    }
+    return file;
+}
+
+template <typename Curve>
+void MappedCrsFile<Curve>::write(const std::filesystem::path& path, std::span<const AffineElement> points)
+{
+    if (points.empty()) {
+        throw_or_abort("cannot write an empty native crs file");
+    }
+    NativeCrsFileHeader header = expected_header<Curve>(points.size());
+    header.checksum = compute_checksum(header, points);
+
+    auto temp_path = path;
+    temp_path += ".tmp." + std::to_string(getpid());
+    {
+        std::ofstream file(temp_path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(points.data()),
+                   static_cast<std::streamsize>(points.size() * sizeof(AffineElement)));
+        if (!file) {
+            std::filesystem::remove(temp_path);
+            throw_or_abort("failed to write native crs file " + temp_path.string());
+        }
+    }
+    std::filesystem::rename(temp_path, path);
+}
+
+template class MappedCrsFile<curve::BN254>;
+template class MappedCrsFile<curve::Grumpkin>;
+
+} // namespace bb::srs::factories
@@ -0,0 +1,92 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace bb::srs::factories {
+
+/**
+ * @brief Header of a native CRS point file.
+ * @details The canonical transcript files (bn254_g1.dat, grumpkin_g1.flat.dat) store points big-endian and out of
+ * Montgomery form, so every load has to parse each point into a freshly allocated vector. A native file stores the
+ * points exactly as they are laid out in memory (Montgomery form, host endianness) after this header, so it can be
+ * memory-mapped and used in place:
+ *
+ *      | header (128 bytes) | point 0 | point 1 | ... | point num_points - 1 |
+ *
+ * The header records everything that determines the in-memory representation of a point (size, base field modulus
+ * and the Montgomery form of one, which differs between native and wasm builds). A file written for another curve,
+ * representation or format version, or a truncated one, is rejected and regenerated from the canonical file.
+ */
+struct NativeCrsFileHeader {
+    static constexpr std::array<char, 8> MAGIC = { 'B', 'B', 'C', 'R', 'S', 'N', 'A', 'T' };
+    static constexpr uint32_t VERSION = 2;
+
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t point_size;
+    uint64_t num_points;
+    std::array<uint64_t, 4> modulus;
+    std::array<uint64_t, 4> montgomery_one;
+    // Checksum of the fields above together with every point, see MappedCrsFile::open
+    uint64_t checksum;
+    std::array<uint8_t, 32> reserved;
+};
+static_assert(sizeof(NativeCrsFileHeader) == 128, "the points of a native CRS file must stay 64-byte aligned");
+
+/**
+ * @brief A read-only native CRS point file, memory-mapped so that the CRS can hand out a span directly over it.
+ * @details Being file backed, the pages holding the points are shared between processes and can be dropped by the
+ * kernel under memory pressure. The mapping is private, so the (mutable) span returned by get_points() can never write
+ * through to the file. On wasm, where mmap is unavailable, the file is read into memory instead.
+ *
+ * @tparam Curve bn254 or grumpkin
+ */
+template <typename Curve> class MappedCrsFile {
+    using AffineElement = typename Curve::AffineElement;
+
+  public:
+    MappedCrsFile(const MappedCrsFile&) = delete;
+    MappedCrsFile(MappedCrsFile&&) = delete;
+    MappedCrsFile& operator=(const MappedCrsFile&) = delete;
+    MappedCrsFile& operator=(MappedCrsFile&&) = delete;
+    ~MappedCrsFile();
+
+    /**
+     * @brief Map the native CRS file at `path` if it is valid and holds at least `num_points` points.
+     * @details The header and the file size are always validated, and a few points spread over the file are checked
+     * to be on the curve. The checksum of all the points is only verified if `verify_checksum` is set, as that reads
+     * the whole file; this is done once, right after the file is written.
+     * @return nullptr if the file does not exist, is too small or fails validation
+     */
+    static std::shared_ptr<MappedCrsFile> open(const std::filesystem::path& path,
+                                               size_t num_points,
+                                               bool verify_checksum = false);
+
+    /**
+     * @brief Write `points` to a native CRS file at `path`.
+     * @details The file is written under a temporary name and then renamed, so concurrent readers either see the
+     * previous file or the complete new one.
+     */
+    static void write(const std::filesystem::path& path, std::span<const AffineElement> points);
+
+    std::span<AffineElement> get_points() const { return points_; }
+    size_t size() const { return points_.size(); }
+
+  private:
+    MappedCrsFile() = default;
+
+    void* mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+    // Only used when mmap is unavailable
+    std::vector<AffineElement> buffer_;
+    std::span<AffineElement> points_;
+};
+
+} // namespace bb::srs::factories
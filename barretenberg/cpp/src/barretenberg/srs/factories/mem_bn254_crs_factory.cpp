@@ -20,15 +20,32 @@ class MemBn254Crs : public Crs<curve::BN254> {
     MemBn254Crs& operator=(MemBn254Crs&&) = delete;
 
     MemBn254Crs(std::vector<Curve::AffineElement> const& points, g2::affine_element const& g2_point)
+        : MemBn254Crs(std::make_shared<std::vector<Curve::AffineElement>>(points), g2_point)
+    {}
+
+    MemBn254Crs(std::shared_ptr<std::vector<Curve::AffineElement>> points, g2::affine_element const& g2_point)
+        : MemBn254Crs(std::span<Curve::AffineElement>(*points), points, g2_point)
+    {}
+
+    MemBn254Crs(std::shared_ptr<MappedCrsFile<Curve>> mapped_points, g2::affine_element const& g2_point)
+        : MemBn254Crs(mapped_points->get_points(), mapped_points, g2_point)
+    {}
+
+    /**
+     * @param points the monomial points, which must stay valid for the lifetime of `storage`
+     */
+    MemBn254Crs(std::span<Curve::AffineElement> points,
+                std::shared_ptr<const void> storage,
+                g2::affine_element const& g2_point)
         : g2_x(g2_point)
         , precomputed_g2_lines(
               static_cast<pairing::miller_lines*>(aligned_alloc(64, sizeof(bb::pairing::miller_lines) * 2)))
-        , monomials_(points.size())
+        , storage_(std::move(storage))
+        , monomials_(points)
     {
         if (points.empty() || !points[0].on_curve()) {
             throw_or_abort("invalid g1_identity passed to MemBn254CrsFactory");
         }
-        std::copy(points.begin(), points.end(), monomials_.begin());
         bb::pairing::precompute_miller_lines(bb::g2::one, precomputed_g2_lines[0]);
         bb::pairing::precompute_miller_lines(g2_x, precomputed_g2_lines[1]);
     }
@@ -47,7 +64,9 @@ class MemBn254Crs : public Crs<curve::BN254> {
   private:
     g2::affine_element g2_x;
     pairing::miller_lines* precomputed_g2_lines;
-    std::vector<Curve::AffineElement> monomials_;
+    // Owns the memory behind monomials_: either a vector of points or a memory-mapped native CRS file
+    std::shared_ptr<const void> storage_;
+    std::span<Curve::AffineElement> monomials_;
 };
 
 } // namespace
@@ -61,6 +80,13 @@ MemBn254CrsFactory::MemBn254CrsFactory(std::vector<g1::affine_element> const& po
     vinfo("Initialized ", curve::BN254::name, " CRS from memory with num points = ", crs_->get_monomial_size());
 }
 
+MemBn254CrsFactory::MemBn254CrsFactory(std::shared_ptr<MappedCrsFile<curve::BN254>> mapped_points,
+                                       g2::affine_element const& g2_point)
+    : crs_(std::make_shared<MemBn254Crs>(std::move(mapped_points), g2_point))
+{
+    vinfo("Initialized ", curve::BN254::name, " CRS from mapped file with num points = ", crs_->get_monomial_size());
+}
+
 std::shared_ptr<bb::srs::factories::Crs<curve::BN254>> MemBn254CrsFactory::get_crs(size_t degree)
 {
     if (crs_->get_monomial_size() < degree) {
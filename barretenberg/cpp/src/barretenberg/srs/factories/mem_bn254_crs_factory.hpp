@@ -3,6 +3,7 @@
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/bn254/g2.hpp"
 #include "crs_factory.hpp"
+#include "mapped_crs_file.hpp"
 #include <cstddef>
 #include <utility>
 
@@ -11,11 +12,13 @@ namespace bb::srs::factories {
 /**
  * Create reference strings given pointers to in memory buffers.
  *
- * This class is currently only used with wasm and works exclusively with the BN254 CRS.
+ * This class works exclusively with the BN254 CRS. The points are either copied from a vector or used in place from a
+ * memory-mapped native CRS file.
  */
 class MemBn254CrsFactory : public CrsFactory<curve::BN254> {
   public:
     MemBn254CrsFactory(std::vector<g1::affine_element> const& points, g2::affine_element const& g2_point);
+    MemBn254CrsFactory(std::shared_ptr<MappedCrsFile<curve::BN254>> mapped_points, g2::affine_element const& g2_point);
 
     std::shared_ptr<Crs<curve::BN254>> get_crs(size_t degree) override;
 
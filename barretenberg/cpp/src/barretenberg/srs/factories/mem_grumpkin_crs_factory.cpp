@@ -17,10 +17,18 @@ class MemGrumpkinCrs : public Crs<Grumpkin> {
     MemGrumpkinCrs& operator=(MemGrumpkinCrs&&) = delete;
 
     MemGrumpkinCrs(std::vector<Grumpkin::AffineElement> const& points)
-        : monomials_(points.size())
-    {
-        std::copy(points.begin(), points.end(), monomials_.begin());
-    }
+        : MemGrumpkinCrs(std::make_shared<std::vector<Grumpkin::AffineElement>>(points))
+    {}
+
+    MemGrumpkinCrs(std::shared_ptr<std::vector<Grumpkin::AffineElement>> points)
+        : storage_(points)
+        , monomials_(*points)
+    {}
+
+    MemGrumpkinCrs(std::shared_ptr<MappedCrsFile<Grumpkin>> mapped_points)
+        : storage_(mapped_points)
+        , monomials_(mapped_points->get_points())
+    {}
 
     ~MemGrumpkinCrs() override = default;
     std::span<Grumpkin::AffineElement> get_monomial_points() override { return monomials_; }
@@ -28,7 +36,9 @@ class MemGrumpkinCrs : public Crs<Grumpkin> {
     Grumpkin::AffineElement get_g1_identity() const override { return monomials_[0]; };
 
   private:
-    std::vector<Grumpkin::AffineElement> monomials_;
+    // Owns the memory behind monomials_: either a vector of points or a memory-mapped native CRS file
+    std::shared_ptr<const void> storage_;
+    std::span<Grumpkin::AffineElement> monomials_;
 };
 
 } // namespace
@@ -45,6 +55,18 @@ MemGrumpkinCrsFactory::MemGrumpkinCrsFactory(const std::vector<Grumpkin::AffineE
         "Initialized ", curve::Grumpkin::name, " prover CRS from memory with num points = ", crs_->get_monomial_size());
 }
 
+MemGrumpkinCrsFactory::MemGrumpkinCrsFactory(std::shared_ptr<MappedCrsFile<Grumpkin>> mapped_points)
+    : crs_(std::make_shared<MemGrumpkinCrs>(mapped_points))
+{
+    if (mapped_points->get_points().empty() || !mapped_points->get_points()[0].on_curve()) {
+        throw_or_abort("invalid mapped file passed to MemGrumpkinCrsFactory");
+    }
+    vinfo("Initialized ",
+          curve::Grumpkin::name,
+          " prover CRS from mapped file with num points = ",
+          crs_->get_monomial_size());
+}
+
 std::shared_ptr<bb::srs::factories::Crs<Grumpkin>> MemGrumpkinCrsFactory::get_crs(size_t degree)
 {
     if (crs_->get_monomial_size() < degree) {
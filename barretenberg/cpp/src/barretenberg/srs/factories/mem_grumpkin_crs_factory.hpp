@@ -1,5 +1,6 @@
 #pragma once
 #include "crs_factory.hpp"
+#include "mapped_crs_file.hpp"
 #include <cstddef>
 #include <utility>
 
@@ -8,11 +9,13 @@ namespace bb::srs::factories {
 /**
  * Create reference strings given pointers to in memory buffers.
  *
- * This class is currently only used with wasm and works exclusively with the Grumpkin CRS.
+ * This class works exclusively with the Grumpkin CRS. The points are either copied from a vector or used in place
+ * from a memory-mapped native CRS file.
  */
 class MemGrumpkinCrsFactory : public CrsFactory<curve::Grumpkin> {
   public:
     MemGrumpkinCrsFactory(const std::vector<curve::Grumpkin::AffineElement>& points);
+    MemGrumpkinCrsFactory(std::shared_ptr<MappedCrsFile<curve::Grumpkin>> mapped_points);
     MemGrumpkinCrsFactory(MemGrumpkinCrsFactory&& other) = default;
 
     std::shared_ptr<Crs<curve::Grumpkin>> get_crs(size_t degree) override;
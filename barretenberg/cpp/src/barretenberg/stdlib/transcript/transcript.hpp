@@ -8,9 +8,12 @@
 
 #include "barretenberg/crypto/poseidon2/poseidon2.hpp"
 #include "barretenberg/stdlib/hash/poseidon2/poseidon2.hpp"
+#include "barretenberg/stdlib/hash/poseidon2/sponge/sponge.hpp"
 #include "barretenberg/stdlib/primitives/field/field_conversion.hpp"
 #include "barretenberg/stdlib/primitives/group/cycle_group.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include <optional>
+#include <vector>
 namespace bb::stdlib::recursion::honk {
 
 template <typename Builder> struct StdlibTranscriptParams {
@@ -66,6 +69,69 @@ template <typename Builder> struct StdlibTranscriptParams {
     }
 };
 
+/**
+ * @brief In-circuit counterpart of NativeSpongeTranscriptParams
+ */
+template <typename Builder> struct StdlibSpongeTranscriptParams : public StdlibTranscriptParams<Builder> {
+    using Fr = stdlib::field_t<Builder>;
+
+    class Sponge {
+      public:
+        /**
+         * @brief Start the sponge in the circuit of the transcript
+         * @details Called by the transcript once it knows its builder, from the proof it loads or the first element
+         * with a context it is given. Elements absorbed before, such as constants, are absorbed into the sponge then.
+         */
+        void set_context(Builder* builder)
+        {
+            if (sponge.has_value() || builder == nullptr) {
+                return;
+            }
+            sponge.emplace(*builder, Fr(bb::fr(TRANSCRIPT_SPONGE_DOMAIN_SEPARATOR)));
+            for (const Fr& element : pending) {
+                sponge->absorb(element);
+            }
+            pending.clear();
+        }
+
+        void absorb(const Fr& element)
+        {
+            if (sponge.has_value()) {
+                sponge->absorb(element);
+            } else {
+                pending.emplace_back(element);
+            }
+        }
+
+        Fr squeeze()
+        {
+            if (!sponge.has_value()) {
+                throw_or_abort("Transcript sponge squeezed before the transcript is given a circuit builder");
+            }
+            Fr result = sponge->squeeze();
+            // The state now mixes the submissions of every round so far. The transcript tags the squeezed challenge as
+            // such; the state left behind plays the part of the previous challenge of the hashing mode, so it must not
+            // carry the submitted tags into the next round
+            for (auto& element : sponge->state) {
+                element.set_origin_tag(OriginTag());
+            }
+            for (auto& element : sponge->cache) {
+                element.set_origin_tag(OriginTag());
+            }
+            return result;
+        }
+
+      private:
+        using Params = crypto::Poseidon2Bn254ScalarFieldParams;
+        std::optional<stdlib::FieldSponge<Params::t - 1, 1, Params::t, Poseidon2Permutation<Params, Builder>, Builder>>
+            sponge;
+        // The elements absorbed before the builder is known
+        std::vector<Fr> pending;
+    };
+};
+
 using UltraStdlibTranscript = BaseTranscript<StdlibTranscriptParams<UltraCircuitBuilder>>;
 using MegaStdlibTranscript = BaseTranscript<StdlibTranscriptParams<MegaCircuitBuilder>>;
+using UltraStdlibSpongeTranscript = BaseTranscript<StdlibSpongeTranscriptParams<UltraCircuitBuilder>>;
+using MegaStdlibSpongeTranscript = BaseTranscript<StdlibSpongeTranscriptParams<MegaCircuitBuilder>>;
 } // namespace bb::stdlib::recursion::honk
\ No newline at end of file
@@ -188,6 +188,94 @@ TEST(RecursiveHonkTranscript, ReturnValuesMatch)
     EXPECT_EQ(static_cast<FF>(native_beta), stdlib_beta.get_value());
 }
 
+/**
+ * @brief Check that the native and stdlib transcripts in sponge mode produce the same challenges, over rounds which
+ * fill the sponge rate exactly, overflow it, and send nothing
+ */
+TEST(RecursiveHonkTranscript, SpongeModeValuesMatch)
+{
+    using Commitment = UltraFlavor::Commitment;
+    using commitment_ct = UltraRecursiveFlavor::Commitment;
+    using field_ct = field_t<Builder>;
+    Builder builder;
+
+    constexpr size_t LENGTH = 7;
+    std::array<FF, LENGTH> evaluations;
+    for (auto& eval : evaluations) {
+        eval = FF::random_element();
+    }
+
+    NativeSpongeTranscript prover_transcript;
+    prover_transcript.send_to_verifier("commitment", Commitment::one());
+    auto [prover_alpha, prover_beta, prover_gamma] = prover_transcript.get_challenges<FF>("alpha", "beta", "gamma");
+    prover_transcript.send_to_verifier("evaluations", evaluations);
+    auto prover_delta = prover_transcript.get_challenge<FF>("delta");
+    auto prover_eta = prover_transcript.get_challenge<FF>("eta");
+    auto proof_data = prover_transcript.export_proof();
+
+    NativeSpongeTranscript native_transcript;
+    native_transcript.load_proof(proof_data);
+    native_transcript.receive_from_prover<Commitment>("commitment");
+    auto [native_alpha, native_beta, native_gamma] = native_transcript.get_challenges<FF>("alpha", "beta", "gamma");
+    native_transcript.receive_from_prover<std::array<FF, LENGTH>>("evaluations");
+    auto native_delta = native_transcript.get_challenge<FF>("delta");
+    auto native_eta = native_transcript.get_challenge<FF>("eta");
+
+    EXPECT_EQ(prover_alpha, native_alpha);
+    EXPECT_EQ(prover_beta, native_beta);
+    EXPECT_EQ(prover_gamma, native_gamma);
+    EXPECT_EQ(prover_delta, native_delta);
+    EXPECT_EQ(prover_eta, native_eta);
+
+    // The sponge mode is a different transcript than the hashing one
+    NativeTranscript hashing_transcript;
+    hashing_transcript.send_to_verifier("commitment", Commitment::one());
+    EXPECT_NE(hashing_transcript.get_challenge<FF>("alpha"), prover_alpha);
+
+    StdlibProof<Builder> stdlib_proof = bb::convert_native_proof_to_stdlib(&builder, proof_data);
+    UltraStdlibSpongeTranscript stdlib_transcript;
+    stdlib_transcript.load_proof(stdlib_proof);
+    stdlib_transcript.receive_from_prover<commitment_ct>("commitment");
+    auto [stdlib_alpha, stdlib_beta, stdlib_gamma] =
+        stdlib_transcript.get_challenges<field_ct>("alpha", "beta", "gamma");
+    stdlib_transcript.receive_from_prover<std::array<field_ct, LENGTH>>("evaluations");
+    auto stdlib_delta = stdlib_transcript.get_challenge<field_ct>("delta");
+    auto stdlib_eta = stdlib_transcript.get_challenge<field_ct>("eta");
+
+    EXPECT_EQ(native_alpha, stdlib_alpha.get_value());
+    EXPECT_EQ(native_beta, stdlib_beta.get_value());
+    EXPECT_EQ(native_gamma, stdlib_gamma.get_value());
+    EXPECT_EQ(native_delta, stdlib_delta.get_value());
+    EXPECT_EQ(native_eta, stdlib_eta.get_value());
+    EXPECT_TRUE(CircuitChecker::check(builder));
+}
+
+/**
+ * @brief Check that the stdlib sponge transcript accepts a constant as its first element, the sponge is started in the
+ * circuit of the proof loaded afterwards
+ */
+TEST(RecursiveHonkTranscript, SpongeModeConstantFirst)
+{
+    using field_ct = field_t<Builder>;
+    Builder builder;
+
+    const FF vk_hash = FF::random_element();
+    NativeSpongeTranscript prover_transcript;
+    prover_transcript.add_to_hash_buffer("vk_hash", vk_hash);
+    prover_transcript.send_to_verifier("evaluation", FF::random_element());
+    auto prover_alpha = prover_transcript.get_challenge<FF>("alpha");
+    auto proof_data = prover_transcript.export_proof();
+
+    UltraStdlibSpongeTranscript stdlib_transcript;
+    stdlib_transcript.add_to_hash_buffer("vk_hash", field_ct(vk_hash));
+    stdlib_transcript.load_proof(bb::convert_native_proof_to_stdlib(&builder, proof_data));
+    stdlib_transcript.receive_from_prover<field_ct>("evaluation");
+    auto stdlib_alpha = stdlib_transcript.get_challenge<field_ct>("alpha");
+
+    EXPECT_EQ(prover_alpha, stdlib_alpha.get_value());
+    EXPECT_TRUE(CircuitChecker::check(builder));
+}
+
 /**
  * @brief Ensure that when encountering an infinity commitment results stay consistent in the recursive and native case
  * for Grumpkin and the native and stdlib transcripts produce the same challenge.
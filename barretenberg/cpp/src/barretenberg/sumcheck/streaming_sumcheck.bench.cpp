@@ -0,0 +1,120 @@
+#include "barretenberg/flavor/ultra_flavor.hpp"
+#include "barretenberg/sumcheck/sumcheck.hpp"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+using Flavor = UltraFlavor;
+using FF = Flavor::FF;
+using ProverPolynomials = Flavor::ProverPolynomials;
+
+// Reset the peak resident set size (VmHWM) of the process to its current resident set size
+void reset_peak_rss()
+{
+#ifdef __GLIBC__
+    // Hand memory freed by earlier runs back to the OS, so that it does not show up in the peak
+    malloc_trim(0);
+#endif
+    std::ofstream("/proc/self/clear_refs") << "5";
+}
+
+// Peak resident set size since the last reset, in MiB (0 when /proc is unavailable)
+double peak_rss_mib()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.starts_with("VmHWM:")) {
+            return static_cast<double>(std::stoul(line.substr(6))) / 1024;
+        }
+    }
+    return 0;
+}
+
+ProverPolynomials random_prover_polynomials(size_t circuit_size)
+{
+    ProverPolynomials polynomials(circuit_size);
+    for (auto& poly : polynomials.get_unshifted()) {
+        for (size_t i = poly.start_index(); i < poly.end_index(); i++) {
+            poly.at(i) = FF::random_element();
+        }
+    }
+    polynomials.set_shifted();
+    return polynomials;
+}
+
+/**
+ * @brief Peak RSS vs wall-clock of the sumcheck prover as a function of the number of streamed rounds.
+ * @details Args: log circuit size, number of streamed rounds, and whether the prover polynomials are mapped from a
+ * spill file (1) or resident (0). The peak_rss_MiB counter includes the prover polynomials themselves when they are
+ * resident; when they are spilled it includes the pages of the spill file the prover has touched and not yet released.
+ */
+void streaming_sumcheck(State& state) noexcept
+{
+    const auto log_n = static_cast<size_t>(state.range(0));
+    const auto num_streamed_rounds = static_cast<size_t>(state.range(1));
+    const bool spilled = state.range(2) != 0;
+    const size_t circuit_size = size_t{ 1 } << log_n;
+
+    ProverPolynomials polynomials = random_prover_polynomials(circuit_size);
+    std::shared_ptr<PolynomialSpillFile<FF>> spill_file;
+    if (spilled) {
+        const auto path = std::filesystem::temp_directory_path() / "streaming_sumcheck_bench.spill";
+        spill_prover_polynomials<Flavor>(path, polynomials);
+        spill_file = PolynomialSpillFile<FF>::open(path);
+        std::filesystem::remove(path);
+        polynomials = map_prover_polynomials<Flavor>(*spill_file);
+    }
+    RelationParameters<FF> relation_parameters{ .eta = FF::random_element(),
+                                                .beta = FF::random_element(),
+                                                .gamma = FF::random_element() };
+    Flavor::RelationSeparator alpha;
+    for (auto& alpha_i : alpha) {
+        alpha_i = FF::random_element();
+    }
+    std::vector<FF> gate_challenges(log_n);
+    for (auto& gate_challenge : gate_challenges) {
+        gate_challenge = FF::random_element();
+    }
+
+    double peak_rss = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        if (spill_file) {
+            spill_file->release_rows(0, circuit_size + 1);
+        }
+        reset_peak_rss();
+        auto transcript = Flavor::Transcript::prover_init_empty();
+        SumcheckProver<Flavor> sumcheck(circuit_size, transcript);
+        sumcheck.num_streamed_rounds = num_streamed_rounds;
+        if (spill_file) {
+            sumcheck.spill_files = { spill_file };
+        }
+        state.ResumeTiming();
+
+        DoNotOptimize(sumcheck.prove(polynomials, relation_parameters, alpha, gate_challenges));
+
+        state.PauseTiming();
+        peak_rss += peak_rss_mib();
+        state.ResumeTiming();
+    }
+    state.counters["peak_rss_MiB"] = Counter(peak_rss, Counter::kAvgIterations);
+}
+
+} // namespace
+
+BENCHMARK(streaming_sumcheck)
+    ->Unit(kMillisecond)
+    ->ArgsProduct({ { 16, 20 }, { 0, 1, 2, 4 }, { 0, 1 } })
+    ->ArgNames({ "log_n", "streamed_rounds", "spilled" });
+
+BENCHMARK_MAIN();
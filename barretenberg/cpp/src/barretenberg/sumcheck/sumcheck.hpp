@@ -5,8 +5,10 @@
 // =====================
 
 #pragma once
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/honk/library/grand_product_delta.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
+#include "barretenberg/polynomials/polynomial_spill_file.hpp"
 #include "barretenberg/sumcheck/sumcheck_output.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 #include "barretenberg/ultra_honk/decider_proving_key.hpp"
@@ -14,6 +16,79 @@
 
 namespace bb {
 
+/**
+ * @brief Spill the prover polynomials to a file at `path`, so that the in-memory copies can be dropped.
+ * @details Only the unshifted polynomials are written; \ref map_prover_polynomials "map prover polynomials" derives
+ * the shifts from them again.
+ */
+template <typename Flavor>
+void spill_prover_polynomials(const std::filesystem::path& path, typename Flavor::ProverPolynomials& polynomials)
+{
+    PROFILE_THIS_NAME("spill_prover_polynomials");
+    using FF = typename Flavor::FF;
+    PolynomialSpillFile<FF>::write(path, RefVector<Polynomial<FF>>(polynomials.get_unshifted()));
+}
+
+/**
+ * @brief Prover polynomials backed by the mapping of a file written by \ref spill_prover_polynomials
+ * "spill prover polynomials".
+ */
+template <typename Flavor>
+typename Flavor::ProverPolynomials map_prover_polynomials(const PolynomialSpillFile<typename Flavor::FF>& file)
+{
+    typename Flavor::ProverPolynomials polynomials;
+    auto mapped_polynomials = file.get_polynomials();
+    BB_ASSERT_EQ(mapped_polynomials.size(), polynomials.get_unshifted().size());
+    for (auto [poly, mapped_poly] : zip_view(polynomials.get_unshifted(), mapped_polynomials)) {
+        poly = std::move(mapped_poly);
+    }
+    for (auto [shifted, to_be_shifted] : zip_view(polynomials.get_shifted(), polynomials.get_to_be_shifted())) {
+        shifted = to_be_shifted.shifted();
+    }
+    return polynomials;
+}
+
+/**
+ * @brief Spill `polynomials` to a file at `path` and replace them with their mapping, dropping the resident copies.
+ * @details The file is unlinked once mapped, the mapping keeps it alive for as long as any of the polynomials is. The
+ * caller has to reset any shifts of the replaced polynomials.
+ * @return the spill file, whose pages a streamed sumcheck round can release once consumed
+ */
+template <typename FF>
+std::shared_ptr<PolynomialSpillFile<FF>> spill_and_map_polynomials(const std::filesystem::path& path,
+                                                                   const RefVector<Polynomial<FF>>& polynomials)
+{
+    PROFILE_THIS_NAME("spill_and_map_polynomials");
+    PolynomialSpillFile<FF>::write(path, polynomials);
+    auto spill_file = PolynomialSpillFile<FF>::open(path);
+    std::filesystem::remove(path);
+    if (spill_file == nullptr) {
+        throw_or_abort(format("Unable to map the spilled polynomials at ", path.string()));
+    }
+    auto mapped_polynomials = spill_file->get_polynomials();
+    for (auto [poly, mapped_poly] : zip_view(polynomials, mapped_polynomials)) {
+        poly = std::move(mapped_poly);
+    }
+    return spill_file;
+}
+
+/**
+ * @brief Spill the precomputed prover polynomials next to `path` and replace them with their mapping
+ * @details The witness polynomials are computed after the precomputed ones, so spilling these as soon as the trace has
+ * been generated keeps them from being resident while the witness polynomials are.
+ */
+template <typename Flavor>
+std::shared_ptr<PolynomialSpillFile<typename Flavor::FF>> spill_precomputed_polynomials(
+    const std::filesystem::path& path, typename Flavor::ProverPolynomials& polynomials)
+{
+    auto precomputed_path = path;
+    precomputed_path += ".precomputed";
+    auto spill_file = spill_and_map_polynomials<typename Flavor::FF>(
+        precomputed_path, RefVector<Polynomial<typename Flavor::FF>>(polynomials.get_precomputed()));
+    polynomials.set_shifted();
+    return spill_file;
+}
+
 /*! \brief The implementation of the sumcheck Prover for statements of the form \f$\sum_{\vec \ell \in \{0,1\}^d}
 pow_{\beta}(\vec \ell) \cdot F \left(P_1(\vec \ell),\ldots, P_N(\vec \ell) \right)  = 0 \f$ for multilinear polynomials
 \f$P_1, \ldots, P_N \f$.
@@ -172,6 +247,23 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
     * TODO(#224)(Cody): might want to just do C-style multidimensional array? for guaranteed adjacency?
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
+
+    /**
+     * @brief Number of initial rounds computed by streaming over the full polynomials (non-ZK prover only).
+     * @details By default the first round reads the full polynomials and every later round reads the table of
+     * partially evaluated polynomials, which is allocated with \f$ n/2 \f$ rows after the first challenge. When this
+     * is \f$ k > 0 \f$, rounds \f$ 0, \ldots, k-1 \f$ instead recompute the rows they need window by window from
+     * the full polynomials (see \ref compute_streamed_univariate "compute streamed univariate"), and the table is only
+     * materialized after \f$ k \f$ challenges, with \f$ n/2^k \f$ rows. Each additional streamed round costs one more
+     * pass over the full polynomials. Combined with full polynomials mapped from spill files (see
+     * \ref map_prover_polynomials "map prover polynomials"), the full polynomials never need to be resident at once.
+     */
+    size_t num_streamed_rounds = 0;
+    // The spill files the full polynomials are mapped from, whose pages streamed rounds release as they go
+    std::vector<std::shared_ptr<PolynomialSpillFile<FF>>> spill_files;
+    // Number of rows of the partially evaluated table a thread reconstructs at a time in a streamed round
+    static constexpr size_t STREAMING_WINDOW_SIZE = 1 << 10;
+
     // prover instantiates sumcheck with circuit size and a prover transcript
     SumcheckProver(size_t multivariate_n, const std::shared_ptr<Transcript>& transcript)
         : multivariate_n(multivariate_n)
@@ -197,30 +289,50 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
         bb::GateSeparatorPolynomial<FF> gate_separators(gate_challenges, multivariate_d);
 
         multivariate_challenge.reserve(multivariate_d);
-        // In the first round, we compute the first univariate polynomial and populate the book-keeping table of
-        // #partially_evaluated_polynomials, which has \f$ n/2 \f$ rows and \f$ N \f$ columns. When the Flavor has ZK,
-        // compute_univariate also takes into account the zk_sumcheck_data.
-        auto round_univariate = round.compute_univariate(full_polynomials, relation_parameters, gate_separators, alpha);
-        // Initialize the partially evaluated polynomials which will be used in the following rounds.
-        // This will use the information in the structured full polynomials to save memory if possible.
-        partially_evaluated_polynomials = PartiallyEvaluatedMultivariates(full_polynomials, multivariate_n);
+        size_t first_in_place_round = 1;
+        SumcheckRoundUnivariate round_univariate;
+        if (num_streamed_rounds == 0) {
+            // In the first round, we compute the first univariate polynomial and populate the book-keeping table of
+            // #partially_evaluated_polynomials, which has \f$ n/2 \f$ rows and \f$ N \f$ columns. When the Flavor has
+            // ZK, compute_univariate also takes into account the zk_sumcheck_data.
+            round_univariate = round.compute_univariate(full_polynomials, relation_parameters, gate_separators, alpha);
+            // Initialize the partially evaluated polynomials which will be used in the following rounds.
+            // This will use the information in the structured full polynomials to save memory if possible.
+            partially_evaluated_polynomials = PartiallyEvaluatedMultivariates(full_polynomials, multivariate_n);
+
+            vinfo("starting sumcheck rounds...");
+            {
+                PROFILE_THIS_NAME("rest of sumcheck round 1");
 
-        vinfo("starting sumcheck rounds...");
-        {
-            PROFILE_THIS_NAME("rest of sumcheck round 1");
+                // Place the evaluations of the round univariate into transcript.
+                transcript->send_to_verifier("Sumcheck:univariate_0", round_univariate);
+                FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_0");
+                multivariate_challenge.emplace_back(round_challenge);
+                // Prepare sumcheck book-keeping table for the next round
+                partially_evaluate(full_polynomials, round_challenge);
+                gate_separators.partially_evaluate(round_challenge);
+                round.halve_round_size(); // TODO(#224)(Cody): Maybe partially_evaluate should do this
+                // and release memory?        // All but final round
+                // We operate on partially_evaluated_polynomials in place.
+            }
+        } else {
+            vinfo("starting sumcheck rounds, streaming the first ", num_streamed_rounds, " rounds...");
+            first_in_place_round = std::min(num_streamed_rounds, multivariate_d);
+            for (size_t round_idx = 0; round_idx < first_in_place_round; round_idx++) {
+                PROFILE_THIS_NAME("streamed sumcheck round");
 
-            // Place the evaluations of the round univariate into transcript.
-            transcript->send_to_verifier("Sumcheck:univariate_0", round_univariate);
-            FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_0");
-            multivariate_challenge.emplace_back(round_challenge);
-            // Prepare sumcheck book-keeping table for the next round
-            partially_evaluate(full_polynomials, round_challenge);
-            gate_separators.partially_evaluate(round_challenge);
-            round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
-            // release memory?        // All but final round
-            // We operate on partially_evaluated_polynomials in place.
+                round_univariate =
+                    compute_streamed_univariate(full_polynomials, relation_parameters, gate_separators, alpha);
+                transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
+                FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
+                multivariate_challenge.emplace_back(round_challenge);
+                gate_separators.partially_evaluate(round_challenge);
+                round.halve_round_size();
+            }
+            // Only now do we build the book-keeping table, with n / 2^k rows
+            materialize_partially_evaluated_polynomials(full_polynomials);
         }
-        for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
+        for (size_t round_idx = first_in_place_round; round_idx < multivariate_d; round_idx++) {
             PROFILE_THIS_NAME("sumcheck loop");
 
             // Write the round univariate to the transcript
@@ -233,7 +345,7 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
             // Prepare sumcheck book-keeping table for the next round.
             partially_evaluate(partially_evaluated_polynomials, round_challenge);
             gate_separators.partially_evaluate(round_challenge);
-            round.round_size = round.round_size >> 1;
+            round.halve_round_size();
         }
         vinfo("completed ", multivariate_d, " rounds of sumcheck");
 
@@ -273,6 +385,9 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
                                  ZKData& zk_sumcheck_data)
         requires Flavor::HasZK
     {
+        if (num_streamed_rounds > 0) {
+            throw_or_abort("Streaming sumcheck is not supported by zero knowledge flavors");
+        }
         CommitmentKey ck;
 
         if constexpr (IsGrumpkinFlavor<Flavor>) {
@@ -329,9 +444,9 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
             zk_sumcheck_data.update_zk_sumcheck_data(round_challenge, round_idx);
             row_disabling_polynomial.update_evaluations(round_challenge, round_idx);
             gate_separators.partially_evaluate(round_challenge);
-            round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
-                                                      // release memory?        // All but final round
-                                                      // We operate on partially_evaluated_polynomials in place.
+            round.halve_round_size(); // TODO(#224)(Cody): Maybe partially_evaluate should do this and
+                                      // release memory?        // All but final round
+                                      // We operate on partially_evaluated_polynomials in place.
         }
         for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
 
@@ -371,7 +486,7 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
             row_disabling_polynomial.update_evaluations(round_challenge, round_idx);
 
             gate_separators.partially_evaluate(round_challenge);
-            round.round_size = round.round_size >> 1;
+            round.halve_round_size();
         }
 
         if constexpr (IsGrumpkinFlavor<Flavor>) {
@@ -505,6 +620,146 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
         });
     };
 
+    /**
+     * @brief Compute the round univariate of a streamed round without the table of partially evaluated polynomials.
+     * @details In Round \f$ i \f$, the rows of the table are
+     * \f{align}{
+        P_j(u_0,\ldots, u_{i-1}, \vec \ell) = \sum_{b \in \{0,1\}^i} eq(u_0,\ldots, u_{i-1}; b) \cdot
+        \texttt{full_polynomials}_{2^i \ell + b, j}, \f}
+     * where \f$ b \f$ is identified with the integer \f$ \sum_k b_k 2^k \f$. Each thread reconstructs a window of
+     * #STREAMING_WINDOW_SIZE consecutive rows at a time from \f$ 2^i \f$ times as many rows of the full polynomials and
+     * accumulates the contributions of its edges. The result is identical to that of
+     * \ref bb::SumcheckProverRound::compute_univariate "compute univariate" on the materialized table.
+     */
+    SumcheckRoundUnivariate compute_streamed_univariate(ProverPolynomials& full_polynomials,
+                                                        const bb::RelationParameters<FF>& relation_parameters,
+                                                        const bb::GateSeparatorPolynomial<FF>& gate_separators,
+                                                        const RelationSeparator& alpha)
+    {
+        PROFILE_THIS_NAME("compute_streamed_univariate");
+
+        const std::vector<FF> eq_table = compute_eq_table();
+        const size_t window_size = std::min(STREAMING_WINDOW_SIZE, round.round_size);
+        const size_t num_threads = std::min(get_num_cpus(), round.round_size / window_size);
+
+        std::vector<typename Flavor::SumcheckTupleOfTuplesOfUnivariates> thread_accumulators(num_threads);
+        std::vector<PartiallyEvaluatedMultivariates> windows(num_threads);
+        for (size_t thread_idx = 0; thread_idx < num_threads; thread_idx++) {
+            RelationUtils<Flavor>::zero_univariates(thread_accumulators[thread_idx]);
+            for (auto& poly : windows[thread_idx].get_all()) {
+                poly = Polynomial<FF>(window_size);
+            }
+        }
+        for_each_streamed_window(
+            eq_table.size(), window_size, num_threads, [&](size_t window_start, size_t thread_idx) {
+                fold_rows(full_polynomials, eq_table, window_start, window_size, windows[thread_idx], window_start);
+                round.accumulate_window(thread_accumulators[thread_idx],
+                                        windows[thread_idx],
+                                        window_start,
+                                        window_size,
+                                        relation_parameters,
+                                        gate_separators);
+            });
+
+        for (auto& accumulators : thread_accumulators) {
+            RelationUtils<Flavor>::add_nested_tuples(round.univariate_accumulators, accumulators);
+        }
+        return round.template batch_over_relations<SumcheckRoundUnivariate>(
+            round.univariate_accumulators, alpha, gate_separators);
+    }
+
+    /**
+     * @brief Build the table of partially evaluated polynomials at the challenges of the streamed rounds.
+     * @details Equivalent to running \ref partially_evaluate "partially evaluate" after each streamed round, but reads
+     * the full polynomials once and only ever allocates the rows that remain after the last streamed round.
+     */
+    void materialize_partially_evaluated_polynomials(ProverPolynomials& full_polynomials)
+    {
+        PROFILE_THIS_NAME("materialize_partially_evaluated_polynomials");
+
+        const std::vector<FF> eq_table = compute_eq_table();
+        const size_t fold_size = eq_table.size();
+        for (auto [poly, full_poly] : zip_view(partially_evaluated_polynomials.get_all(), full_polynomials.get_all())) {
+            // As with repeated partial evaluation, the size is CEIL(size / 2^k)
+            const size_t desired_size = (full_poly.end_index() + fold_size - 1) / fold_size;
+            poly = Polynomial<FF>(desired_size, multivariate_n / 2);
+        }
+        const size_t window_size = std::min(STREAMING_WINDOW_SIZE, round.round_size);
+        const size_t num_threads = std::min(get_num_cpus(), round.round_size / window_size);
+        for_each_streamed_window(fold_size, window_size, num_threads, [&](size_t window_start, size_t) {
+            fold_rows(full_polynomials, eq_table, window_start, window_size, partially_evaluated_polynomials, 0);
+        });
+    }
+
+    /**
+     * @brief The table of \f$ eq(u_0,\ldots, u_{i-1}; b) = \prod_k (b_k u_k + (1 - b_k)(1 - u_k)) \f$ for all
+     * \f$ b \in \{0,1\}^i \f$, where \f$ u_0,\ldots, u_{i-1} \f$ are the challenges drawn so far.
+     */
+    std::vector<FF> compute_eq_table() const
+    {
+        std::vector<FF> eq_table(size_t{ 1 } << multivariate_challenge.size());
+        eq_table[0] = FF(1);
+        for (size_t k = 0; k < multivariate_challenge.size(); k++) {
+            const size_t half = size_t{ 1 } << k;
+            for (size_t b = 0; b < half; b++) {
+                eq_table[b + half] = eq_table[b] * multivariate_challenge[k];
+                eq_table[b] -= eq_table[b + half];
+            }
+        }
+        return eq_table;
+    }
+
+    /**
+     * @brief Write the rows \f$ [\texttt{begin}, \texttt{begin} + \texttt{num_rows}) \f$ of the table of partially
+     * evaluated polynomials described by `eq_table` to `table`, shifted down by `table_offset`.
+     * @details Rows beyond the end of a polynomial of `table` are skipped.
+     */
+    static void fold_rows(ProverPolynomials& full_polynomials,
+                          const std::vector<FF>& eq_table,
+                          const size_t begin,
+                          const size_t num_rows,
+                          PartiallyEvaluatedMultivariates& table,
+                          const size_t table_offset)
+    {
+        const size_t fold_size = eq_table.size();
+        for (auto [table_poly, full_poly] : zip_view(table.get_all(), full_polynomials.get_all())) {
+            const size_t end = std::min(begin + num_rows, table_offset + table_poly.end_index());
+            for (size_t row = begin; row < end; row++) {
+                const size_t first = row * fold_size;
+                FF value(0);
+                // Skip the rows where the full polynomial is (virtually) zero
+                if (first < full_poly.end_index() && first + fold_size > full_poly.start_index()) {
+                    for (size_t b = 0; b < fold_size; b++) {
+                        value += eq_table[b] * full_poly[first + b];
+                    }
+                }
+                table_poly.at(row - table_offset) = value;
+            }
+        }
+    }
+
+    /**
+     * @brief Call `func(window_start, thread_idx)` for the windows of `window_size` rows that cover the current round.
+     * @details Threads take consecutive windows, so that the rows of the full polynomials are consumed front to back
+     * and, for spilled polynomials, released as soon as all threads have moved past them.
+     */
+    void for_each_streamed_window(const size_t fold_size,
+                                  const size_t window_size,
+                                  const size_t num_threads,
+                                  const std::function<void(size_t, size_t)>& func)
+    {
+        const size_t num_windows = round.round_size / window_size;
+        for (size_t first_window = 0; first_window < num_windows; first_window += num_threads) {
+            const size_t num_group_windows = std::min(num_threads, num_windows - first_window);
+            parallel_for(num_group_windows,
+                         [&](size_t thread_idx) { func((first_window + thread_idx) * window_size, thread_idx); });
+            for (const auto& spill_file : spill_files) {
+                spill_file->release_rows(first_window * window_size * fold_size,
+                                         (first_window + num_group_windows) * window_size * fold_size);
+            }
+        }
+    }
+
     /**
      * @brief This method takes the book-keeping table containing partially evaluated prover polynomials and creates a
      * vector containing the evaluations of all prover polynomials at the point \f$ (u_0, \ldots, u_{d-1} )\f$.
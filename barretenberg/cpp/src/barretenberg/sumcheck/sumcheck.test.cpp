@@ -6,6 +6,7 @@
 #include "barretenberg/flavor/ultra_flavor.hpp"
 #include "barretenberg/flavor/ultra_zk_flavor.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include <filesystem>
 #include <gtest/gtest.h>
 
 using namespace bb;
@@ -285,6 +286,176 @@ template <typename Flavor> class SumcheckTests : public ::testing::Test {
         EXPECT_EQ(verified, true);
     };
 
+    /**
+     * @brief Check that streaming the first rounds over spilled polynomials produces exactly the same proof.
+     */
+    void test_streaming_prover()
+    {
+        const size_t multivariate_d(12);
+        const size_t multivariate_n(1 << multivariate_d);
+
+        // Random structured polynomials: shifted polynomials start at 1 and a few end early
+        ProverPolynomials full_polynomials(multivariate_n);
+        size_t poly_idx = 0;
+        for (auto& poly : full_polynomials.get_unshifted()) {
+            if (poly_idx++ % 5 == 0) {
+                poly = Polynomial<FF>(multivariate_n / 3 + poly_idx, multivariate_n, poly.start_index());
+            }
+            for (size_t i = poly.start_index(); i < poly.end_index(); i++) {
+                poly.at(i) = FF::random_element();
+            }
+        }
+        full_polynomials.set_shifted();
+        RelationParameters<FF> relation_parameters{ .beta = FF::random_element(), .gamma = FF::random_element() };
+
+        auto prove = [&](ProverPolynomials& polynomials,
+                         size_t num_streamed_rounds,
+                         const std::shared_ptr<PolynomialSpillFile<FF>>& spill_file) {
+            auto transcript = Flavor::Transcript::prover_init_empty();
+            auto sumcheck = SumcheckProver<Flavor, multivariate_d>(multivariate_n, transcript);
+            sumcheck.num_streamed_rounds = num_streamed_rounds;
+            if (spill_file) {
+                sumcheck.spill_files = { spill_file };
+            }
+            RelationSeparator alpha;
+            for (size_t idx = 0; idx < alpha.size(); idx++) {
+                alpha[idx] = transcript->template get_challenge<FF>("Sumcheck:alpha_" + std::to_string(idx));
+            }
+            std::vector<FF> gate_challenges(multivariate_d);
+            for (size_t idx = 0; idx < multivariate_d; idx++) {
+                gate_challenges[idx] =
+                    transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx));
+            }
+            sumcheck.prove(polynomials, relation_parameters, alpha, gate_challenges);
+            return transcript->export_proof();
+        };
+        const auto expected_proof = prove(full_polynomials, 0, nullptr);
+
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "sumcheck_streaming_test.spill";
+        spill_prover_polynomials<Flavor>(path, full_polynomials);
+        auto spill_file = PolynomialSpillFile<FF>::open(path);
+        std::filesystem::remove(path);
+        ASSERT_NE(spill_file, nullptr);
+
+        for (size_t num_streamed_rounds : std::array<size_t, 3>{ 1, 3, multivariate_d }) {
+            // In memory and mapped from the spill file, releasing the pages streamed rounds have consumed
+            EXPECT_EQ(prove(full_polynomials, num_streamed_rounds, nullptr), expected_proof);
+            auto mapped_polynomials = map_prover_polynomials<Flavor>(*spill_file);
+            EXPECT_EQ(prove(mapped_polynomials, num_streamed_rounds, spill_file), expected_proof);
+        }
+    }
+
+    /**
+     * @brief Check that skipping the edges outside of the active ranges of a trace does not change the proof.
+     */
+    void test_active_ranges_prover()
+    {
+        const size_t multivariate_d(10);
+        const size_t multivariate_n(1 << multivariate_d);
+
+        // Random polynomials that vanish outside of two blocks of rows with odd boundaries
+        const std::vector<std::pair<size_t, size_t>> blocks{ { 101, 301 }, { 600, 651 } };
+        ProverPolynomials full_polynomials(multivariate_n);
+        for (auto& poly : full_polynomials.get_unshifted()) {
+            for (const auto& [start, end] : blocks) {
+                for (size_t i = start; i < end; i++) {
+                    poly.at(i) = FF::random_element();
+                }
+            }
+        }
+        full_polynomials.set_shifted();
+        RelationParameters<FF> relation_parameters{ .beta = FF::random_element(), .gamma = FF::random_element() };
+
+        auto prove = [&](const std::vector<std::pair<size_t, size_t>>& active_ranges) {
+            auto transcript = Flavor::Transcript::prover_init_empty();
+            auto sumcheck = SumcheckProver<Flavor, multivariate_d>(multivariate_n, transcript);
+            sumcheck.round.set_active_ranges(active_ranges);
+            RelationSeparator alpha;
+            for (size_t idx = 0; idx < alpha.size(); idx++) {
+                alpha[idx] = transcript->template get_challenge<FF>("Sumcheck:alpha_" + std::to_string(idx));
+            }
+            std::vector<FF> gate_challenges(multivariate_d);
+            for (size_t idx = 0; idx < multivariate_d; idx++) {
+                gate_challenges[idx] =
+                    transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx));
+            }
+            sumcheck.prove(full_polynomials, relation_parameters, alpha, gate_challenges);
+            return transcript->export_proof();
+        };
+        const auto expected_proof = prove({});
+
+        // The row before each block is active too, as its shifts are in the block
+        EXPECT_EQ(prove({ { 600, 651 }, { 100, 301 }, { 599, 600 } }), expected_proof);
+        // Skipping rows that are not trivial changes the proof
+        EXPECT_NE(prove({ { 100, 301 } }), expected_proof);
+    }
+
+    void test_fr_lanes_round_univariate()
+    {
+        using SumcheckRound = SumcheckProverRound<Flavor>;
+        const size_t multivariate_d(9);
+        const size_t multivariate_n(1 << multivariate_d);
+
+        // Random polynomials that vanish outside of two blocks of rows with odd boundaries, so that some batches of
+        // edges are skipped by every relation
+        const std::vector<std::pair<size_t, size_t>> blocks{ { 11, 43 }, { 101, 301 } };
+        ProverPolynomials full_polynomials(multivariate_n);
+        for (auto& poly : full_polynomials.get_unshifted()) {
+            for (const auto& [start, end] : blocks) {
+                for (size_t i = start; i < end; i++) {
+                    poly.at(i) = FF::random_element();
+                }
+            }
+        }
+        full_polynomials.set_shifted();
+        const auto relation_parameters = RelationParameters<FF>::get_random();
+        RelationSeparator alpha;
+        for (auto& challenge : alpha) {
+            challenge = FF::random_element();
+        }
+        std::vector<FF> gate_challenges(multivariate_d);
+        for (auto& challenge : gate_challenges) {
+            challenge = FF::random_element();
+        }
+        GateSeparatorPolynomial<FF> gate_separators(gate_challenges, multivariate_d);
+
+        // The round univariate computed edge by edge
+        SumcheckRound round(multivariate_n);
+        typename Flavor::SumcheckTupleOfTuplesOfUnivariates accumulators;
+        RelationUtils<Flavor>::zero_univariates(accumulators);
+        round.accumulate_window(
+            accumulators, full_polynomials, 0, multivariate_n, relation_parameters, gate_separators);
+        using SumcheckRoundUnivariate = typename SumcheckRound::SumcheckRoundUnivariate;
+        const auto expected =
+            SumcheckRound::template batch_over_relations<SumcheckRoundUnivariate>(accumulators, alpha, gate_separators);
+
+        EXPECT_EQ(round.compute_univariate(full_polynomials, relation_parameters, gate_separators, alpha), expected);
+        // Ranges that are not made of whole batches of edges leave some edges to be accumulated one at a time
+        round.set_active_ranges({ { 10, 43 }, { 100, 301 } });
+        EXPECT_EQ(round.compute_univariate(full_polynomials, relation_parameters, gate_separators, alpha), expected);
+
+        // compute_univariate only takes the lane path where FrLanes is vectorized, so it is also run directly. Without
+        // AVX-512 IFMA this runs the scalar FrLanes kernel.
+        if constexpr (evaluatesRelationsOnFrLanes<Flavor>) {
+            RelationUtils<Flavor>::zero_univariates(accumulators);
+            EXPECT_EQ(round.accumulate_edge_lanes(
+                          accumulators, full_polynomials, 0, multivariate_n, relation_parameters, gate_separators),
+                      multivariate_n);
+            EXPECT_EQ(SumcheckRound::template batch_over_relations<SumcheckRoundUnivariate>(
+                          accumulators, alpha, gate_separators),
+                      expected);
+            // Only whole batches of edges are accumulated
+            constexpr size_t BATCH_SIZE = 2 * FrLanes::NUM_LANES;
+            const size_t short_end = 10 + BATCH_SIZE - 2;
+            EXPECT_EQ(round.accumulate_edge_lanes(
+                          accumulators, full_polynomials, 10, short_end, relation_parameters, gate_separators),
+                      10);
+            EXPECT_EQ(round.accumulate_edge_lanes(
+                          accumulators, full_polynomials, 10, 43, relation_parameters, gate_separators),
+                      10 + 2 * BATCH_SIZE);
+        }
+    }
+
     void test_failure_prover_verifier_flow()
     {
         // Since the last 4 rows in ZK Flavors are disabled, we extend an invalid circuit of size 4 to size 8 by padding
@@ -415,6 +586,30 @@ TYPED_TEST(SumcheckTests, ProverAndVerifierSimple)
 {
     this->test_prover_verifier_flow();
 }
+// Tests that streaming the first rounds over spilled polynomials does not change the proof
+TYPED_TEST(SumcheckTests, StreamingProver)
+{
+    if constexpr (!TypeParam::HasZK) {
+        this->test_streaming_prover();
+    } else {
+        GTEST_SKIP() << "Streaming is only supported by the non-ZK prover";
+    }
+}
+// Tests that skipping the edges outside of the active ranges of a trace does not change the proof
+TYPED_TEST(SumcheckTests, ActiveRangesProver)
+{
+    if constexpr (!TypeParam::HasZK) {
+        this->test_active_ranges_prover();
+    } else {
+        GTEST_SKIP() << "The ZK prover masks the round univariates with fresh randomness";
+    }
+}
+// Tests that evaluating the relations on batches of edges, on machines with a vectorized FrLanes kernel, does not
+// change the round univariate
+TYPED_TEST(SumcheckTests, FrLanesRoundUnivariate)
+{
+    this->test_fr_lanes_round_univariate();
+}
 // This tests is fed an invalid circuit and checks that the verifier would output false.
 TYPED_TEST(SumcheckTests, ProverAndVerifierSimpleFailure)
 {
@@ -6,6 +6,7 @@
 
 #pragma once
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/curves/bn254/fr_lanes.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/polynomials/gate_separator.hpp"
 #include "barretenberg/polynomials/row_disabling_polynomial.hpp"
@@ -22,6 +23,11 @@ namespace bb {
 template <typename Flavor>
 concept specifiesUnivariateChunks = std::convertible_to<decltype(Flavor::MAX_CHUNK_THREAD_PORTION_SIZE), size_t>;
 
+// Whether a Flavor evaluates its relations on FrLanes::NUM_LANES edges at a time where the FrLanes arithmetic is
+// vectorized. See SumcheckProverRound::accumulate_edge_lanes.
+template <typename Flavor>
+concept evaluatesRelationsOnFrLanes = std::same_as<typename Flavor::FF, bb::fr> && Flavor::USE_FR_LANES;
+
 /*! \brief Imlementation of the Sumcheck prover round.
     \class SumcheckProverRound
     \details
@@ -59,6 +65,11 @@ template <typename Flavor> class SumcheckProverRound {
      * @brief In Round \f$i = 0,\ldots, d-1\f$, equals \f$2^{d-i}\f$.
      */
     size_t round_size;
+    /**
+     * @brief Sorted, disjoint ranges of rows of the current round's table, aligned to edges, outside of which no edge
+     * contributes to the round univariate. Empty if every edge has to be visited. See \ref set_active_ranges.
+     */
+    std::vector<std::pair<size_t, size_t>> active_ranges;
     /**
      * @brief Number of batched sub-relations in \f$F\f$ specified by Flavor.
      *
@@ -92,6 +103,37 @@ template <typename Flavor> class SumcheckProverRound {
         Utils::zero_univariates(univariate_accumulators);
     }
 
+    /**
+     * @brief Restrict the computation of the round univariates to the edges that meet the given ranges of rows.
+     * @details The rows outside of the ranges must be trivial: every polynomial, shifted ones included, vanishes there
+     * except the permutation grand product, which equals its shift. The extension of an edge of two trivial rows is
+     * then trivial too, and so is its contribution to every relation. As the row \f$ \ell \f$ of the next round's table
+     * combines the rows \f$ 2\ell \f$ and \f$ 2\ell + 1 \f$ of the current one, the ranges are halved from round to
+     * round by \ref halve_round_size "halve round size". The ranges are those of the first round and need not be
+     * sorted or disjoint.
+     */
+    void set_active_ranges(std::vector<std::pair<size_t, size_t>> ranges)
+    {
+        std::ranges::sort(ranges);
+        active_ranges.clear();
+        for (auto [start, end] : ranges) {
+            add_active_range(start, end);
+        }
+    }
+
+    /**
+     * @brief Move on to the next round: halve the round size and the active ranges, if any.
+     */
+    void halve_round_size()
+    {
+        round_size >>= 1;
+        auto ranges = std::move(active_ranges);
+        active_ranges.clear();
+        for (auto [start, end] : ranges) {
+            add_active_range(start >> 1, (end + 1) >> 1);
+        }
+    }
+
     /**
      * @brief  To compute the round univariate in Round \f$i\f$, the prover first computes the values of Honk
      polynomials \f$ P_1,\ldots, P_N \f$ at the points of the form \f$ (u_0,\ldots, u_{i-1}, k, \vec \ell)\f$ for \f$
@@ -170,6 +212,12 @@ template <typename Flavor> class SumcheckProverRound {
     {
         PROFILE_THIS_NAME("compute_univariate");
 
+        if constexpr (!specifiesUnivariateChunks<Flavor>) {
+            if (!active_ranges.empty()) {
+                return compute_univariate_on_active_ranges(polynomials, relation_parameters, gate_separators, alpha);
+            }
+        }
+
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
@@ -253,18 +301,13 @@ template <typename Flavor> class SumcheckProverRound {
             for (size_t chunk_idx = 0; chunk_idx < num_of_chunks; chunk_idx++) {
                 size_t start = chunk_idx * chunk_size + thread_idx * chunk_thread_portion_size;
                 size_t end = chunk_idx * chunk_size + (thread_idx + 1) * chunk_thread_portion_size;
-                for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                    extend_edges(extended_edges, polynomials, edge_idx);
-                    // Compute the \f$ \ell \f$-th edge's univariate contribution,
-                    // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for
-                    // \f$ \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$
-                    // (\ell_{i+1},\ldots, \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is
-                    // \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot \beta_{d-1}^{\ell_{d-1}}\f$.
-                    accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                    extended_edges,
-                                                    relation_parameters,
-                                                    gate_separators[(edge_idx >> 1) * gate_separators.periodicity]);
-                }
+                accumulate_edges(thread_univariate_accumulators[thread_idx],
+                                 extended_edges,
+                                 polynomials,
+                                 start,
+                                 end,
+                                 relation_parameters,
+                                 gate_separators);
             }
         });
 
@@ -277,6 +320,86 @@ template <typename Flavor> class SumcheckProverRound {
         return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_separators);
     }
 
+    /**
+     * @brief Same as \ref compute_univariate "compute univariate", but only visiting the edges in the \ref
+     * active_ranges "active ranges", which are split evenly between the threads.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    SumcheckRoundUnivariate compute_univariate_on_active_ranges(
+        ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
+        const bb::RelationParameters<FF>& relation_parameters,
+        const bb::GateSeparatorPolynomial<FF>& gate_separators,
+        const RelationSeparator alpha)
+    {
+        size_t num_active_edges = 0;
+        for (const auto& [start, end] : active_ranges) {
+            num_active_edges += (end - start) >> 1;
+        }
+        size_t min_iterations_per_thread = 1 << 5; // the same number of rows per thread as compute_univariate
+        size_t num_threads = bb::calculate_num_threads(num_active_edges, min_iterations_per_thread);
+
+        std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            Utils::zero_univariates(thread_univariate_accumulators[thread_idx]);
+            ExtendedEdges extended_edges;
+            // This thread handles the active edges with indices in [first, last) when enumerated range by range
+            const size_t first = thread_idx * num_active_edges / num_threads;
+            const size_t last = (thread_idx + 1) * num_active_edges / num_threads;
+            size_t num_preceding_edges = 0;
+            for (const auto& [start, end] : active_ranges) {
+                const size_t num_range_edges = (end - start) >> 1;
+                const size_t begin_in_range = std::max(first, num_preceding_edges) - num_preceding_edges;
+                const size_t end_in_range =
+                    std::min(last, num_preceding_edges + num_range_edges) - num_preceding_edges;
+                if (begin_in_range < end_in_range) {
+                    accumulate_edges(thread_univariate_accumulators[thread_idx],
+                                     extended_edges,
+                                     polynomials,
+                                     start + 2 * begin_in_range,
+                                     start + 2 * end_in_range,
+                                     relation_parameters,
+                                     gate_separators);
+                }
+                num_preceding_edges += num_range_edges;
+                if (num_preceding_edges >= last) {
+                    break;
+                }
+            }
+        });
+
+        for (auto& accumulators : thread_univariate_accumulators) {
+            Utils::add_nested_tuples(univariate_accumulators, accumulators);
+        }
+        return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_separators);
+    }
+
+    /**
+     * @brief Accumulate the contributions of the edges in a window of the current round's hypercube.
+     * @details Used by the streaming sumcheck prover, which never holds the whole table of partially evaluated
+     * polynomials: `window` holds the rows \f$ [\texttt{window_start}, \texttt{window_start} + \texttt{window_size})
+     * \f$ of that table at indices \f$ 0, \ldots, \texttt{window_size} - 1 \f$. Summing the accumulators over windows
+     * covering the hypercube and batching them with \ref batch_over_relations "batch over relations" gives the same
+     * round univariate as \ref compute_univariate "compute univariate".
+     */
+    template <typename PartiallyEvaluatedWindow>
+    void accumulate_window(SumcheckTupleOfTuplesOfUnivariates& accumulators,
+                           const PartiallyEvaluatedWindow& window,
+                           const size_t window_start,
+                           const size_t window_size,
+                           const bb::RelationParameters<FF>& relation_parameters,
+                           const bb::GateSeparatorPolynomial<FF>& gate_separators)
+    {
+        ExtendedEdges extended_edges;
+        for (size_t edge_idx = 0; edge_idx < window_size; edge_idx += 2) {
+            extend_edges(extended_edges, window, edge_idx);
+            accumulate_relation_univariates(
+                accumulators,
+                extended_edges,
+                relation_parameters,
+                gate_separators[((window_start + edge_idx) >> 1) * gate_separators.periodicity]);
+        }
+    }
+
     /**
      * @brief In the de-facto mode of of operation for ZK, we add a randomising contribution via the Libra technique to
      * hide the actual round univariate and also ensure the total contribution is amended to take into account
@@ -502,6 +625,175 @@ template <typename Flavor> class SumcheckProverRound {
                 univariate_accumulators, extended_edges, relation_parameters, scaling_factor);
         }
     }
+
+    /**
+     * @brief Accumulate the contributions of the edges starting at the rows \f$ \texttt{start}, \texttt{start} + 2,
+     * \ldots \f$ up to \f$ \texttt{end} \f$ of the current round's table.
+     * @details Flavors that opt in with USE_FR_LANES evaluate their relations on \ref accumulate_edge_lanes "batches of
+     * edges" when the FrLanes arithmetic is vectorized; the edges left over are accumulated one at a time.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    void accumulate_edges(SumcheckTupleOfTuplesOfUnivariates& univariate_accumulators,
+                          ExtendedEdges& extended_edges,
+                          const ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
+                          size_t start,
+                          const size_t end,
+                          const bb::RelationParameters<FF>& relation_parameters,
+                          const bb::GateSeparatorPolynomial<FF>& gate_separators)
+    {
+        if constexpr (evaluatesRelationsOnFrLanes<Flavor>) {
+            if (FrLanes::is_vectorized()) {
+                start = accumulate_edge_lanes(
+                    univariate_accumulators, polynomials, start, end, relation_parameters, gate_separators);
+            }
+        }
+        for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
+            extend_edges(extended_edges, polynomials, edge_idx);
+            // Compute the \f$ \ell \f$-th edge's univariate contribution,
+            // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for
+            // \f$ \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$
+            // (\ell_{i+1},\ldots, \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is
+            // \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot \beta_{d-1}^{\ell_{d-1}}\f$.
+            accumulate_relation_univariates(univariate_accumulators,
+                                            extended_edges,
+                                            relation_parameters,
+                                            gate_separators[(edge_idx >> 1) * gate_separators.periodicity]);
+        }
+    }
+
+  public:
+    /**
+     * @brief Accumulate the contributions of as many batches of FrLanes::NUM_LANES consecutive edges as fit in the rows
+     * \f$ [\texttt{start}, \texttt{end}) \f$, evaluating the relations on all the edges of a batch at once.
+     * @details The lane \f$ k \f$ of the \ref extend_edge_lanes "extended edges" of a batch holds the edge at row
+     * \f$ \texttt{start} + 2k \f$. As the relations take a single scaling factor, they are evaluated with a scaling
+     * factor of one, into accumulators of the batch. The accumulators of the linearly independent subrelations are then
+     * multiplied by the \f$ pow_{\beta} \f$-contributions of the edges, lane by lane, which are the scaling factors the
+     * relations multiply them by in \ref accumulate_relation_univariates "accumulate relation univariates". The other
+     * subrelations do not depend on the scaling factor. A relation is skipped if it can be skipped on every edge of the
+     * batch. Once every batch is accumulated, the lanes are summed into the accumulators.
+     *
+     * @return The row of the first edge that was not accumulated
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    size_t accumulate_edge_lanes(SumcheckTupleOfTuplesOfUnivariates& univariate_accumulators,
+                                 const ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
+                                 const size_t start,
+                                 const size_t end,
+                                 const bb::RelationParameters<FF>& relation_parameters,
+                                 const bb::GateSeparatorPolynomial<FF>& gate_separators)
+    {
+        static_assert(Flavor::USE_SHORT_MONOMIALS);
+        using ExtendedEdgeLanes = typename Flavor::template AllEntities<bb::Univariate<FrLanes, 2>>;
+        using TupleOfTuplesOfLaneUnivariates =
+            decltype(create_sumcheck_tuple_of_tuples_of_univariates_over<Relations, FrLanes>());
+        constexpr size_t NUM_LANES = FrLanes::NUM_LANES;
+        constexpr size_t BATCH_SIZE = 2 * NUM_LANES;
+
+        const size_t num_batches = (end - start) / BATCH_SIZE;
+        if (num_batches == 0) {
+            return start;
+        }
+
+        // Too large for the stacks of some threads
+        struct Lanes {
+            ExtendedEdgeLanes extended_edges;
+            TupleOfTuplesOfLaneUnivariates batch_accumulators;
+            TupleOfTuplesOfLaneUnivariates accumulators;
+        };
+        auto lanes = std::make_unique<Lanes>();
+        const FrLanes zero = FrLanes::zero();
+        Utils::apply_to_tuple_of_tuples(lanes->accumulators, [&]<size_t, size_t>(auto& element) {
+            std::ranges::fill(element.evaluations, zero);
+        });
+
+        for (size_t batch_idx = 0; batch_idx < num_batches; batch_idx++) {
+            const size_t edge_idx = start + batch_idx * BATCH_SIZE;
+            extend_edge_lanes(lanes->extended_edges, polynomials, edge_idx);
+            std::array<FF, NUM_LANES> pow_contributions;
+            for (size_t lane = 0; lane < NUM_LANES; lane++) {
+                pow_contributions[lane] = gate_separators[((edge_idx >> 1) + lane) * gate_separators.periodicity];
+            }
+            const FrLanes scaling_factor = FrLanes::from_lanes(pow_contributions);
+
+            constexpr_for<0, NUM_RELATIONS, 1>([&]<size_t relation_idx>() {
+                using Relation = std::tuple_element_t<relation_idx, Relations>;
+                if constexpr (isSkippable<Relation, ExtendedEdgeLanes>) {
+                    if (Relation::skip(lanes->extended_edges)) {
+                        return;
+                    }
+                }
+                auto& batch_accumulators = std::get<relation_idx>(lanes->batch_accumulators);
+                auto& accumulators = std::get<relation_idx>(lanes->accumulators);
+                std::apply([&](auto&... elements) { (std::ranges::fill(elements.evaluations, zero), ...); },
+                           batch_accumulators);
+                Relation::accumulate(batch_accumulators, lanes->extended_edges, relation_parameters, FF(1));
+
+                constexpr size_t NUM_SUBRELATIONS = std::tuple_size_v<std::decay_t<decltype(batch_accumulators)>>;
+                constexpr_for<0, NUM_SUBRELATIONS, 1>([&]<size_t subrelation_idx>() {
+                    auto& batch_accumulator = std::get<subrelation_idx>(batch_accumulators);
+                    auto& accumulator = std::get<subrelation_idx>(accumulators);
+                    if constexpr (subrelation_is_linearly_independent<Relation, subrelation_idx>()) {
+                        batch_accumulator *= scaling_factor;
+                    }
+                    accumulator += batch_accumulator;
+                });
+            });
+        }
+
+        Utils::apply_to_tuple_of_tuples(
+            lanes->accumulators, [&]<size_t relation_idx, size_t subrelation_idx>(const auto& element) {
+                auto& accumulator = std::get<subrelation_idx>(std::get<relation_idx>(univariate_accumulators));
+                for (size_t i = 0; i < element.evaluations.size(); i++) {
+                    for (const FF& value : element.evaluations[i].to_lanes()) {
+                        accumulator.evaluations[i] += value;
+                    }
+                }
+            });
+        return start + num_batches * BATCH_SIZE;
+    }
+
+  private:
+    /**
+     * @brief Same as \ref extend_edges "extend edges", for the FrLanes::NUM_LANES edges starting at the rows
+     * \f$ \texttt{edge_idx}, \texttt{edge_idx} + 2, \ldots \f$
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    static void extend_edge_lanes(auto& extended_edges,
+                                  const ProverPolynomialsOrPartiallyEvaluatedMultivariates& multivariates,
+                                  const size_t edge_idx)
+    {
+        static const auto zero_univariate = bb::Univariate<FrLanes, 2>::zero();
+        std::array<FF, FrLanes::NUM_LANES> evaluations_at_0;
+        std::array<FF, FrLanes::NUM_LANES> evaluations_at_1;
+        for (auto [extended_edge, multivariate] : zip_view(extended_edges.get_all(), multivariates.get_all())) {
+            if (multivariate.end_index() <= edge_idx) {
+                extended_edge = zero_univariate;
+                continue;
+            }
+            for (size_t lane = 0; lane < FrLanes::NUM_LANES; lane++) {
+                evaluations_at_0[lane] = multivariate[edge_idx + 2 * lane];
+                evaluations_at_1[lane] = multivariate[edge_idx + 2 * lane + 1];
+            }
+            extended_edge = bb::Univariate<FrLanes, 2>(
+                { FrLanes::from_lanes(evaluations_at_0), FrLanes::from_lanes(evaluations_at_1) });
+        }
+    }
+
+    // Append the edges that meet the rows [start, end) to the active ranges; ranges must be added in increasing order
+    void add_active_range(size_t start, size_t end)
+    {
+        start &= ~size_t{ 1 };
+        end = std::min(end + (end & 1), round_size);
+        if (start >= end) {
+            return;
+        }
+        if (!active_ranges.empty() && start <= active_ranges.back().second) {
+            active_ranges.back().second = std::max(active_ranges.back().second, end);
+        } else {
+            active_ranges.emplace_back(start, end);
+        }
+    }
 };
 
 /*!\brief Implementation of the Sumcheck Verifier Round
@@ -13,19 +13,24 @@
 #include "barretenberg/flavor/ultra_keccak_zk_flavor.hpp"
 #include "barretenberg/flavor/ultra_rollup_flavor.hpp"
 #include "barretenberg/flavor/ultra_zk_flavor.hpp"
+
+#include <algorithm>
+#include <atomic>
+
 namespace bb {
 
 template <class Flavor>
 void TraceToPolynomials<Flavor>::populate(Builder& builder,
                                           typename Flavor::ProvingKey& proving_key,
-                                          bool is_structured)
+                                          bool is_structured,
+                                          bool populate_precomputed)
 {
 
     PROFILE_THIS_NAME("trace populate");
 
     // Share wire polynomials, selector polynomials between proving key and builder and copy cycles from raw circuit
     // data
-    auto trace_data = construct_trace_data(builder, proving_key, is_structured);
+    auto trace_data = construct_trace_data(builder, proving_key, is_structured, populate_precomputed);
 
     if constexpr (IsUltraOrMegaHonk<Flavor>) {
         proving_key.pub_inputs_offset = trace_data.pub_inputs_offset;
@@ -45,7 +50,7 @@ void TraceToPolynomials<Flavor>::populate(Builder& builder,
     }
 
     // Compute the permutation argument polynomials (sigma/id) and add them to proving key
-    {
+    if (populate_precomputed) {
 
         PROFILE_THIS_NAME("compute_permutation_argument_polynomials");
 
@@ -74,7 +79,7 @@ void TraceToPolynomials<Flavor>::add_memory_records_to_proving_key(TraceData& tr
 
 template <class Flavor>
 typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::construct_trace_data(
-    Builder& builder, typename Flavor::ProvingKey& proving_key, bool is_structured)
+    Builder& builder, typename Flavor::ProvingKey& proving_key, bool is_structured, bool populate_precomputed)
 {
 
     PROFILE_THIS_NAME("construct_trace_data");
@@ -95,32 +100,30 @@ typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::const
             }
         }
 
-        // Update wire polynomials and copy cycles
-        // NB: The order of row/column loops is arbitrary but needs to be row/column to match old copy_cycle code
+        // Update wire polynomials
         {
 
-            PROFILE_THIS_NAME("populating wires and copy_cycles");
+            PROFILE_THIS_NAME("populating wires");
 
             for (uint32_t block_row_idx = 0; block_row_idx < block_size; ++block_row_idx) {
                 for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
                     uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables array
-                    uint32_t real_var_idx = builder.real_variable_index[var_idx];
                     uint32_t trace_row_idx = block_row_idx + offset;
                     // Insert the real witness values from this block into the wire polys at the correct offset
                     trace_data.wires[wire_idx].at(trace_row_idx) = builder.get_variable(var_idx);
-                    // Add the address of the witness value to its corresponding copy cycle
-                    trace_data.copy_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, trace_row_idx });
                 }
             }
         }
 
         // Insert the selector values for this block into the selector polynomials at the correct offset
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/398): implicit arithmetization/flavor consistency
-        for (size_t selector_idx = 0; selector_idx < NUM_SELECTORS; selector_idx++) {
-            auto& selector = block.selectors[selector_idx];
-            for (size_t row_idx = 0; row_idx < block_size; ++row_idx) {
-                size_t trace_row_idx = row_idx + offset;
-                trace_data.selectors[selector_idx].set_if_valid_index(trace_row_idx, selector[row_idx]);
+        if (populate_precomputed) {
+            for (size_t selector_idx = 0; selector_idx < NUM_SELECTORS; selector_idx++) {
+                auto& selector = block.selectors[selector_idx];
+                for (size_t row_idx = 0; row_idx < block_size; ++row_idx) {
+                    size_t trace_row_idx = row_idx + offset;
+                    trace_data.selectors[selector_idx].set_if_valid_index(trace_row_idx, selector[row_idx]);
+                }
             }
         }
 
@@ -138,9 +141,150 @@ typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::const
         offset += block.get_fixed_size(is_structured);
     }
 
+    if (populate_precomputed) {
+        trace_data.copy_cycles = compute_copy_cycles(builder, is_structured);
+    }
+
     return trace_data;
 }
 
+template <class Flavor>
+CopyCycles TraceToPolynomials<Flavor>::compute_copy_cycles(Builder& builder, bool is_structured)
+{
+
+    PROFILE_THIS_NAME("compute_copy_cycles");
+
+    // Fewer rows or cycles than this per thread are not worth a thread
+    constexpr size_t MIN_ROWS_PER_THREAD = 1 << 10;
+
+    // The trace offset of each block; the blocks are laid out in order, so their rows are in increasing trace order
+    std::vector<uint32_t> block_offsets;
+    size_t num_rows = 0;
+    uint32_t offset = Flavor::has_zero_row ? 1 : 0; // Offset at which each block is placed in the trace
+    for (auto& block : builder.blocks.get()) {
+        block_offsets.push_back(offset);
+        num_rows += block.size();
+        offset += block.get_fixed_size(is_structured);
+    }
+
+    // Each thread takes a contiguous range of the rows of the trace, the rows of all blocks taken one after the other
+    const size_t num_threads = calculate_num_threads(num_rows, MIN_ROWS_PER_THREAD);
+    const auto for_each_cell_of_thread = [&](size_t thread_idx, const auto& func) {
+        const size_t thread_start = thread_idx * num_rows / num_threads;
+        const size_t thread_end = (thread_idx + 1) * num_rows / num_threads;
+        size_t block_start = 0; // Index of the first row of the block among the rows of all blocks
+        size_t block_idx = 0;
+        for (auto& block : builder.blocks.get()) {
+            const size_t block_end = block_start + block.size();
+            const size_t start = std::clamp(thread_start, block_start, block_end) - block_start;
+            const size_t end = std::clamp(thread_end, block_start, block_end) - block_start;
+            for (size_t block_row_idx = start; block_row_idx < end; ++block_row_idx) {
+                const auto trace_row_idx = static_cast<uint32_t>(block_row_idx) + block_offsets[block_idx];
+                for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+                    const uint32_t var_idx = block.wires[wire_idx][block_row_idx];
+                    func(builder.real_variable_index[var_idx], cycle_node{ wire_idx, trace_row_idx });
+                }
+            }
+            block_start = block_end;
+            block_idx++;
+        }
+    };
+
+    CopyCycles copy_cycles;
+    const size_t num_variables = builder.get_num_variables();
+
+    // Count the cells of each cycle into offsets[real_var_idx + 1]
+    copy_cycles.offsets.assign(num_variables + 1, 0);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        for_each_cell_of_thread(thread_idx, [&](uint32_t real_var_idx, const cycle_node&) {
+            std::atomic_ref<uint32_t>(copy_cycles.offsets[real_var_idx + 1]).fetch_add(1, std::memory_order_relaxed);
+        });
+    });
+
+    // Turn the counts into offsets with a prefix sum: each chunk of cycles sums its counts, the chunk sums are
+    // accumulated in order, and each chunk then accumulates its own counts from there
+    const size_t num_chunks = calculate_num_threads(num_variables, MIN_ROWS_PER_THREAD);
+    std::vector<uint32_t> chunk_offsets(num_chunks + 1, 0);
+    const auto for_each_cycle_of_chunk = [&](size_t chunk_idx, const auto& func) {
+        const size_t chunk_end = (chunk_idx + 1) * num_variables / num_chunks;
+        for (size_t cycle_idx = chunk_idx * num_variables / num_chunks; cycle_idx < chunk_end; ++cycle_idx) {
+            func(cycle_idx);
+        }
+    };
+    parallel_for(num_chunks, [&](size_t chunk_idx) {
+        uint32_t sum = 0;
+        for_each_cycle_of_chunk(chunk_idx, [&](size_t cycle_idx) { sum += copy_cycles.offsets[cycle_idx + 1]; });
+        chunk_offsets[chunk_idx + 1] = sum;
+    });
+    for (size_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+        chunk_offsets[chunk_idx + 1] += chunk_offsets[chunk_idx];
+    }
+    parallel_for(num_chunks, [&](size_t chunk_idx) {
+        uint32_t offset = chunk_offsets[chunk_idx];
+        for_each_cycle_of_chunk(chunk_idx, [&](size_t cycle_idx) {
+            offset += copy_cycles.offsets[cycle_idx + 1];
+            copy_cycles.offsets[cycle_idx + 1] = offset;
+        });
+    });
+    const size_t num_cells = copy_cycles.offsets[num_variables];
+
+    // Split the cycles into one range per thread holding about as many cells, the cells of range i then go to
+    // nodes[offsets[range_starts[i]]], ..., nodes[offsets[range_starts[i + 1]] - 1]
+    std::vector<size_t> range_starts(num_threads + 1, num_variables);
+    for (size_t range_idx = 0; range_idx < num_threads; ++range_idx) {
+        const auto first_cell = static_cast<uint32_t>(range_idx * num_cells / num_threads);
+        range_starts[range_idx] = static_cast<size_t>(
+            std::lower_bound(copy_cycles.offsets.begin(), copy_cycles.offsets.end() - 1, first_cell) -
+            copy_cycles.offsets.begin());
+    }
+    const auto range_of = [&](uint32_t real_var_idx) {
+        return static_cast<size_t>(std::upper_bound(range_starts.begin(), range_starts.end(), real_var_idx) -
+                                   range_starts.begin()) -
+               1;
+    };
+
+    // Partition the cells by cycle range, each thread counting the cells of its rows in each range. Within the slots
+    // of a range, the cells of a thread go after those of the threads before it, i.e. of the rows before its own.
+    std::vector<uint32_t> thread_range_slots(num_threads * num_threads, 0);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        uint32_t* counts = &thread_range_slots[thread_idx * num_threads];
+        for_each_cell_of_thread(thread_idx,
+                                [&](uint32_t real_var_idx, const cycle_node&) { counts[range_of(real_var_idx)]++; });
+    });
+    for (size_t range_idx = 0; range_idx < num_threads; ++range_idx) {
+        uint32_t slot = copy_cycles.offsets[range_starts[range_idx]];
+        for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            const uint32_t count = thread_range_slots[(thread_idx * num_threads) + range_idx];
+            thread_range_slots[(thread_idx * num_threads) + range_idx] = slot;
+            slot += count;
+        }
+    }
+    std::vector<cycle_node> partitioned_nodes(num_cells);
+    std::vector<uint32_t> partitioned_cycles(num_cells);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        uint32_t* next_slots = &thread_range_slots[thread_idx * num_threads];
+        for_each_cell_of_thread(thread_idx, [&](uint32_t real_var_idx, const cycle_node& node) {
+            const uint32_t slot = next_slots[range_of(real_var_idx)]++;
+            partitioned_nodes[slot] = node;
+            partitioned_cycles[slot] = real_var_idx;
+        });
+    });
+
+    // The cells of each range are now in trace order, so scattering them to their cycles in that order leaves every
+    // cycle ordered by row and wire. The ranges are disjoint, so each thread scatters its own.
+    copy_cycles.nodes.resize(num_cells);
+    std::vector<uint32_t> next_slots(copy_cycles.offsets.begin(), copy_cycles.offsets.end() - 1);
+    parallel_for(num_threads, [&](size_t range_idx) {
+        for (uint32_t slot = copy_cycles.offsets[range_starts[range_idx]];
+             slot < copy_cycles.offsets[range_starts[range_idx + 1]];
+             ++slot) {
+            copy_cycles.nodes[next_slots[partitioned_cycles[slot]]++] = partitioned_nodes[slot];
+        }
+    });
+
+    return copy_cycles;
+}
+
 template <class Flavor>
 void TraceToPolynomials<Flavor>::add_ecc_op_wires_to_proving_key(Builder& builder,
                                                                  typename Flavor::ProvingKey& proving_key)
@@ -28,8 +28,8 @@ template <class Flavor> class TraceToPolynomials {
     struct TraceData {
         std::array<Polynomial, NUM_WIRES> wires;
         std::array<Polynomial, NUM_SELECTORS> selectors;
-        // A vector of sets (vectors) of addresses into the wire polynomials whose values are copy constrained
-        std::vector<CyclicPermutation> copy_cycles;
+        // Sets of addresses into the wire polynomials whose values are copy constrained
+        CopyCycles copy_cycles;
         uint32_t ram_rom_offset = 0;    // offset of the RAM/ROM block in the execution trace
         uint32_t pub_inputs_offset = 0; // offset of the public inputs block in the execution trace
 
@@ -64,11 +64,6 @@ template <class Flavor> class TraceToPolynomials {
                     }
                 }
             }
-            {
-                PROFILE_THIS_NAME("copy cycle initialization");
-
-                copy_cycles.resize(builder.get_num_variables());
-            }
         }
     };
 
@@ -82,8 +77,25 @@ template <class Flavor> class TraceToPolynomials {
      *
      * @param builder
      * @param is_structured whether or not the trace is to be structured with a fixed block size
+     * @param populate_precomputed whether to populate the selector and sigma/id polys; false if the proving key
+     * already holds them (e.g. from a cached key of the same circuit), in which case only witness data is populated
+     */
+    static void populate(Builder& builder, ProvingKey&, bool is_structured = false, bool populate_precomputed = true);
+
+    /**
+     * @brief Group the cells of the execution trace by the real variable they hold into copy cycles
+     * @details The cells are bucketed in parallel, each thread taking a contiguous range of rows. A first pass counts
+     * the cells of each variable, which gives the offset of each cycle in CopyCycles::nodes. The cells are then
+     * partitioned into one range of cycles per thread, each thread writing its cells after those of the rows before
+     * its own, and each range is finally scattered to its cycles in that order. Every cycle thus comes out ordered by
+     * row and wire, the order in which the trace lays out the cells and on which the permutation mapping depends,
+     * without a sort. Besides the result, this takes a copy of the cells and a cursor per cycle, however many threads
+     * run.
+     *
+     * @param builder
+     * @param is_structured whether or not the trace is to be structured with a fixed block size
      */
-    static void populate(Builder& builder, ProvingKey&, bool is_structured = false);
+    static CopyCycles compute_copy_cycles(Builder& builder, bool is_structured = false);
 
   private:
     /**
@@ -109,11 +121,13 @@ template <class Flavor> class TraceToPolynomials {
      * @param builder
      * @param dyadic_circuit_size
      * @param is_structured whether or not the trace is to be structured with a fixed block size
+     * @param populate_precomputed whether to construct the selector polynomials and copy cycles
      * @return TraceData
      */
     static TraceData construct_trace_data(Builder& builder,
                                           typename Flavor::ProvingKey& proving_key,
-                                          bool is_structured = false);
+                                          bool is_structured = false,
+                                          bool populate_precomputed = true);
 
     /**
      * @brief Construct and add the goblin ecc op wires to the proving key
@@ -9,6 +9,8 @@
 // #define LOG_INTERACTIONS
 
 #include "barretenberg/common/debug_log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
@@ -17,6 +19,7 @@
 #include <concepts>
 
 #include <atomic>
+#include <variant>
 
 namespace bb {
 
@@ -139,6 +142,28 @@ struct is_iterable<T, std::void_t<decltype(std::begin(std::declval<T&>())), decl
 
 template <typename T> constexpr bool is_iterable_v = is_iterable<T>::value;
 
+/**
+ * @brief Transcript parameters defining a `Sponge` select the sponge mode of BaseTranscript
+ * @details In this mode, the transcript absorbs every element it is given into a running duplex sponge and squeezes
+ * the challenges out of it, instead of hashing the previous challenge together with the buffered data of the round
+ * each time a challenge is generated. The Sponge must be default constructible and provide `void absorb(const Fr&)`
+ * and `Fr squeeze()`. An in-circuit Sponge also provides `set_context(Builder*)`, by which the transcript gives it the
+ * builder of its circuit.
+ */
+template <typename TranscriptParams>
+concept HasTranscriptSponge = requires { typename TranscriptParams::Sponge; };
+
+template <typename TranscriptParams> struct TranscriptSponge {
+    using type = std::monostate;
+};
+template <HasTranscriptSponge TranscriptParams> struct TranscriptSponge<TranscriptParams> {
+    using type = typename TranscriptParams::Sponge;
+};
+
+// The capacity element the transcript sponges start from. Poseidon2 hashes use an IV below 2^128 encoding the input and
+// output lengths, so that no challenge of the sponge mode is the hash of some input.
+inline constexpr uint256_t TRANSCRIPT_SPONGE_DOMAIN_SEPARATOR = uint256_t(0, 0, 1, 0);
+
 // A static counter for the number of transcripts created
 // This is used to generate unique labels for the transcript origin tags
 
@@ -155,6 +180,8 @@ template <typename TranscriptParams> class BaseTranscript {
 
     // Detects whether the transcript is in-circuit or not
     static constexpr bool in_circuit = InCircuit<Fr>;
+    // Whether the transcript absorbs its elements into a running sponge, see HasTranscriptSponge
+    static constexpr bool use_sponge = HasTranscriptSponge<TranscriptParams>;
 
     // The unique index of the transcript
     size_t transcript_index = 0;
@@ -185,6 +212,10 @@ template <typename TranscriptParams> class BaseTranscript {
     bool is_first_challenge = true; // indicates if this is the first challenge this transcript is generating
     Fr previous_challenge{};        // default-initialized to zeros
     std::vector<Fr> current_round_data;
+    // In sponge mode, the sponge absorbing the elements in place of current_round_data, and whether any element was
+    // absorbed since the last challenge
+    typename TranscriptSponge<TranscriptParams>::type sponge;
+    bool has_absorbed_round_data = false;
 
     bool use_manifest = false; // indicates whether the manifest is turned on, currently only on for manifest tests.
 
@@ -206,7 +237,17 @@ template <typename TranscriptParams> class BaseTranscript {
         // Prevent challenge generation if this is the first challenge we're generating,
         // AND nothing was sent by the prover.
         if (is_first_challenge) {
-            ASSERT(!current_round_data.empty());
+            ASSERT(!round_data_is_empty());
+        }
+
+        if constexpr (use_sponge) {
+            // The sponge has absorbed the previous challenge and the round data already: a challenge costs at most a
+            // permutation, however much data the transcript holds
+            is_first_challenge = false;
+            has_absorbed_round_data = false;
+            Fr new_challenge = sponge.squeeze();
+            previous_challenge = new_challenge;
+            return TranscriptParams::split_challenge(new_challenge);
         }
 
         // concatenate the previous challenge (if this is not the first challenge) with the current round data.
@@ -239,6 +280,15 @@ template <typename TranscriptParams> class BaseTranscript {
         return new_challenges;
     };
 
+    bool round_data_is_empty() const
+    {
+        if constexpr (use_sponge) {
+            return !has_absorbed_round_data;
+        } else {
+            return current_round_data.empty();
+        }
+    }
+
   protected:
     Proof proof_data; // Contains the raw data sent by the prover.
 
@@ -255,7 +305,17 @@ template <typename TranscriptParams> class BaseTranscript {
             manifest.add_entry(round_number, label, element_frs.size());
         }
 
-        current_round_data.insert(current_round_data.end(), element_frs.begin(), element_frs.end());
+        if constexpr (use_sponge) {
+            for (const Fr& element_fr : element_frs) {
+                if constexpr (in_circuit) {
+                    sponge.set_context(element_fr.get_context());
+                }
+                sponge.absorb(element_fr);
+            }
+            has_absorbed_round_data |= !element_frs.empty();
+        } else {
+            current_round_data.insert(current_round_data.end(), element_frs.begin(), element_frs.end());
+        }
     }
 
     /**
@@ -313,6 +373,12 @@ template <typename TranscriptParams> class BaseTranscript {
     void load_proof(const std::vector<Fr>& proof)
     {
         std::copy(proof.begin(), proof.end(), std::back_inserter(proof_data));
+        if constexpr (use_sponge && in_circuit) {
+            // The sponge works in the circuit of the proof, even if the verifier first adds constants to the transcript
+            if (!proof.empty()) {
+                sponge.set_context(proof[0].get_context());
+            }
+        }
     }
 
     /**
@@ -508,7 +574,9 @@ template <typename TranscriptParams> class BaseTranscript {
     template <class T> T receive_from_prover(const std::string& label)
     {
         const size_t element_size = TranscriptParams::template calc_num_bn254_frs<T>();
-        ASSERT(num_frs_read + element_size <= proof_data.size());
+        if (num_frs_read + element_size > proof_data.size()) {
+            throw_or_abort(format("Proof too short to receive ", label, " from the prover"));
+        }
 
         auto element_frs = std::span{ proof_data }.subspan(num_frs_read, element_size);
         num_frs_read += element_size;
@@ -639,7 +707,7 @@ template <typename TranscriptParams> class BaseTranscript {
      */
     BaseTranscript branch_transcript()
     {
-        ASSERT(current_round_data.empty(), "Branching a transcript with non empty round data");
+        ASSERT(round_data_is_empty(), "Branching a transcript with non empty round data");
 
         BaseTranscript branched_transcript;
 
@@ -674,6 +742,24 @@ template <typename Builder> static bb::HonkProof convert_stdlib_proof_to_native(
 
 using NativeTranscript = BaseTranscript<NativeTranscriptParams>;
 
+/**
+ * @brief Poseidon2 transcript in sponge mode: its challenges differ from those of NativeTranscript, so the prover and
+ * the verifier (or StdlibSpongeTranscriptParams for a recursive verifier) must both use it.
+ */
+struct NativeSpongeTranscriptParams : public NativeTranscriptParams {
+    class Sponge {
+      public:
+        void absorb(const Fr& element) { sponge.absorb(element); }
+        Fr squeeze() { return sponge.squeeze(); }
+
+      private:
+        crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::Sponge sponge{ Fr(
+            TRANSCRIPT_SPONGE_DOMAIN_SEPARATOR) };
+    };
+};
+
+using NativeSpongeTranscript = BaseTranscript<NativeSpongeTranscriptParams>;
+
 ///////////////////////////////////////////
 // Solidity Transcript
 ///////////////////////////////////////////
@@ -66,18 +66,15 @@ void TranslatorProver::commit_to_witness_polynomial(Polynomial& polynomial, cons
  */
 void TranslatorProver::execute_wire_and_sorted_constraints_commitments_round()
 {
-
-    for (const auto& [wire, label] :
-         zip_view(key->proving_key->polynomials.get_wires(), commitment_labels.get_wires())) {
-
-        commit_to_witness_polynomial(wire, label);
-    }
-
-    // The ordered range constraints are of full circuit size.
-    for (const auto& [ordered_range_constraint, label] :
-         zip_view(key->proving_key->polynomials.get_ordered_range_constraints(),
-                  commitment_labels.get_ordered_range_constraints())) {
-        commit_to_witness_polynomial(ordered_range_constraint, label);
+    auto& polynomials = key->proving_key->polynomials;
+    // The ordered range constraints are of full circuit size. All commitments of the round are computed with a single
+    // batched MSM, which keeps every thread busy despite the large number of comparatively small wires.
+    RefVector<Polynomial> witness_polynomials = polynomials.get_wires_and_ordered_range_constraints();
+    auto labels = commitment_labels.get_wires_and_ordered_range_constraints();
+
+    std::vector<Commitment> commitments = key->proving_key->commitment_key.batch_commit(witness_polynomials);
+    for (const auto& [commitment, label] : zip_view(commitments, labels)) {
+        transcript->send_to_verifier(label, commitment);
     }
 }
 
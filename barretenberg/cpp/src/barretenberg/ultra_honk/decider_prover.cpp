@@ -33,9 +33,35 @@ DeciderProver_<Flavor>::DeciderProver_(const std::shared_ptr<DeciderPK>& proving
  */
 template <IsUltraOrMegaHonk Flavor> void DeciderProver_<Flavor>::execute_relation_check_rounds()
 {
+    PolynomialArena::Site site("sumcheck");
     using Sumcheck = SumcheckProver<Flavor>;
     size_t polynomial_size = proving_key->proving_key.circuit_size;
     auto sumcheck = Sumcheck(polynomial_size, transcript);
+    if (num_streamed_sumcheck_rounds > 0 || !sumcheck_spill_path.empty()) {
+        if constexpr (Flavor::HasZK) {
+            // The row disabling contribution and the Libra masking are only computed over a materialized table
+            throw_or_abort("Streaming sumcheck is not supported by zero knowledge flavors");
+        } else {
+            sumcheck.num_streamed_rounds = num_streamed_sumcheck_rounds;
+        }
+    }
+    if (!sumcheck_spill_path.empty()) {
+        // The mapped polynomials replace the resident ones, they are still read by the PCS rounds. The precomputed
+        // polynomials are normally spilled right after trace generation already (see UltraProver_::construct_proof).
+        auto& polynomials = proving_key->proving_key.polynomials;
+        if (spill_files.empty()) {
+            spill_files.push_back(spill_precomputed_polynomials<Flavor>(sumcheck_spill_path, polynomials));
+        }
+        spill_files.push_back(
+            spill_and_map_polynomials<FF>(sumcheck_spill_path, RefVector<Polynomial>(polynomials.get_witness())));
+        polynomials.set_shifted();
+        sumcheck.spill_files = spill_files;
+    }
+    // Skip the empty parts of a structured trace. This does not hold for a folded accumulator, whose polynomials
+    // combine several traces.
+    if (!proving_key->is_accumulator) {
+        sumcheck.round.set_active_ranges(proving_key->sumcheck_active_ranges);
+    }
     {
 
         PROFILE_THIS_NAME("sumcheck.prove");
@@ -70,6 +96,12 @@ template <IsUltraOrMegaHonk Flavor> void DeciderProver_<Flavor>::execute_pcs_rou
     using OpeningClaim = ProverOpeningClaim<Curve>;
     using PolynomialBatcher = GeminiProver_<Curve>::PolynomialBatcher;
 
+    // Free the buffers released by sumcheck, such as its table of partially evaluated polynomials, rather than keep
+    // them for the PCS rounds
+    if (PolynomialArena* arena = PolynomialArena::active()) {
+        arena->release_cached();
+    }
+    PolynomialArena::Site site("shplemini");
     auto& ck = proving_key->proving_key.commitment_key;
     if (!ck.initialized()) {
         ck = CommitmentKey(proving_key->proving_key.circuit_size);
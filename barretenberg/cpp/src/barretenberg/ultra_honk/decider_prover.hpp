@@ -11,11 +11,13 @@
 #include "barretenberg/flavor/ultra_flavor.hpp"
 #include "barretenberg/flavor/ultra_rollup_flavor.hpp"
 #include "barretenberg/honk/proof_system/types/proof.hpp"
+#include "barretenberg/polynomials/polynomial_spill_file.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include "barretenberg/sumcheck/sumcheck_output.hpp"
 #include "barretenberg/sumcheck/zk_sumcheck_data.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 #include "barretenberg/ultra_honk/decider_proving_key.hpp"
+#include <filesystem>
 
 namespace bb {
 
@@ -57,6 +59,16 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProver_ {
     ZKData zk_sumcheck_data;
 
     SumcheckOutput<Flavor> sumcheck_output;
+
+    // Opt-in streaming sumcheck, see SumcheckProver::num_streamed_rounds. Not supported by ZK flavors.
+    size_t num_streamed_sumcheck_rounds = 0;
+    // If set, the prover polynomials are spilled to files at this path and mapped back from them, so that they are
+    // not resident during sumcheck and the streamed rounds can release them as they go. The files are unlinked as soon
+    // as they are mapped.
+    std::filesystem::path sumcheck_spill_path;
+    // The spill files the prover polynomials are already mapped from, e.g. the precomputed polynomials spilled after
+    // trace generation; the witness polynomials are spilled before sumcheck, and so are these if not given.
+    std::vector<std::shared_ptr<PolynomialSpillFile<FF>>> spill_files;
 };
 
 using UltraDeciderProver = DeciderProver_<UltraFlavor>;
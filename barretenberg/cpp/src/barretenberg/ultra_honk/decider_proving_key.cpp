@@ -43,15 +43,18 @@ template <IsUltraOrMegaHonk Flavor> void DeciderProvingKey_<Flavor>::allocate_wi
     }
 }
 
-template <IsUltraOrMegaHonk Flavor> void DeciderProvingKey_<Flavor>::allocate_permutation_argument_polynomials()
+template <IsUltraOrMegaHonk Flavor>
+void DeciderProvingKey_<Flavor>::allocate_permutation_argument_polynomials(bool allocate_sigmas_and_ids)
 {
     PROFILE_THIS_NAME("allocate_permutation_argument_polynomials");
 
-    for (auto& sigma : proving_key.polynomials.get_sigmas()) {
-        sigma = Polynomial(proving_key.circuit_size);
-    }
-    for (auto& id : proving_key.polynomials.get_ids()) {
-        id = Polynomial(proving_key.circuit_size);
+    if (allocate_sigmas_and_ids) {
+        for (auto& sigma : proving_key.polynomials.get_sigmas()) {
+            sigma = Polynomial(proving_key.circuit_size);
+        }
+        for (auto& id : proving_key.polynomials.get_ids()) {
+            id = Polynomial(proving_key.circuit_size);
+        }
     }
     proving_key.polynomials.z_perm = Polynomial::shiftable(proving_key.circuit_size);
 }
@@ -97,7 +100,7 @@ template <IsUltraOrMegaHonk Flavor> void DeciderProvingKey_<Flavor>::allocate_se
 }
 
 template <IsUltraOrMegaHonk Flavor>
-void DeciderProvingKey_<Flavor>::allocate_table_lookup_polynomials(const Circuit& circuit)
+void DeciderProvingKey_<Flavor>::allocate_table_lookup_polynomials(const Circuit& circuit, bool allocate_tables)
 {
     PROFILE_THIS_NAME("allocate_table_lookup_and_lookup_read_polynomials");
 
@@ -107,7 +110,7 @@ void DeciderProvingKey_<Flavor>::allocate_table_lookup_polynomials(const Circuit
     ASSERT(dyadic_circuit_size > max_tables_size);
 
     // Allocate the polynomials containing the actual table data
-    if constexpr (IsUltraOrMegaHonk<Flavor>) {
+    if (allocate_tables) {
         for (auto& poly : proving_key.polynomials.get_tables()) {
             poly = Polynomial(max_tables_size, dyadic_circuit_size, table_offset);
         }
@@ -172,6 +175,38 @@ void DeciderProvingKey_<Flavor>::allocate_databus_polynomials(const Circuit& cir
         Polynomial(std::max(circuit.get_return_data().size(), q_busread_end), dyadic_circuit_size);
 }
 
+/**
+ * @brief Compute the rows of a structured trace that sumcheck has to visit
+ * @details Outside of these rows every prover polynomial, shifted ones included, vanishes except the permutation grand
+ * product, which is constant across each gap between blocks, so the edges there contribute nothing to any relation.
+ * Besides the blocks of the trace (with one row before each block, whose shifts lie in the block, and one after it,
+ * where the grand product may not be constant yet) the ranges cover the zero row, the lookup tables, the data on the
+ * databus and the rows masked in ZK flavors. The databus ids extend beyond the data, but only ever contribute in
+ * products with the inverses or the read counts of the databus columns, which vanish there.
+ */
+template <IsUltraOrMegaHonk Flavor>
+void DeciderProvingKey_<Flavor>::compute_sumcheck_active_ranges(const Circuit& circuit)
+{
+    auto& ranges = sumcheck_active_ranges;
+    for (const auto& [start, end] : proving_key.active_region_data.get_ranges()) {
+        ranges.emplace_back(start > 0 ? start - 1 : 0, std::min(end + 1, dyadic_circuit_size));
+    }
+    ranges.emplace_back(0, num_zero_rows);
+    const size_t table_offset = circuit.blocks.lookup.trace_offset;
+    ranges.emplace_back(table_offset > 0 ? table_offset - 1 : 0,
+                        std::min(table_offset + circuit.get_tables_size(), dyadic_circuit_size));
+    if constexpr (HasDataBus<Flavor>) {
+        const size_t databus_size = std::max({ circuit.get_calldata().size(),
+                                               circuit.get_secondary_calldata().size(),
+                                               circuit.get_return_data().size() });
+        ranges.emplace_back(0, std::min(databus_size, dyadic_circuit_size));
+    }
+    if constexpr (Flavor::HasZK) {
+        const size_t num_masked_rows = std::min(dyadic_circuit_size, size_t{ NUM_DISABLED_ROWS_IN_SUMCHECK } + 1);
+        ranges.emplace_back(dyadic_circuit_size - num_masked_rows, dyadic_circuit_size);
+    }
+}
+
 /**
  * @brief
  * @details
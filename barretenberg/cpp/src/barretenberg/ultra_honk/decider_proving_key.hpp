@@ -56,13 +56,25 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
     // The target sum, which is typically nonzero for a ProtogalaxyProver's accmumulator
     FF target_sum{ 0 };
     size_t final_active_wire_idx{ 0 }; // idx of last non-trivial wire value in the trace
+    // Rows outside of which sumcheck can skip the trace (see SumcheckProverRound::set_active_ranges); empty if the
+    // trace is not structured
+    std::vector<std::pair<size_t, size_t>> sumcheck_active_ranges;
     size_t dyadic_circuit_size{ 0 };   // final power-of-2 circuit size
 
     size_t overflow_size{ 0 }; // size of the structured execution trace overflow
 
+    /**
+     * @brief Construct the proving key of a finalized circuit.
+     * @details If `precomputed_polynomials` is given, it must hold the precomputed polynomials (selectors, sigmas/ids,
+     * tables and lagrange polynomials, in the order of get_precomputed()) of a key constructed earlier from a circuit
+     * with the same structure, e.g. read back from a proving key cache. They are then used as they are instead of being
+     * recomputed, which skips populating the selectors, building the copy cycles and the permutation argument, and
+     * constructing the lookup tables. Only the witness dependent parts of the key are computed.
+     */
     DeciderProvingKey_(Circuit& circuit,
                        TraceSettings trace_settings = {},
-                       CommitmentKey commitment_key = CommitmentKey())
+                       CommitmentKey commitment_key = CommitmentKey(),
+                       std::vector<Polynomial> precomputed_polynomials = {})
         : is_structured(trace_settings.structure.has_value())
     {
         PROFILE_THIS_NAME("DeciderProvingKey(Circuit&)");
@@ -109,15 +121,22 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
                 // Allocate full size polynomials
                 proving_key.polynomials = typename Flavor::ProverPolynomials(dyadic_circuit_size);
             } else { // Allocate only a correct amount of memory for each polynomial
+                // The precomputed polynomials are shared from the cache below, so only allocate them on a miss
+                const bool allocate_precomputed = precomputed_polynomials.empty();
+
                 allocate_wires();
 
-                allocate_permutation_argument_polynomials();
+                allocate_permutation_argument_polynomials(allocate_precomputed);
 
-                allocate_selectors(circuit);
+                if (allocate_precomputed) {
+                    allocate_selectors(circuit);
+                }
 
-                allocate_table_lookup_polynomials(circuit);
+                allocate_table_lookup_polynomials(circuit, allocate_precomputed);
 
-                allocate_lagrange_polynomials();
+                if (allocate_precomputed) {
+                    allocate_lagrange_polynomials();
+                }
 
                 if constexpr (IsMegaFlavor<Flavor>) {
                     allocate_ecc_op_polynomials(circuit);
@@ -126,6 +145,18 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
                     allocate_databus_polynomials(circuit);
                 }
             }
+            if (!precomputed_polynomials.empty()) {
+                BB_ASSERT_EQ(precomputed_polynomials.size(),
+                             Flavor::NUM_PRECOMPUTED_ENTITIES,
+                             "Unexpected number of precomputed polynomials.");
+                for (auto [poly, precomputed] :
+                     zip_view(proving_key.polynomials.get_precomputed(), precomputed_polynomials)) {
+                    BB_ASSERT_EQ(precomputed.virtual_size(),
+                                 dyadic_circuit_size,
+                                 "Precomputed polynomials belong to a circuit of a different size.");
+                    poly = precomputed.share();
+                }
+            }
             // We can finally set the shifted polynomials now that all of the to_be_shifted polynomials are
             // defined.
             proving_key.polynomials.set_shifted(); // Ensure shifted wires are set correctly
@@ -133,7 +164,7 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
 
         // Construct and add to proving key the wire, selector and copy constraint polynomials
         vinfo("populating trace...");
-        Trace::populate(circuit, proving_key, is_structured);
+        Trace::populate(circuit, proving_key, is_structured, /*populate_precomputed=*/precomputed_polynomials.empty());
 
         {
             PROFILE_THIS_NAME("constructing prover instance after trace populate");
@@ -145,11 +176,11 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
                 construct_databus_polynomials(circuit);
             }
         }
-        // Set the lagrange polynomials
-        proving_key.polynomials.lagrange_first.at(0) = 1;
-        proving_key.polynomials.lagrange_last.at(final_active_wire_idx) = 1;
+        if (precomputed_polynomials.empty()) {
+            // Set the lagrange polynomials
+            proving_key.polynomials.lagrange_first.at(0) = 1;
+            proving_key.polynomials.lagrange_last.at(final_active_wire_idx) = 1;
 
-        {
             PROFILE_THIS_NAME("constructing lookup table polynomials");
 
             construct_lookup_table_polynomials<Flavor>(
@@ -237,6 +268,9 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
                 ASSERT(false && "Dealing with unexpected flavor.");
             }
         }
+        if (is_structured) {
+            compute_sumcheck_active_ranges(circuit);
+        }
         auto end = std::chrono::steady_clock::now();
         auto diff = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
         vinfo("time to construct proving key: ", diff.count(), " ms.");
@@ -255,13 +289,13 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
 
     void allocate_wires();
 
-    void allocate_permutation_argument_polynomials();
+    void allocate_permutation_argument_polynomials(bool allocate_sigmas_and_ids = true);
 
     void allocate_lagrange_polynomials();
 
     void allocate_selectors(const Circuit&);
 
-    void allocate_table_lookup_polynomials(const Circuit&);
+    void allocate_table_lookup_polynomials(const Circuit&, bool allocate_tables = true);
 
     void allocate_ecc_op_polynomials(const Circuit&)
         requires IsMegaFlavor<Flavor>;
@@ -269,6 +303,8 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
     void allocate_databus_polynomials(const Circuit&)
         requires HasDataBus<Flavor>;
 
+    void compute_sumcheck_active_ranges(const Circuit&);
+
     /**
      * @brief Compute dyadic size based on a structured trace with fixed block size
      *
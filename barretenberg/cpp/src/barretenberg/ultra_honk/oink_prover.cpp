@@ -109,39 +109,33 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_wire_commit
     PROFILE_THIS_NAME("OinkProver::execute_wire_commitments_round");
     // Commit to the first three wire polynomials
     // We only commit to the fourth wire polynomial after adding memory recordss
-    {
-        PROFILE_THIS_NAME("COMMIT::wires");
-        auto commit_type = (proving_key->get_is_structured()) ? CommitmentKey::CommitType::Structured
-                                                              : CommitmentKey::CommitType::Default;
-
-        commit_to_witness_polynomial(proving_key->proving_key.polynomials.w_l, commitment_labels.w_l, commit_type);
-        commit_to_witness_polynomial(proving_key->proving_key.polynomials.w_r, commitment_labels.w_r, commit_type);
-        commit_to_witness_polynomial(proving_key->proving_key.polynomials.w_o, commitment_labels.w_o, commit_type);
-    }
+    // All commitments of the round are computed with a single batched MSM
+    PROFILE_THIS_NAME("COMMIT::wires");
+    auto& polynomials = proving_key->proving_key.polynomials;
+    RefVector<Polynomial<FF>> witness_polynomials{ polynomials.w_l, polynomials.w_r, polynomials.w_o };
+    std::vector<std::string> labels{ commitment_labels.w_l, commitment_labels.w_r, commitment_labels.w_o };
+    std::vector<bool> mask(witness_polynomials.size(), true);
 
     if constexpr (IsMegaFlavor<Flavor>) {
-
         // Commit to Goblin ECC op wires.
         // To avoid possible issues with the current work on the merge protocol, they are not
         // masked in MegaZKFlavor
         for (auto [polynomial, label] :
-             zip_view(proving_key->proving_key.polynomials.get_ecc_op_wires(), commitment_labels.get_ecc_op_wires())) {
-            {
-                PROFILE_THIS_NAME("COMMIT::ecc_op_wires");
-                transcript->send_to_verifier(domain_separator + label,
-                                             proving_key->proving_key.commitment_key.commit(polynomial));
-            };
+             zip_view(polynomials.get_ecc_op_wires(), commitment_labels.get_ecc_op_wires())) {
+            witness_polynomials.push_back(polynomial);
+            labels.push_back(label);
+            mask.push_back(false);
         }
 
         // Commit to DataBus related polynomials
-        for (auto [polynomial, label] : zip_view(proving_key->proving_key.polynomials.get_databus_entities(),
-                                                 commitment_labels.get_databus_entities())) {
-            {
-                PROFILE_THIS_NAME("COMMIT::databus");
-                commit_to_witness_polynomial(polynomial, label);
-            }
+        for (auto [polynomial, label] :
+             zip_view(polynomials.get_databus_entities(), commitment_labels.get_databus_entities())) {
+            witness_polynomials.push_back(polynomial);
+            labels.push_back(label);
+            mask.push_back(true);
         }
     }
+    batch_commit_to_witness_polynomials(witness_polynomials, labels, mask);
 }
 
 /**
@@ -162,21 +156,14 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_sorted_list
 
     // Commit to lookup argument polynomials and the finalized (i.e. with memory records) fourth wire polynomial
     {
-        PROFILE_THIS_NAME("COMMIT::lookup_counts_tags");
-        commit_to_witness_polynomial(proving_key->proving_key.polynomials.lookup_read_counts,
-                                     commitment_labels.lookup_read_counts,
-                                     CommitmentKey::CommitType::Sparse);
-
-        commit_to_witness_polynomial(proving_key->proving_key.polynomials.lookup_read_tags,
-                                     commitment_labels.lookup_read_tags,
-                                     CommitmentKey::CommitType::Sparse);
-    }
-    {
-        PROFILE_THIS_NAME("COMMIT::wires");
-        auto commit_type = (proving_key->get_is_structured()) ? CommitmentKey::CommitType::Structured
-                                                              : CommitmentKey::CommitType::Default;
-        commit_to_witness_polynomial(
-            proving_key->proving_key.polynomials.w_4, domain_separator + commitment_labels.w_4, commit_type);
+        PROFILE_THIS_NAME("COMMIT::lookup_counts_tags_w_4");
+        auto& polynomials = proving_key->proving_key.polynomials;
+        batch_commit_to_witness_polynomials(
+            { polynomials.lookup_read_counts, polynomials.lookup_read_tags, polynomials.w_4 },
+            { commitment_labels.lookup_read_counts,
+              commitment_labels.lookup_read_tags,
+              domain_separator + commitment_labels.w_4 },
+            { true, true, true });
     }
 }
 
@@ -197,20 +184,18 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_log_derivat
 
     {
         PROFILE_THIS_NAME("COMMIT::lookup_inverses");
-        commit_to_witness_polynomial(proving_key->proving_key.polynomials.lookup_inverses,
-                                     commitment_labels.lookup_inverses,
-                                     CommitmentKey::CommitType::Sparse);
-    }
-
-    // If Mega, commit to the databus inverse polynomials and send
-    if constexpr (IsMegaFlavor<Flavor>) {
-        for (auto [polynomial, label] : zip_view(proving_key->proving_key.polynomials.get_databus_inverses(),
-                                                 commitment_labels.get_databus_inverses())) {
-            {
-                PROFILE_THIS_NAME("COMMIT::databus_inverses");
-                commit_to_witness_polynomial(polynomial, label, CommitmentKey::CommitType::Sparse);
+        auto& polynomials = proving_key->proving_key.polynomials;
+        RefVector<Polynomial<FF>> inverses{ polynomials.lookup_inverses };
+        std::vector<std::string> labels{ commitment_labels.lookup_inverses };
+        // If Mega, commit to the databus inverse polynomials and send
+        if constexpr (IsMegaFlavor<Flavor>) {
+            for (auto [polynomial, label] :
+                 zip_view(polynomials.get_databus_inverses(), commitment_labels.get_databus_inverses())) {
+                inverses.push_back(polynomial);
+                labels.push_back(label);
             }
-        };
+        }
+        batch_commit_to_witness_polynomials(inverses, labels, std::vector<bool>(inverses.size(), true));
     }
 }
 
@@ -272,6 +257,40 @@ void OinkProver<Flavor>::commit_to_witness_polynomial(Polynomial<FF>& polynomial
     transcript->send_to_verifier(domain_separator + label, commitment);
 }
 
+/**
+ * @brief Commit to a set of witness polynomials with a single batched MSM and send the commitments to the verifier
+ * @details Equivalent to calling commit_to_witness_polynomial on each polynomial in order (the transcript sees the
+ * same sequence of labels and commitments), but lets the MSM work of the round be scheduled across all threads at
+ * once. Only meaningful for commitment types that resolve to a plain commit().
+ *
+ * @param polynomials
+ * @param labels label of each polynomial (prefixed with the domain separator)
+ * @param mask whether each polynomial is masked when proving in zero-knowledge
+ */
+template <IsUltraOrMegaHonk Flavor>
+void OinkProver<Flavor>::batch_commit_to_witness_polynomials(RefVector<Polynomial<FF>> polynomials,
+                                                             const std::vector<std::string>& labels,
+                                                             const std::vector<bool>& mask)
+{
+    BB_ASSERT_EQ(polynomials.size(), labels.size());
+    BB_ASSERT_EQ(polynomials.size(), mask.size());
+    // Mask the polynomials when proving in zero-knowledge
+    if constexpr (Flavor::HasZK) {
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            if (mask[i]) {
+                polynomials[i].mask();
+            }
+        }
+    }
+
+    std::vector<typename Flavor::Commitment> commitments =
+        proving_key->proving_key.commitment_key.batch_commit(polynomials);
+    // Send the commitments to the verifier
+    for (size_t i = 0; i < commitments.size(); ++i) {
+        transcript->send_to_verifier(domain_separator + labels[i], commitments[i]);
+    }
+}
+
 template class OinkProver<UltraFlavor>;
 template class OinkProver<UltraZKFlavor>;
 template class OinkProver<UltraKeccakFlavor>;
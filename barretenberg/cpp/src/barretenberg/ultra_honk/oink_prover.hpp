@@ -77,6 +77,9 @@ template <IsUltraOrMegaHonk Flavor> class OinkProver {
     void commit_to_witness_polynomial(Polynomial<FF>& polynomial,
                                       const std::string& label,
                                       const CommitmentKey::CommitType type = CommitmentKey::CommitType::Default);
+    void batch_commit_to_witness_polynomials(RefVector<Polynomial<FF>> polynomials,
+                                             const std::vector<std::string>& labels,
+                                             const std::vector<bool>& mask);
 };
 
 using MegaOinkProver = OinkProver<MegaFlavor>;
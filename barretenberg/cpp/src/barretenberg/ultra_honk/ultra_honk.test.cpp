@@ -17,7 +17,9 @@
 #include "barretenberg/ultra_honk/ultra_prover.hpp"
 #include "barretenberg/ultra_honk/ultra_verifier.hpp"
 
+#include <filesystem>
 #include <gtest/gtest.h>
+#include <unistd.h>
 
 using namespace bb;
 
@@ -169,6 +171,219 @@ TYPED_TEST(UltraHonkTests, PublicInputs)
     TestFixture::prove_and_verify(builder, /*expected_result=*/true);
 }
 
+/**
+ * @brief Check that a proving key built on the precomputed polynomials of an earlier key of the same circuit (as when
+ * they come from the proving key cache of the bb cli) matches the vk of the earlier key and proves a different witness
+ */
+TYPED_TEST(UltraHonkTests, ReusePrecomputedPolynomials)
+{
+    using Flavor = TypeParam;
+    using DeciderProvingKey = typename TestFixture::DeciderProvingKey;
+    using VerificationKey = typename TestFixture::VerificationKey;
+
+    // Every circuit constructed here has the same structure, but random witness values
+    auto construct_circuit = [this]() {
+        UltraCircuitBuilder builder;
+        MockCircuits::add_arithmetic_gates_with_public_inputs(builder, /*num_gates=*/10);
+        MockCircuits::add_lookup_gates(builder);
+        TestFixture::set_default_pairing_points_and_ipa_claim_and_proof(builder);
+        return builder;
+    };
+
+    auto first_circuit = construct_circuit();
+    auto first_proving_key = std::make_shared<DeciderProvingKey>(first_circuit);
+    auto verification_key = std::make_shared<VerificationKey>(first_proving_key->proving_key);
+    std::vector<typename Flavor::Polynomial> precomputed_polynomials;
+    for (auto& poly : first_proving_key->proving_key.polynomials.get_precomputed()) {
+        precomputed_polynomials.push_back(poly.share());
+    }
+
+    auto second_circuit = construct_circuit();
+    auto proving_key = std::make_shared<DeciderProvingKey>(
+        second_circuit, TraceSettings{}, typename Flavor::CommitmentKey(), std::move(precomputed_polynomials));
+    EXPECT_EQ(VerificationKey(proving_key->proving_key), *verification_key);
+
+    typename TestFixture::Prover prover(proving_key, verification_key);
+    auto proof = prover.construct_proof();
+    if constexpr (HasIPAAccumulator<Flavor>) {
+        VerifierCommitmentKey<curve::Grumpkin> ipa_verification_key(1 << CONST_ECCVM_LOG_N);
+        typename TestFixture::Verifier verifier(verification_key, ipa_verification_key);
+        EXPECT_TRUE(verifier.verify_proof(proof, proving_key->proving_key.ipa_proof));
+    } else {
+        typename TestFixture::Verifier verifier(verification_key);
+        EXPECT_TRUE(verifier.verify_proof(proof));
+    }
+}
+
+/**
+ * @brief Check that a proof with streamed sumcheck rounds over prover polynomials spilled to disk verifies, and that
+ * zero knowledge flavors, which do not support it, reject it
+ */
+TYPED_TEST(UltraHonkTests, StreamingSumcheck)
+{
+    using Flavor = TypeParam;
+
+    UltraCircuitBuilder builder;
+    MockCircuits::add_arithmetic_gates_with_public_inputs(builder, /*num_gates=*/1 << 10);
+    MockCircuits::add_lookup_gates(builder);
+    TestFixture::set_default_pairing_points_and_ipa_claim_and_proof(builder);
+    auto proving_key = std::make_shared<typename TestFixture::DeciderProvingKey>(builder);
+    auto verification_key = std::make_shared<typename TestFixture::VerificationKey>(proving_key->proving_key);
+
+    const std::filesystem::path spill_path =
+        std::filesystem::temp_directory_path() / ("ultra_honk_streaming_sumcheck_" + std::to_string(getpid()));
+    typename TestFixture::Prover prover(proving_key, verification_key);
+    prover.num_streamed_sumcheck_rounds = 3;
+    prover.sumcheck_spill_path = spill_path;
+    if constexpr (Flavor::HasZK) {
+        EXPECT_THROW(prover.construct_proof(), std::runtime_error);
+    } else {
+        auto proof = prover.construct_proof();
+        if constexpr (HasIPAAccumulator<Flavor>) {
+            VerifierCommitmentKey<curve::Grumpkin> ipa_verification_key(1 << CONST_ECCVM_LOG_N);
+            typename TestFixture::Verifier verifier(verification_key, ipa_verification_key);
+            EXPECT_TRUE(verifier.verify_proof(proof, proving_key->proving_key.ipa_proof));
+        } else {
+            typename TestFixture::Verifier verifier(verification_key);
+            EXPECT_TRUE(verifier.verify_proof(proof));
+        }
+    }
+    EXPECT_FALSE(std::filesystem::exists(spill_path));
+    EXPECT_FALSE(std::filesystem::exists(spill_path.string() + ".precomputed"));
+}
+
+/**
+ * @brief Check that the fixed-base MSM mode, as enabled by the --fixed_base_msm_memory_budget flag of the bb cli, is
+ * used by the commitment key of the prover and yields a valid proof
+ */
+TYPED_TEST(UltraHonkTests, FixedBaseMsm)
+{
+    using Flavor = TypeParam;
+    using CommitmentKey = typename Flavor::CommitmentKey;
+
+    UltraCircuitBuilder builder;
+    MockCircuits::add_arithmetic_gates_with_public_inputs(builder, /*num_gates=*/1 << 10);
+    MockCircuits::add_lookup_gates(builder);
+    TestFixture::set_default_pairing_points_and_ipa_claim_and_proof(builder);
+
+    CommitmentKey::set_fixed_base_memory_budget(size_t(16) << 20);
+    auto proving_key = std::make_shared<typename TestFixture::DeciderProvingKey>(builder);
+    auto verification_key = std::make_shared<typename TestFixture::VerificationKey>(proving_key->proving_key);
+    typename TestFixture::Prover prover(proving_key, verification_key);
+    auto proof = prover.construct_proof();
+    const auto& commitment_key = proving_key->proving_key.commitment_key;
+    EXPECT_NE(commitment_key.fixed_base_table, nullptr);
+    CommitmentKey::set_fixed_base_memory_budget(0);
+
+    if constexpr (HasIPAAccumulator<Flavor>) {
+        VerifierCommitmentKey<curve::Grumpkin> ipa_verification_key(1 << CONST_ECCVM_LOG_N);
+        typename TestFixture::Verifier verifier(verification_key, ipa_verification_key);
+        EXPECT_TRUE(verifier.verify_proof(proof, proving_key->proving_key.ipa_proof));
+    } else {
+        typename TestFixture::Verifier verifier(verification_key);
+        EXPECT_TRUE(verifier.verify_proof(proof));
+    }
+}
+
+/**
+ * @brief Check that the copy cycles bucketed in parallel match those built by walking the trace cell by cell
+ */
+TYPED_TEST(UltraHonkTests, CopyCycles)
+{
+    using Flavor = TypeParam;
+    using Trace = TraceToPolynomials<Flavor>;
+
+    UltraCircuitBuilder builder;
+    // Enough gates for the arithmetic block to be bucketed by several threads, chained so that the cycles span rows
+    uint32_t a_idx = builder.add_variable(fr::random_element());
+    for (size_t i = 0; i < (1 << 12); ++i) {
+        const uint32_t b_idx = builder.add_variable(builder.get_variable(a_idx) + builder.get_variable(a_idx));
+        builder.create_add_gate({ a_idx, a_idx, b_idx, 1, 1, -1, 0 });
+        a_idx = b_idx;
+    }
+    MockCircuits::add_lookup_gates(builder);
+    TestFixture::set_default_pairing_points_and_ipa_claim_and_proof(builder);
+    builder.finalize_circuit(/*ensure_nonzero=*/true);
+
+    // Walk the trace in row-major order, as the cells are laid out
+    std::vector<std::vector<cycle_node>> expected(builder.get_num_variables());
+    uint32_t offset = Flavor::has_zero_row ? 1 : 0;
+    for (auto& block : builder.blocks.get()) {
+        for (uint32_t row_idx = 0; row_idx < block.size(); ++row_idx) {
+            for (uint32_t wire_idx = 0; wire_idx < Trace::NUM_WIRES; ++wire_idx) {
+                const uint32_t real_var_idx = builder.real_variable_index[block.wires[wire_idx][row_idx]];
+                expected[real_var_idx].push_back(cycle_node{ wire_idx, row_idx + offset });
+            }
+        }
+        offset += static_cast<uint32_t>(block.size());
+    }
+
+    const CopyCycles copy_cycles = Trace::compute_copy_cycles(builder);
+    ASSERT_EQ(copy_cycles.size(), expected.size());
+    for (size_t cycle_idx = 0; cycle_idx < expected.size(); ++cycle_idx) {
+        const auto cycle = copy_cycles[cycle_idx];
+        ASSERT_EQ(cycle.size(), expected[cycle_idx].size());
+        for (size_t node_idx = 0; node_idx < cycle.size(); ++node_idx) {
+            EXPECT_EQ(cycle[node_idx].wire_idx, expected[cycle_idx][node_idx].wire_idx);
+            EXPECT_EQ(cycle[node_idx].gate_idx, expected[cycle_idx][node_idx].gate_idx);
+        }
+    }
+}
+
+/**
+ * @brief Check that batch verification accepts a batch of valid proofs and singles out invalid or truncated ones
+ */
+TYPED_TEST(UltraHonkTests, BatchVerify)
+{
+    using Flavor = TypeParam;
+    using DeciderProvingKey = typename TestFixture::DeciderProvingKey;
+    using VerificationKey = typename TestFixture::VerificationKey;
+
+    constexpr size_t NUM_PROOFS = 3;
+    std::vector<std::shared_ptr<VerificationKey>> verification_keys;
+    std::vector<HonkProof> proofs;
+    std::vector<HonkProof> ipa_proofs;
+    for (size_t i = 0; i < NUM_PROOFS; i++) {
+        UltraCircuitBuilder builder;
+        // Circuits of different sizes, with their own verification keys
+        MockCircuits::add_arithmetic_gates_with_public_inputs(builder, /*num_gates=*/10 << i);
+        TestFixture::set_default_pairing_points_and_ipa_claim_and_proof(builder);
+        auto proving_key = std::make_shared<DeciderProvingKey>(builder);
+        verification_keys.emplace_back(std::make_shared<VerificationKey>(proving_key->proving_key));
+        typename TestFixture::Prover prover(proving_key, verification_keys.back());
+        proofs.emplace_back(prover.construct_proof());
+        if constexpr (HasIPAAccumulator<Flavor>) {
+            ipa_proofs.emplace_back(proving_key->proving_key.ipa_proof);
+        }
+    }
+
+    VerifierCommitmentKey<curve::Grumpkin> ipa_verification_key;
+    if constexpr (HasIPAAccumulator<Flavor>) {
+        ipa_verification_key = VerifierCommitmentKey<curve::Grumpkin>(1 << CONST_ECCVM_LOG_N);
+    }
+    auto verified =
+        TestFixture::Verifier::batch_verify_proofs(verification_keys, proofs, ipa_proofs, ipa_verification_key);
+    EXPECT_EQ(verified, std::vector<bool>(NUM_PROOFS, true));
+
+    // Change a public input of the second proof
+    proofs[1][0] += 1;
+    verified = TestFixture::Verifier::batch_verify_proofs(verification_keys, proofs, ipa_proofs, ipa_verification_key);
+    EXPECT_EQ(verified, std::vector<bool>({ true, false, true }));
+    proofs[1][0] -= 1;
+
+#ifndef BB_NO_EXCEPTIONS
+    // A truncated proof fails on its own, as does a truncated IPA proof
+    proofs[2].resize(proofs[2].size() / 2);
+    std::vector<bool> expected{ true, true, false };
+    if constexpr (HasIPAAccumulator<Flavor>) {
+        ipa_proofs[0].resize(ipa_proofs[0].size() / 2);
+        expected[0] = false;
+    }
+    verified = TestFixture::Verifier::batch_verify_proofs(verification_keys, proofs, ipa_proofs, ipa_verification_key);
+    EXPECT_EQ(verified, expected);
+#endif
+}
+
 TYPED_TEST(UltraHonkTests, XorConstraint)
 {
     auto circuit_builder = UltraCircuitBuilder();
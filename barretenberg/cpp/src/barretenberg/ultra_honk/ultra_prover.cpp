@@ -87,14 +87,40 @@ template <IsUltraOrMegaHonk Flavor> void UltraProver_<Flavor>::generate_gate_cha
 
 template <IsUltraOrMegaHonk Flavor> HonkProof UltraProver_<Flavor>::construct_proof()
 {
-    OinkProver<Flavor> oink_prover(proving_key, honk_vk, transcript);
-    oink_prover.prove();
-    vinfo("created oink proof");
+    // Recycle the buffers of the polynomials built and dropped from one round to the next. The rounds mostly allocate
+    // polynomials of the circuit size or below, keeping a few of them is enough to serve the next round.
+    constexpr size_t MAX_CACHED_POLYNOMIALS = 4;
+    PolynomialArena arena(
+        { .max_cached_bytes = MAX_CACHED_POLYNOMIALS * proving_key->proving_key.circuit_size * sizeof(FF) });
+    PolynomialArena::Scope arena_scope(arena);
+    std::vector<std::shared_ptr<PolynomialSpillFile<FF>>> spill_files;
+    if constexpr (!Flavor::HasZK) {
+        if (!sumcheck_spill_path.empty()) {
+            // Spill the precomputed polynomials before oink computes the witness polynomials, rather than keep both
+            // resident until sumcheck. ZK flavors are rejected by the decider prover.
+            spill_files.push_back(
+                spill_precomputed_polynomials<Flavor>(sumcheck_spill_path, proving_key->proving_key.polynomials));
+        }
+    }
+    {
+        PolynomialArena::Site site("oink");
+        OinkProver<Flavor> oink_prover(proving_key, honk_vk, transcript);
+        oink_prover.prove();
+        vinfo("created oink proof");
+    }
+    // The buffers of oink are not of the sizes sumcheck allocates
+    arena.release_cached();
 
     generate_gate_challenges();
 
     DeciderProver_<Flavor> decider_prover(proving_key, transcript);
+    decider_prover.num_streamed_sumcheck_rounds = num_streamed_sumcheck_rounds;
+    decider_prover.sumcheck_spill_path = sumcheck_spill_path;
+    decider_prover.spill_files = std::move(spill_files);
     decider_prover.construct_proof();
+    if (verbose_logging) {
+        arena.print_usage();
+    }
     return export_proof();
 }
 
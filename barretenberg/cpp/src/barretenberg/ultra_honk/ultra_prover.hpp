@@ -13,6 +13,7 @@
 #include "barretenberg/sumcheck/sumcheck_output.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 #include "barretenberg/ultra_honk/decider_proving_key.hpp"
+#include <filesystem>
 
 namespace bb {
 
@@ -44,6 +45,12 @@ template <IsUltraOrMegaHonk Flavor_> class UltraProver_ {
 
     CommitmentKey commitment_key;
 
+    // Opt-in streaming sumcheck, forwarded to the decider prover. Not supported by ZK flavors.
+    size_t num_streamed_sumcheck_rounds = 0;
+    // If set, the precomputed polynomials are spilled to disk and mapped back before oink, and the witness polynomials
+    // before sumcheck, so that the two sets are never resident together. The trace itself is still built in memory.
+    std::filesystem::path sumcheck_spill_path;
+
     UltraProver_(const std::shared_ptr<DeciderPK>&, const std::shared_ptr<HonkVK>&, const CommitmentKey&);
 
     explicit UltraProver_(const std::shared_ptr<DeciderPK>&,
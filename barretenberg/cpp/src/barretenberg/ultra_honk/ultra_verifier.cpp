@@ -7,9 +7,12 @@
 #include "./ultra_verifier.hpp"
 #include "barretenberg/commitment_schemes/ipa/ipa.hpp"
 #include "barretenberg/commitment_schemes/pairing_points.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 #include "barretenberg/ultra_honk/oink_verifier.hpp"
+#include <exception>
 
 namespace bb {
 
@@ -18,8 +21,37 @@ namespace bb {
  *
  */
 template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkProof& proof, const HonkProof& ipa_proof)
+{
+    ReductionOutput output = reduce_to_pairing_check(proof);
+    if (!output.verified) {
+        return false;
+    }
+
+    // Verify the nested IPA claim with the ipa_proof
+    if constexpr (HasIPAAccumulator<Flavor>) {
+        ipa_transcript->load_proof(ipa_proof);
+        bool ipa_result = IPA<curve::Grumpkin>::reduce_verify(ipa_verification_key, output.ipa_claim, ipa_transcript);
+        if (!ipa_result) {
+            return false;
+        }
+    }
+
+    bool pairing_check_verified = output.pairing_points.check();
+    vinfo("pairing_check_verified: ", pairing_check_verified);
+    return pairing_check_verified;
+}
+
+/**
+ * @brief Run the verifier on a proof up to, but excluding, the two checks that are worth batching across proofs: the
+ * final pairing check and the verification of the IPA claim nested in the public inputs.
+ *
+ */
+template <typename Flavor>
+typename UltraVerifier_<Flavor>::ReductionOutput UltraVerifier_<Flavor>::reduce_to_pairing_check(
+    const HonkProof& proof)
 {
     using FF = typename Flavor::FF;
+    ReductionOutput output;
 
     transcript->load_proof(proof);
     OinkVerifier<Flavor> oink_verifier{ verification_key, transcript };
@@ -38,11 +70,11 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkP
         return fq(limb);
     };
 
-    // Parse out the nested IPA claim using key->ipa_claim_public_input_key and runs the native IPA verifier.
+    // Parse out the nested IPA claim using key->ipa_claim_public_input_key
     if constexpr (HasIPAAccumulator<Flavor>) {
 
         constexpr size_t NUM_LIMBS = 4;
-        OpeningClaim<curve::Grumpkin> ipa_claim;
+        OpeningClaim<curve::Grumpkin>& ipa_claim = output.ipa_claim;
 
         // Extract the public inputs containing the IPA claim
         std::array<FF, IPA_CLAIM_SIZE> ipa_claim_limbs;
@@ -62,24 +94,17 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkP
         ipa_claim.opening_pair.challenge = recover_fq_from_public_inputs(challenge_bigfield_limbs);
         ipa_claim.opening_pair.evaluation = recover_fq_from_public_inputs(evaluation_bigfield_limbs);
         ipa_claim.commitment = { ipa_claim_limbs[8], ipa_claim_limbs[9] };
-
-        // verify the ipa_proof with this claim
-        ipa_transcript->load_proof(ipa_proof);
-        bool ipa_result = IPA<curve::Grumpkin>::reduce_verify(ipa_verification_key, ipa_claim, ipa_transcript);
-        if (!ipa_result) {
-            return false;
-        }
     }
 
     DeciderVerifier decider_verifier{ verification_key, transcript };
     auto decider_output = decider_verifier.verify();
     if (!decider_output.sumcheck_verified) {
         info("Sumcheck failed!");
-        return false;
+        return output;
     }
     if (!decider_output.libra_evals_verified) {
         info("Libra evals failed!");
-        return false;
+        return output;
     }
 
     // Extract nested pairing points from the proof
@@ -95,7 +120,104 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkP
         decider_output.pairing_points.aggregate(nested_pairing_points);
     }
 
-    return decider_output.check();
+    output.verified = true;
+    output.pairing_points = decider_output.pairing_points;
+    return output;
+}
+
+/**
+ * @brief Verify many proofs, with one pairing check for all of them.
+ * @details The transcript work of each proof (Oink, sumcheck and the reduction of the PCS to a pairing check, see
+ * reduce_to_pairing_check) runs in parallel, one proof per task. Every proof that gets through it contributes its
+ * pairing points to a random linear combination, which is checked with a single pairing; so are the IPA claims nested
+ * in the proofs of flavors with an IPA accumulator, with IPA::batch_reduce_verify. Should the combined pairing check
+ * fail, the pairing points of each proof are checked on their own to find the proofs at fault. A proof that can't be
+ * read, such as a truncated one, is reported as not verified.
+ *
+ * @param verification_keys the key of each proof (several proofs may share one)
+ * @param ipa_proofs for flavors with an IPA accumulator, the IPA proof of each proof
+ * @return whether each proof verifies
+ */
+template <typename Flavor>
+std::vector<bool> UltraVerifier_<Flavor>::batch_verify_proofs(
+    std::span<const std::shared_ptr<VerificationKey>> verification_keys,
+    std::span<const HonkProof> proofs,
+    std::span<const HonkProof> ipa_proofs,
+    const VerifierCommitmentKey<curve::Grumpkin>& ipa_verification_key)
+{
+    using Curve = curve::BN254;
+    const size_t num_proofs = proofs.size();
+    BB_ASSERT_EQ(verification_keys.size(), num_proofs, "Each proof needs a verification key.");
+    if constexpr (HasIPAAccumulator<Flavor>) {
+        BB_ASSERT_EQ(ipa_proofs.size(), num_proofs, "Each proof needs an IPA proof.");
+    }
+
+    std::vector<ReductionOutput> outputs(num_proofs);
+    parallel_for(num_proofs, [&](size_t i) {
+        UltraVerifier_ verifier(verification_keys[i]);
+#ifndef BB_NO_EXCEPTIONS
+        // A malformed proof, e.g. one too short for its key, fails on its own rather than failing the whole batch
+        try {
+            outputs[i] = verifier.reduce_to_pairing_check(proofs[i]);
+        } catch (const std::exception& e) {
+            info("Failed to verify proof ", i, " of the batch: ", e.what());
+            outputs[i] = ReductionOutput{};
+        }
+#else
+        outputs[i] = verifier.reduce_to_pairing_check(proofs[i]);
+#endif
+    });
+
+    // A std::vector<bool> can't be written to from several threads
+    std::vector<uint8_t> verified(num_proofs);
+    for (size_t i = 0; i < num_proofs; i++) {
+        verified[i] = static_cast<uint8_t>(outputs[i].verified);
+    }
+
+    if constexpr (HasIPAAccumulator<Flavor>) {
+        std::vector<size_t> indices;
+        std::vector<OpeningClaim<curve::Grumpkin>> ipa_claims;
+        std::vector<std::shared_ptr<Transcript>> ipa_transcripts;
+        for (size_t i = 0; i < num_proofs; i++) {
+            if (verified[i] != 0) {
+                indices.emplace_back(i);
+                ipa_claims.emplace_back(outputs[i].ipa_claim);
+                ipa_transcripts.emplace_back(std::make_shared<Transcript>());
+                ipa_transcripts.back()->load_proof(ipa_proofs[i]);
+            }
+        }
+        std::vector<bool> ipa_verified =
+            IPA<curve::Grumpkin>::batch_reduce_verify<Transcript>(ipa_verification_key, ipa_claims, ipa_transcripts);
+        for (size_t j = 0; j < indices.size(); j++) {
+            verified[indices[j]] = static_cast<uint8_t>(ipa_verified[j]);
+        }
+    }
+
+    // Check sum_i r_i * (P0_i, P1_i), which pairs to one if every proof's points do
+    std::vector<Curve::AffineElement> P0s;
+    std::vector<Curve::AffineElement> P1s;
+    std::vector<Curve::ScalarField> scalars;
+    for (size_t i = 0; i < num_proofs; i++) {
+        if (verified[i] != 0) {
+            P0s.emplace_back(outputs[i].pairing_points.P0);
+            P1s.emplace_back(outputs[i].pairing_points.P1);
+            scalars.emplace_back(Curve::ScalarField::random_element());
+        }
+    }
+    if (scalars.empty()) {
+        return { verified.begin(), verified.end() };
+    }
+    PairingPoints batched_pairing_points{ scalar_multiplication::pippenger<Curve>({ 0, scalars }, P0s),
+                                          scalar_multiplication::pippenger<Curve>({ 0, scalars }, P1s) };
+    if (!batched_pairing_points.check()) {
+        info("Batched pairing check failed, checking the proofs one by one");
+        parallel_for(num_proofs, [&](size_t i) {
+            if (verified[i] != 0) {
+                verified[i] = static_cast<uint8_t>(outputs[i].pairing_points.check());
+            }
+        });
+    }
+    return { verified.begin(), verified.end() };
 }
 
 template class UltraVerifier_<UltraFlavor>;
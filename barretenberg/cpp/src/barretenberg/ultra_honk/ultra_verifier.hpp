@@ -5,6 +5,8 @@
 // =====================
 
 #pragma once
+#include "barretenberg/commitment_schemes/claim.hpp"
+#include "barretenberg/commitment_schemes/pairing_points.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/flavor/mega_flavor.hpp"
 #include "barretenberg/flavor/ultra_flavor.hpp"
@@ -15,6 +17,9 @@
 #include "barretenberg/ultra_honk/decider_verification_key.hpp"
 #include "barretenberg/ultra_honk/decider_verifier.hpp"
 
+#include <span>
+#include <vector>
+
 namespace bb {
 template <typename Flavor> class UltraVerifier_ {
     using FF = typename Flavor::FF;
@@ -34,8 +39,28 @@ template <typename Flavor> class UltraVerifier_ {
         , transcript(transcript)
     {}
 
+    /**
+     * @brief The outcome of every check of a proof except the pairing check and the verification of its IPA claim
+     */
+    struct ReductionOutput {
+        // Whether sumcheck and the libra evaluations verified
+        bool verified = false;
+        // The points of the final pairing check, including the ones nested in the public inputs
+        PairingPoints pairing_points;
+        // The IPA claim nested in the public inputs, only set for flavors with an IPA accumulator
+        OpeningClaim<curve::Grumpkin> ipa_claim;
+    };
+
     bool verify_proof(const HonkProof& proof, const HonkProof& ipa_proof = {});
 
+    ReductionOutput reduce_to_pairing_check(const HonkProof& proof);
+
+    static std::vector<bool> batch_verify_proofs(std::span<const std::shared_ptr<VerificationKey>> verification_keys,
+                                                 std::span<const HonkProof> proofs,
+                                                 std::span<const HonkProof> ipa_proofs = {},
+                                                 const VerifierCommitmentKey<curve::Grumpkin>& ipa_verification_key =
+                                                     VerifierCommitmentKey<curve::Grumpkin>());
+
     std::shared_ptr<Transcript> ipa_transcript = std::make_shared<Transcript>();
     std::shared_ptr<DeciderVK> verification_key;
     VerifierCommitmentKey<curve::Grumpkin> ipa_verification_key;
@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/honk/proof_system/logderivative_library.hpp"
+#include "barretenberg/relations/relation_parameters.hpp"
+#include "barretenberg/vm2/common/constants.hpp"
+#include "barretenberg/vm2/common/field.hpp"
+#include "barretenberg/vm2/constraining/flavor.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/generated/relations/lookups_address_derivation.hpp"
+
+using namespace benchmark;
+using namespace bb::avm2;
+
+namespace {
+
+using Relation = lookup_address_derivation_salted_initialization_hash_poseidon2_0_relation<FF>;
+using Settings = Relation::Settings;
+using Polynomial = AvmFlavor::Polynomial;
+
+/**
+ * @brief AVM prover polynomials in which only the columns of the benchmarked relation are set, to their first
+ * `active_rows` rows, as the trace generation does for a relation that is active on those rows only.
+ */
+AvmFlavor::ProverPolynomials get_polynomials(size_t active_rows)
+{
+    AvmFlavor::ProverPolynomials polys;
+    auto set_column = [&](ColumnAndShifts column, bool is_selector) {
+        auto& poly = polys.get(column);
+        poly = is_selector ? Polynomial(active_rows, CIRCUIT_SUBGROUP_SIZE)
+                           : Polynomial::random(active_rows, CIRCUIT_SUBGROUP_SIZE, /*start_index=*/0);
+        if (is_selector) {
+            for (size_t i = 0; i < active_rows; ++i) {
+                poly.at(i) = 1;
+            }
+        }
+    };
+    set_column(static_cast<ColumnAndShifts>(Settings::SRC_SELECTOR), true);
+    set_column(static_cast<ColumnAndShifts>(Settings::DST_SELECTOR), true);
+    set_column(static_cast<ColumnAndShifts>(Settings::COUNTS), false);
+    for (auto column : Settings::SRC_COLUMNS) {
+        set_column(column, false);
+    }
+    for (auto column : Settings::DST_COLUMNS) {
+        set_column(column, false);
+    }
+    polys.get(static_cast<ColumnAndShifts>(Settings::INVERSES)) = Polynomial(active_rows, CIRCUIT_SUBGROUP_SIZE);
+    return polys;
+}
+
+bb::RelationParameters<FF> get_params()
+{
+    return { .beta = FF::random_element(), .gamma = FF::random_element() };
+}
+
+// The computation as it was before it was parallelised: every row of the trace on one thread, one batch inversion
+template <typename Polynomials>
+void compute_logderivative_inverse_reference(Polynomials& polynomials,
+                                             const bb::RelationParameters<FF>& relation_parameters,
+                                             const size_t circuit_size)
+{
+    using Accumulator = typename Relation::ValueAccumulator0;
+    auto& inverse_polynomial = Relation::get_inverse_polynomial(polynomials);
+    for (size_t i = 0; i < circuit_size; ++i) {
+        auto row = polynomials.get_row(i);
+        if (!Relation::operation_exists_at_row(row)) {
+            continue;
+        }
+        FF denominator = 1;
+        bb::constexpr_for<0, Relation::READ_TERMS, 1>([&]<size_t read_index> {
+            denominator *= Relation::template compute_read_term<Accumulator, read_index>(row, relation_parameters);
+        });
+        bb::constexpr_for<0, Relation::WRITE_TERMS, 1>([&]<size_t write_index> {
+            denominator *= Relation::template compute_write_term<Accumulator, write_index>(row, relation_parameters);
+        });
+        inverse_polynomial.at(i) = denominator;
+    }
+    FF::batch_invert(inverse_polynomial.coeffs());
+}
+
+// Args: log2 of the number of rows the relation is active on, and whether to run the reference implementation (1)
+void BM_logderivative_inverse(State& state)
+{
+    const size_t active_rows = size_t{ 1 } << static_cast<size_t>(state.range(0));
+    const bool reference = state.range(1) != 0;
+    auto polys = get_polynomials(active_rows);
+    const auto params = get_params();
+
+    for (auto _ : state) {
+        if (reference) {
+            compute_logderivative_inverse_reference(polys, params, CIRCUIT_SUBGROUP_SIZE);
+        } else {
+            bb::compute_logderivative_inverse<FF, Relation>(polys, params, CIRCUIT_SUBGROUP_SIZE);
+        }
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_logderivative_inverse)
+    ->Unit(kMillisecond)
+    ->ArgsProduct({ { 12, 16, 20 }, { 0, 1 } })
+    ->ArgNames({ "log_active_rows", "reference" });
+
+BENCHMARK_MAIN();
@@ -49,6 +49,15 @@ class AvmFlavor {
     // and Shplemini
     static constexpr bool USE_PADDING = true;
 
+    // Whether the transcript absorbs into a running Poseidon2 sponge rather than hashing each round, see
+    // HasTranscriptSponge. Opt-in with AVM_SPONGE_TRANSCRIPT, as it changes the challenges of the proofs: the prover,
+    // the native and the recursive verifiers must all be built with the same setting.
+#ifdef AVM_SPONGE_TRANSCRIPT
+    static constexpr bool USE_SPONGE_TRANSCRIPT = true;
+#else
+    static constexpr bool USE_SPONGE_TRANSCRIPT = false;
+#endif
+
     static constexpr size_t NUM_PRECOMPUTED_ENTITIES = AvmFlavorVariables::NUM_PRECOMPUTED_ENTITIES;
     static constexpr size_t NUM_WITNESS_ENTITIES = AvmFlavorVariables::NUM_WITNESS_ENTITIES;
     static constexpr size_t NUM_SHIFTED_ENTITIES = AvmFlavorVariables::NUM_SHIFTED_ENTITIES;
@@ -337,7 +346,7 @@ class AvmFlavor {
     // Native version of the verifier commitments
     using VerifierCommitments = VerifierCommitments_<Commitment, VerificationKey>;
 
-    class Transcript : public NativeTranscript {
+    class Transcript : public std::conditional_t<USE_SPONGE_TRANSCRIPT, NativeSpongeTranscript, NativeTranscript> {
       public:
         uint32_t circuit_size;
 
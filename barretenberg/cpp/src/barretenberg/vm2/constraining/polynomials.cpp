@@ -2,6 +2,7 @@
 
 #include <cstdint>
 
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/vm2/common/constants.hpp"
 #include "barretenberg/vm2/generated/columns.hpp"
@@ -13,25 +14,34 @@ AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace
 {
     AvmProver::ProverPolynomials polys;
 
+    // The trace columns are moved into the polynomials: segments are handed over directly where possible, and each
+    // column is freed as soon as its polynomial is formed.
     // Polynomials that will be shifted need special care.
     AVM_TRACK_TIME("proving/init_polys_to_be_shifted", ({
                        auto to_be_shifted = polys.get_to_be_shifted();
 
-                       // NOTE: we can't parallelize because Polynomial construction uses parallelism.
-                       for (size_t i = 0; i < to_be_shifted.size(); i++) {
+                       bb::parallel_for(to_be_shifted.size(), [&](size_t i) {
                            auto& poly = to_be_shifted[i];
                            // WARNING! Column-Polynomials order matters!
                            Column col = static_cast<Column>(TO_BE_SHIFTED_COLUMNS_ARRAY.at(i));
                            uint32_t num_rows = trace.get_column_rows(col);
-                           // Since we are shifting, we need to allocate one less row.
+                           auto column_memory = trace.extract_column(col);
+                           if (column_memory == nullptr) {
+                               poly = AvmProver::Polynomial(/*memory size*/ 0,
+                                                            /*largest possible index*/ CIRCUIT_SUBGROUP_SIZE,
+                                                            /*make shiftable with offset*/ 1);
+                               return;
+                           }
+                           // Since we are shifting, the polynomial starts at the second row.
                            // The first row is always zero.
-                           uint32_t allocated_size = num_rows > 0 ? num_rows - 1 : 0;
-
+                           ASSERT(column_memory[0].is_zero());
                            poly = AvmProver::Polynomial(
-                               /*memory size*/ allocated_size,
+                               // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+                               std::shared_ptr<AvmProver::FF[]>(column_memory, column_memory.get() + 1),
+                               /*memory size*/ num_rows - 1,
                                /*largest possible index*/ CIRCUIT_SUBGROUP_SIZE,
                                /*make shiftable with offset*/ 1);
-                       }
+                       });
                    }));
 
     // Catch-all with fully formed polynomials
@@ -55,26 +65,12 @@ AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace
                            // WARNING! Column-Polynomials order matters!
                            Column col = static_cast<Column>(i);
                            const auto num_rows = trace.get_column_rows(col);
-                           poly = AvmProver::Polynomial::create_non_parallel_zero_init(num_rows, CIRCUIT_SUBGROUP_SIZE);
-                       });
-                   }));
-
-    AVM_TRACK_TIME("proving/set_polys_unshifted", ({
-                       auto unshifted = polys.get_unshifted();
-                       // TODO: We are now visiting per-column. Profile if per-row is better.
-                       // This would need changes to the trace container.
-                       bb::parallel_for(unshifted.size(), [&](size_t i) {
-                           // WARNING! Column-Polynomials order matters!
-                           auto& poly = unshifted[i];
-                           Column col = static_cast<Column>(i);
-
-                           trace.visit_column(col, [&](size_t row, const AvmProver::FF& value) {
-                               // We use `at` because we are sure the row exists and the value is non-zero.
-                               poly.at(row) = value;
-                           });
-                           // We free columns as we go.
-                           // TODO: If we merge the init with the setting, this would be even more memory efficient.
-                           trace.clear_column(col);
+                           auto column_memory = trace.extract_column(col);
+                           if (column_memory == nullptr) {
+                               poly = AvmProver::Polynomial::create_non_parallel_zero_init(0, CIRCUIT_SUBGROUP_SIZE);
+                               return;
+                           }
+                           poly = AvmProver::Polynomial(std::move(column_memory), num_rows, CIRCUIT_SUBGROUP_SIZE);
                        });
                    }));
 
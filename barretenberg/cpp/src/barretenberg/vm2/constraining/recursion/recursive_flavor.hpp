@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <type_traits>
 
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/stdlib/transcript/transcript.hpp"
@@ -104,7 +105,11 @@ template <typename BuilderType> class AvmRecursiveFlavor_ {
 
     using WitnessCommitments = NativeFlavor::WitnessEntities<Commitment>;
     using VerifierCommitments = NativeFlavor::VerifierCommitments_<Commitment, VerificationKey>;
-    using Transcript = BaseTranscript<stdlib::recursion::honk::StdlibTranscriptParams<CircuitBuilder>>;
+    using TranscriptParams =
+        std::conditional_t<NativeFlavor::USE_SPONGE_TRANSCRIPT,
+                           stdlib::recursion::honk::StdlibSpongeTranscriptParams<CircuitBuilder>,
+                           stdlib::recursion::honk::StdlibTranscriptParams<CircuitBuilder>>;
+    using Transcript = BaseTranscript<TranscriptParams>;
 };
 
 } // namespace bb::avm2
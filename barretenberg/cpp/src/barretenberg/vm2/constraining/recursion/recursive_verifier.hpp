@@ -19,7 +19,7 @@ template <typename Flavor> class AvmRecursiveVerifier_ {
     using NativeVerificationKey = typename Flavor::NativeVerificationKey;
     using Builder = typename Flavor::CircuitBuilder;
     using PCS = typename Flavor::PCS;
-    using Transcript = BaseTranscript<stdlib::recursion::honk::StdlibTranscriptParams<Builder>>;
+    using Transcript = typename Flavor::Transcript;
     using VerifierCommitments = typename Flavor::VerifierCommitments;
     using PairingPoints = stdlib::recursion::PairingPoints<Builder>;
 
@@ -1,6 +1,11 @@
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
 
+#include <cstring>
+
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/log.hpp"
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/generated/columns.hpp"
 
@@ -13,16 +18,50 @@ constexpr auto clk_column = Column::precomputed_clk;
 
 } // namespace
 
+TraceContainer::DenseColumn::~DenseColumn()
+{
+    free_segments();
+}
+
+FF* TraceContainer::DenseColumn::get_or_allocate_segment(size_t segment_index)
+{
+    FF* segment = segments[segment_index].load(std::memory_order_acquire);
+    if (segment != nullptr) {
+        return segment;
+    }
+    auto* fresh_segment = static_cast<FF*>(aligned_alloc(64, sizeof(FF) * SEGMENT_ROWS));
+    memset(static_cast<void*>(fresh_segment), 0, sizeof(FF) * SEGMENT_ROWS);
+    // If another thread installed the segment first, we use theirs.
+    if (segments[segment_index].compare_exchange_strong(segment, fresh_segment, std::memory_order_acq_rel)) {
+        return fresh_segment;
+    }
+    aligned_free(fresh_segment);
+    return segment;
+}
+
+void TraceContainer::DenseColumn::free_segments()
+{
+    for (auto& segment : segments) {
+        FF* data = segment.exchange(nullptr, std::memory_order_acq_rel);
+        if (data != nullptr) {
+            aligned_free(data);
+        }
+    }
+}
+
 TraceContainer::TraceContainer()
-    : trace(std::make_unique<std::array<SparseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>>())
+    : trace(std::make_unique<std::array<DenseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>>())
 {}
 
 const FF& TraceContainer::get(Column col, uint32_t row) const
 {
-    auto& column_data = (*trace)[static_cast<size_t>(col)];
-    std::shared_lock lock(column_data.mutex);
-    const auto it = column_data.rows.find(row);
-    return it == column_data.rows.end() ? zero : it->second;
+    // Rows past the end can be requested through shifts.
+    if (row >= MAX_ROWS) {
+        return zero;
+    }
+    const auto& column_data = (*trace)[static_cast<size_t>(col)];
+    const FF* segment = column_data.segments[row / SEGMENT_ROWS].load(std::memory_order_acquire);
+    return segment == nullptr ? zero : segment[row % SEGMENT_ROWS];
 }
 
 const FF& TraceContainer::get_column_or_shift(ColumnAndShifts col, uint32_t row) const
@@ -35,17 +74,25 @@ const FF& TraceContainer::get_column_or_shift(ColumnAndShifts col, uint32_t row)
 
 void TraceContainer::set(Column col, uint32_t row, const FF& value)
 {
+    BB_ASSERT_LT(row, MAX_ROWS);
     auto& column_data = (*trace)[static_cast<size_t>(col)];
-    std::unique_lock lock(column_data.mutex);
     if (!value.is_zero()) {
-        column_data.rows.insert_or_assign(row, value);
-        column_data.max_row_number = std::max(column_data.max_row_number, static_cast<int64_t>(row));
+        FF* segment = column_data.get_or_allocate_segment(row / SEGMENT_ROWS);
+        segment[row % SEGMENT_ROWS] = value;
+        uint32_t num_rows = column_data.num_rows.load(std::memory_order_relaxed);
+        while (num_rows < row + 1 &&
+               !column_data.num_rows.compare_exchange_weak(num_rows, row + 1, std::memory_order_relaxed)) {
+        }
     } else {
-        auto num_erased = column_data.rows.erase(row);
-        if (column_data.max_row_number == row && num_erased > 0) {
-            // This shouldn't happen often. We delay recalculation of the max row number
-            // until someone actually needs it.
-            column_data.row_number_dirty = true;
+        // Zero is the default value, so there is nothing to allocate.
+        FF* segment = column_data.segments[row / SEGMENT_ROWS].load(std::memory_order_acquire);
+        if (segment != nullptr && !segment[row % SEGMENT_ROWS].is_zero()) {
+            segment[row % SEGMENT_ROWS] = zero;
+            if (column_data.num_rows.load(std::memory_order_relaxed) == row + 1) {
+                // This shouldn't happen often. We delay recalculation of the max row number
+                // until someone actually needs it.
+                column_data.row_number_dirty.store(true, std::memory_order_relaxed);
+            }
         }
     }
 }
@@ -60,23 +107,32 @@ void TraceContainer::set(uint32_t row, std::span<const std::pair<Column, FF>> va
 void TraceContainer::reserve_column(Column col, size_t size)
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
-    std::unique_lock lock(column_data.mutex);
-    column_data.rows.reserve(size);
+    const size_t num_segments = std::min((size + SEGMENT_ROWS - 1) / SEGMENT_ROWS, NUM_SEGMENTS);
+    for (size_t i = 0; i < num_segments; ++i) {
+        column_data.get_or_allocate_segment(i);
+    }
 }
 
 uint32_t TraceContainer::get_column_rows(Column col) const
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
-    std::unique_lock lock(column_data.mutex);
-    if (column_data.row_number_dirty) {
-        // Trigger recalculation of max row number.
-        auto keys = std::views::keys(column_data.rows);
-        const auto it = std::max_element(keys.begin(), keys.end());
-        // We use -1 to indicate that the column is empty.
-        column_data.max_row_number = it == keys.end() ? -1 : static_cast<int64_t>(*it);
-        column_data.row_number_dirty = false;
+    if (column_data.row_number_dirty.exchange(false, std::memory_order_relaxed)) {
+        // Trigger recalculation of max row number by scanning back from the last row.
+        uint32_t num_rows = column_data.num_rows.load(std::memory_order_relaxed);
+        while (num_rows > 0) {
+            const uint32_t row = num_rows - 1;
+            const FF* segment = column_data.segments[row / SEGMENT_ROWS].load(std::memory_order_acquire);
+            if (segment == nullptr) {
+                num_rows = row - (row % SEGMENT_ROWS);
+            } else if (segment[row % SEGMENT_ROWS].is_zero()) {
+                num_rows = row;
+            } else {
+                break;
+            }
+        }
+        column_data.num_rows.store(num_rows, std::memory_order_relaxed);
     }
-    return static_cast<uint32_t>(column_data.max_row_number + 1);
+    return column_data.num_rows.load(std::memory_order_relaxed);
 }
 
 uint32_t TraceContainer::get_num_rows_without_clk() const
@@ -97,20 +153,62 @@ uint32_t TraceContainer::get_num_rows() const
 
 void TraceContainer::visit_column(Column col, const std::function<void(uint32_t, const FF&)>& visitor) const
 {
-    auto& column_data = (*trace)[static_cast<size_t>(col)];
-    std::shared_lock lock(column_data.mutex);
-    for (const auto& [row, value] : column_data.rows) {
-        visitor(row, value);
+    const auto& column_data = (*trace)[static_cast<size_t>(col)];
+    const uint32_t num_rows = get_column_rows(col);
+    for (uint32_t segment_start = 0; segment_start < num_rows; segment_start += SEGMENT_ROWS) {
+        const FF* segment = column_data.segments[segment_start / SEGMENT_ROWS].load(std::memory_order_acquire);
+        if (segment == nullptr) {
+            continue;
+        }
+        const uint32_t segment_rows = std::min(SEGMENT_ROWS, num_rows - segment_start);
+        for (uint32_t i = 0; i < segment_rows; ++i) {
+            if (!segment[i].is_zero()) {
+                visitor(segment_start + i, segment[i]);
+            }
+        }
     }
 }
 
 void TraceContainer::clear_column(Column col)
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
-    std::unique_lock lock(column_data.mutex);
-    column_data.rows.clear();
-    column_data.max_row_number = 0;
-    column_data.row_number_dirty = false;
+    column_data.free_segments();
+    column_data.num_rows.store(0, std::memory_order_relaxed);
+    column_data.row_number_dirty.store(false, std::memory_order_relaxed);
+}
+
+std::shared_ptr<FF[]> TraceContainer::extract_column(Column col)
+{
+    auto& column_data = (*trace)[static_cast<size_t>(col)];
+    const uint32_t num_rows = get_column_rows(col);
+    if (num_rows == 0) {
+        clear_column(col);
+        return nullptr;
+    }
+
+    // A non-empty column that fits in the first segment hands it over as is.
+    if (num_rows <= SEGMENT_ROWS) {
+        FF* segment = column_data.segments[0].exchange(nullptr, std::memory_order_acq_rel);
+        clear_column(col);
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        return std::shared_ptr<FF[]>(segment, [](FF* data) { aligned_free(data); });
+    }
+
+    // Otherwise we concatenate the segments, freeing each one as soon as it has been copied.
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    auto buffer = std::static_pointer_cast<FF[]>(get_mem_slab(sizeof(FF) * num_rows));
+    for (uint32_t segment_start = 0; segment_start < num_rows; segment_start += SEGMENT_ROWS) {
+        const uint32_t segment_rows = std::min(SEGMENT_ROWS, num_rows - segment_start);
+        FF* segment = column_data.segments[segment_start / SEGMENT_ROWS].exchange(nullptr, std::memory_order_acq_rel);
+        if (segment == nullptr) {
+            memset(static_cast<void*>(&buffer[segment_start]), 0, sizeof(FF) * segment_rows);
+        } else {
+            memcpy(static_cast<void*>(&buffer[segment_start]), segment, sizeof(FF) * segment_rows);
+            aligned_free(segment);
+        }
+    }
+    clear_column(col);
+    return buffer;
 }
 
 } // namespace bb::avm2::tracegen
@@ -2,23 +2,22 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <memory>
-#include <shared_mutex>
 #include <span>
-#include <unordered_map>
 
+#include "barretenberg/vm2/common/constants.hpp"
 #include "barretenberg/vm2/common/field.hpp"
-#include "barretenberg/vm2/common/map.hpp"
 #include "barretenberg/vm2/constraining/flavor_settings.hpp"
 #include "barretenberg/vm2/generated/columns.hpp"
 #include "barretenberg/vm2/tracegen/lib/trace_conversion.hpp"
 
 namespace bb::avm2::tracegen {
 
-// This container is thread-safe.
-// Contention can only happen when concurrently accessing the same column.
+// This container is thread-safe as long as no two threads write the same cell concurrently (tracegen never does).
+// Writes are lock-free: each column is stored densely in fixed-size row segments that are allocated on first write.
 class TraceContainer {
   public:
     TraceContainer();
@@ -59,24 +58,35 @@ class TraceContainer {
 
     // Free column memory.
     void clear_column(Column col);
+    // Moves the values of rows [0, get_column_rows(col)) into a contiguous buffer and frees the column. Columns that
+    // fit in a single segment hand over that segment without a copy. Returns nullptr for an empty column.
+    std::shared_ptr<FF[]> extract_column(Column col);
+
+    static constexpr uint32_t SEGMENT_ROWS = 1 << 12;
+    static constexpr uint32_t MAX_ROWS = CIRCUIT_SUBGROUP_SIZE;
 
   private:
-    // We use a mutex per column to allow for concurrent writes.
-    // Observe that therefore concurrent write access to different columns is cheap.
-    struct SparseColumn {
-        std::shared_mutex mutex;
-        int64_t max_row_number = -1; // We use -1 to indicate that the column is empty.
-        bool row_number_dirty;       // Needs recalculation.
-        // Future memory optimization notes: we can do the same trick as in Operand.
-        // That is, store a variant with a unique_ptr. However, we should benchmark this.
-        // (see serialization.hpp).
-        unordered_flat_map<uint32_t, FF> rows;
+    static constexpr size_t NUM_SEGMENTS = MAX_ROWS / SEGMENT_ROWS;
+
+    // Segments are installed with a compare-and-swap, so concurrent writers never block each other.
+    // Observe that segments in which no non-zero value was ever written cost no memory.
+    struct DenseColumn {
+        // Number of rows, i.e. the maximum non-zero row index + 1.
+        std::atomic<uint32_t> num_rows = 0;
+        std::atomic<bool> row_number_dirty = false; // Needs recalculation.
+        std::array<std::atomic<FF*>, NUM_SEGMENTS> segments{};
+
+        DenseColumn() = default;
+        DenseColumn(const DenseColumn&) = delete;
+        DenseColumn& operator=(const DenseColumn&) = delete;
+        ~DenseColumn();
+
+        FF* get_or_allocate_segment(size_t segment_index);
+        void free_segments();
     };
-    // We store the trace as a sparse matrix.
     // We use a unique_ptr to allocate the array in the heap vs the stack.
-    // Even if the _content_ of each unordered_map is always heap-allocated, if we have 3k columns
-    // we could unnecessarily put strain on the stack with sizeof(unordered_map) * 3k bytes.
-    std::unique_ptr<std::array<SparseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>> trace;
+    // With 3k columns, each holding its table of segment pointers, the array is too large for the stack.
+    std::unique_ptr<std::array<DenseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>> trace;
 };
 
 } // namespace bb::avm2::tracegen
@@ -0,0 +1,104 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+namespace bb::avm2::tracegen {
+namespace {
+
+using C = Column;
+using testing::ElementsAre;
+using testing::Pair;
+
+constexpr uint32_t SEGMENT_ROWS = TraceContainer::SEGMENT_ROWS;
+
+TEST(TraceContainerTest, SetAndGetAcrossSegments)
+{
+    TraceContainer trace;
+
+    trace.set(C::execution_sel, 1, 1);
+    trace.set(C::execution_sel, SEGMENT_ROWS + 5, 7);
+
+    EXPECT_EQ(trace.get(C::execution_sel, 0), 0);
+    EXPECT_EQ(trace.get(C::execution_sel, 1), 1);
+    EXPECT_EQ(trace.get(C::execution_sel, SEGMENT_ROWS + 5), 7);
+    // Untouched segments and rows past the end read as zero.
+    EXPECT_EQ(trace.get(C::execution_sel, 3 * SEGMENT_ROWS), 0);
+    EXPECT_EQ(trace.get(C::execution_sel, TraceContainer::MAX_ROWS), 0);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), SEGMENT_ROWS + 6);
+    EXPECT_EQ(trace.get_column_rows(C::alu_ia), 0);
+}
+
+TEST(TraceContainerTest, ZeroingLastRowShrinksColumn)
+{
+    TraceContainer trace;
+
+    trace.set(C::execution_sel, 3, 1);
+    trace.set(C::execution_sel, 2 * SEGMENT_ROWS, 1);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 2 * SEGMENT_ROWS + 1);
+
+    trace.set(C::execution_sel, 2 * SEGMENT_ROWS, 0);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 4);
+    trace.set(C::execution_sel, 3, 0);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 0);
+}
+
+TEST(TraceContainerTest, VisitColumnSkipsZeroes)
+{
+    TraceContainer trace;
+
+    trace.set(C::execution_sel, 1, 1);
+    trace.set(C::execution_sel, 2, 0);
+    trace.set(C::execution_sel, SEGMENT_ROWS, 3);
+
+    std::vector<std::pair<uint32_t, FF>> visited;
+    trace.visit_column(C::execution_sel, [&](uint32_t row, const FF& value) { visited.emplace_back(row, value); });
+    EXPECT_THAT(visited, ElementsAre(Pair(1, 1), Pair(SEGMENT_ROWS, 3)));
+}
+
+TEST(TraceContainerTest, ConcurrentWrites)
+{
+    TraceContainer trace;
+    const uint32_t num_rows = 10 * SEGMENT_ROWS;
+
+    parallel_for(num_rows, [&](size_t row) { trace.set(C::execution_sel, static_cast<uint32_t>(row), row + 1); });
+
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), num_rows);
+    for (uint32_t row = 0; row < num_rows; ++row) {
+        EXPECT_EQ(trace.get(C::execution_sel, row), row + 1);
+    }
+}
+
+TEST(TraceContainerTest, ExtractColumn)
+{
+    TraceContainer trace;
+
+    // Single segment (handed over) and multi-segment (concatenated, with a gap) columns.
+    trace.set(C::execution_sel, 5, 1);
+    trace.set(C::alu_ia, 1, 2);
+    trace.set(C::alu_ia, 3 * SEGMENT_ROWS, 3);
+
+    auto single = trace.extract_column(C::execution_sel);
+    ASSERT_NE(single, nullptr);
+    EXPECT_EQ(single[5], 1);
+    EXPECT_EQ(single[4], 0);
+
+    auto multi = trace.extract_column(C::alu_ia);
+    ASSERT_NE(multi, nullptr);
+    EXPECT_EQ(multi[1], 2);
+    EXPECT_EQ(multi[SEGMENT_ROWS + 1], 0);
+    EXPECT_EQ(multi[3 * SEGMENT_ROWS], 3);
+
+    // Extracted columns are cleared.
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 0);
+    EXPECT_EQ(trace.get(C::alu_ia, 1), 0);
+    EXPECT_EQ(trace.extract_column(C::execution_sel), nullptr);
+}
+
+} // namespace
+} // namespace bb::avm2::tracegen
@@ -119,7 +119,9 @@ void WorldState::create_canonical_fork(const std::string& dataDir,
         std::filesystem::path directory = dataDir;
         directory /= name;
         std::filesystem::create_directories(directory);
-        return std::make_shared<LMDBTreeStore>(directory, name, dbSize.at(id), maxReaders);
+        auto store = std::make_shared<LMDBTreeStore>(directory, name, dbSize.at(id), maxReaders);
+        store->get_pinned_node_cache().set_levels(DEFAULT_PINNED_NODE_LEVELS);
+        return store;
     };
     _persistentStores = std::make_unique<WorldStateStores>(createStore(MerkleTreeId::NULLIFIER_TREE),
                                                            createStore(MerkleTreeId::PUBLIC_DATA_TREE),
@@ -173,6 +175,7 @@ void WorldState::create_canonical_fork(const std::string& dataDir,
 
 void WorldState::copy_stores(const std::string& dstPath, bool compact) const
 {
+    wait_for_durability();
     auto copyStore = [&](const LMDBTreeStore::SharedPtr& store) {
         std::filesystem::path directory = dstPath;
         directory /= store->get_name();
@@ -183,6 +186,66 @@ void WorldState::copy_stores(const std::string& dstPath, bool compact) const
     std::for_each(_persistentStores->begin(), _persistentStores->end(), copyStore);
 }
 
+void WorldState::set_pinned_node_levels(uint32_t levels)
+{
+    for (const auto& store : *_persistentStores) {
+        store->get_pinned_node_cache().set_levels(levels);
+    }
+}
+
+LMDBTreeStore::SharedPtr WorldState::get_persistent_store(MerkleTreeId tree_id) const
+{
+    switch (tree_id) {
+    case MerkleTreeId::NULLIFIER_TREE:
+        return _persistentStores->nullifierStore;
+    case MerkleTreeId::NOTE_HASH_TREE:
+        return _persistentStores->noteHashStore;
+    case MerkleTreeId::PUBLIC_DATA_TREE:
+        return _persistentStores->publicDataStore;
+    case MerkleTreeId::L1_TO_L2_MESSAGE_TREE:
+        return _persistentStores->messageStore;
+    case MerkleTreeId::ARCHIVE:
+        return _persistentStores->archiveStore;
+    default:
+        throw std::runtime_error("Unknown tree");
+    }
+}
+
+void WorldState::enable_leaf_key_filter(MerkleTreeId tree_id, double false_positive_rate)
+{
+    get_persistent_store(tree_id)->enable_leaf_key_filter(false_positive_rate);
+}
+
+void WorldState::disable_leaf_key_filter(MerkleTreeId tree_id)
+{
+    get_persistent_store(tree_id)->disable_leaf_key_filter();
+}
+
+LeafKeyFilterStats WorldState::get_leaf_key_filter_stats(MerkleTreeId tree_id) const
+{
+    return get_persistent_store(tree_id)->get_leaf_key_filter().get_stats();
+}
+
+void WorldState::rebuild_stale_leaf_key_filters()
+{
+    // Once after the last block is unwound, rather than after each one
+    for (const auto& store : *_persistentStores) {
+        store->rebuild_leaf_key_filter_if_needed(true);
+    }
+}
+
+uint64_t WorldState::migrate_to_fixed_width_records()
+{
+    uint64_t numMigrated = 0;
+    numMigrated += _persistentStores->nullifierStore->migrate_to_fixed_width_records<IndexedLeaf<NullifierLeafValue>>();
+    numMigrated +=
+        _persistentStores->publicDataStore->migrate_to_fixed_width_records<IndexedLeaf<PublicDataLeafValue>>();
+    numMigrated += _persistentStores->archiveStore->migrate_to_fixed_width_records<IndexedLeaf<bb::fr>>();
+    numMigrated += _persistentStores->noteHashStore->migrate_to_fixed_width_records<IndexedLeaf<bb::fr>>();
+    numMigrated += _persistentStores->messageStore->migrate_to_fixed_width_records<IndexedLeaf<bb::fr>>();
+    return numMigrated;
+}
+
 Fork::SharedPtr WorldState::retrieve_fork(const uint64_t& forkId) const
 {
     std::unique_lock lock(mtx);
@@ -194,6 +257,8 @@ Fork::SharedPtr WorldState::retrieve_fork(const uint64_t& forkId) const
 }
 uint64_t WorldState::create_fork(const std::optional<block_number_t>& blockNumber)
 {
+    // Forks are created from the committed state, which must include every committed block
+    wait_for_durability();
     block_number_t blockNumberForFork = 0;
     if (!blockNumber.has_value()) {
         // we are forking at latest
@@ -461,6 +526,38 @@ fr_sibling_path WorldState::get_sibling_path(const WorldStateRevision& revision,
         fork->_trees.at(tree_id));
 }
 
+SiblingPathsBatch WorldState::get_sibling_paths(const WorldStateRevision& revision,
+                                                MerkleTreeId tree_id,
+                                                const std::vector<index_t>& leaf_indices) const
+{
+    Fork::SharedPtr fork = retrieve_fork(revision.forkId);
+
+    return std::visit(
+        [&leaf_indices, revision](auto&& wrapper) {
+            Signal signal(1);
+            TypedResponse<GetSiblingPathsResponse> local;
+
+            auto callback = [&signal, &local](TypedResponse<GetSiblingPathsResponse>& response) {
+                local = std::move(response);
+                signal.signal_level(0);
+            };
+
+            if (revision.blockNumber) {
+                wrapper.tree->get_sibling_paths(
+                    leaf_indices, revision.blockNumber, revision.includeUncommitted, callback);
+            } else {
+                wrapper.tree->get_sibling_paths(leaf_indices, revision.includeUncommitted, callback);
+            }
+            signal.wait_for_level(0);
+
+            if (!local.success) {
+                throw std::runtime_error(local.message);
+            }
+            return std::move(local.inner.paths);
+        },
+        fork->_trees.at(tree_id));
+}
+
 void WorldState::get_block_numbers_for_leaf_indices(const WorldStateRevision& revision,
                                                     MerkleTreeId tree_id,
                                                     const std::vector<index_t>& leafIndices,
@@ -522,6 +619,10 @@ void WorldState::update_archive(const StateReference& block_state_ref,
 std::pair<bool, std::string> WorldState::commit(WorldStateStatusFull& status)
 {
     // NOTE: the calling code is expected to ensure no other reads or writes happen during commit
+    std::optional<std::string> commitError = get_commit_error();
+    if (commitError.has_value()) {
+        return std::make_pair(false, commitError.value());
+    }
     Fork::SharedPtr fork = retrieve_fork(CANONICAL_FORK_ID);
     std::atomic_bool success = true;
     std::string message;
@@ -561,12 +662,129 @@ std::pair<bool, std::string> WorldState::commit(WorldStateStatusFull& status)
     }
 
     signal.wait_for_level(0);
+
+    if (_pipelinedCommits) {
+        if (!success) {
+            // The blocks committed before this one are still being written. The writer stops at the first error, so
+            // it is recorded once they are written, they must not be discarded along with this block. The block may
+            // have been staged in some of the trees, it is discarded from all of them by rollback
+            _commitWriter->wait();
+            set_commit_error(message);
+        } else {
+            block_number_t blockNumber = status.meta.archiveTreeMeta.unfinalisedBlockHeight;
+            _commitWriter->enqueue([this, fork, blockNumber]() { write_staged_block(fork, blockNumber); });
+        }
+    }
     return std::make_pair(success.load(), message);
 }
 
+void WorldState::write_staged_block(const Fork::SharedPtr& fork, const block_number_t& blockNumber)
+{
+    if (get_commit_error().has_value()) {
+        // An earlier block failed to be written, the blocks after it are not written
+        return;
+    }
+    // The trees are written one after the other, the archive last. A block is in the archive only once it has been
+    // written to all other trees, if writing it fails part way the trees ahead are unwound by rollback or on restart.
+    std::array<MerkleTreeId, NUM_TREES> tree_ids{ MerkleTreeId::NULLIFIER_TREE,
+                                                   MerkleTreeId::NOTE_HASH_TREE,
+                                                   MerkleTreeId::PUBLIC_DATA_TREE,
+                                                   MerkleTreeId::L1_TO_L2_MESSAGE_TREE,
+                                                   MerkleTreeId::ARCHIVE };
+    for (auto id : tree_ids) {
+        TypedResponse<CommitResponse> local;
+        std::visit(
+            [&local](auto&& wrapper) {
+                wrapper.tree->persist_staged_block(
+                    [&local](TypedResponse<CommitResponse>& response) { local = std::move(response); });
+            },
+            fork->_trees.at(id));
+        if (!local.success) {
+            set_commit_error(format("Failed to write block ", blockNumber, ": ", local.message));
+            return;
+        }
+    }
+}
+
+std::optional<std::string> WorldState::get_commit_error() const
+{
+    std::unique_lock lock(_commitMtx);
+    return _commitError;
+}
+
+void WorldState::set_commit_error(const std::string& message)
+{
+    std::unique_lock lock(_commitMtx);
+    // Only the first error is kept
+    if (!_commitError.has_value()) {
+        _commitError = message;
+    }
+}
+
+void WorldState::set_pipelined_commits(bool enabled)
+{
+    if (!enabled) {
+        wait_for_durability();
+    } else if (!_commitWriter) {
+        // A single writer thread writes the blocks in the order they were committed
+        _commitWriter = std::make_unique<ThreadPool>(1);
+    }
+    _pipelinedCommits = enabled;
+}
+
+void WorldState::wait_for_durability() const
+{
+    if (_commitWriter) {
+        _commitWriter->wait();
+    }
+    std::optional<std::string> commitError = get_commit_error();
+    if (commitError.has_value()) {
+        throw std::runtime_error(commitError.value());
+    }
+}
+
+void WorldState::discard_staged_blocks()
+{
+    // Wait for the writer to have stopped before discarding the blocks it has not written
+    _commitWriter->wait();
+    Fork::SharedPtr fork = retrieve_fork(CANONICAL_FORK_ID);
+    Signal signal(static_cast<uint32_t>(fork->_trees.size()));
+    std::array<Response, NUM_TREES> local;
+    std::mutex mtx;
+    for (auto& [id, tree] : fork->_trees) {
+        std::visit(
+            [&signal, &local, id, &mtx](auto&& wrapper) {
+                wrapper.tree->discard_staged_blocks([&signal, &local, &mtx, id](Response& resp) {
+                    {
+                        std::lock_guard<std::mutex> lock(mtx);
+                        local[id] = std::move(resp);
+                    }
+                    signal.signal_decrement();
+                });
+            },
+            tree);
+    }
+    signal.wait_for_level();
+    for (auto& m : local) {
+        if (!m.success) {
+            throw std::runtime_error(m.message);
+        }
+    }
+    {
+        std::unique_lock lock(_commitMtx);
+        _commitError.reset();
+    }
+    // The trees that wrote the failed block are unwound to the last block written to all trees
+    attempt_tree_resync();
+}
+
 void WorldState::rollback()
 {
     // NOTE: the calling code is expected to ensure no other reads or writes happen during rollback
+    if (get_commit_error().has_value()) {
+        discard_staged_blocks();
+        return;
+    }
     Fork::SharedPtr fork = retrieve_fork(CANONICAL_FORK_ID);
     Signal signal(static_cast<uint32_t>(fork->_trees.size()));
     for (auto& [id, tree] : fork->_trees) {
@@ -586,6 +804,10 @@ WorldStateStatusFull WorldState::sync_block(const StateReference& block_state_re
                                             const std::vector<crypto::merkle_tree::NullifierLeafValue>& nullifiers,
                                             const std::vector<crypto::merkle_tree::PublicDataLeafValue>& public_writes)
 {
+    std::optional<std::string> commitError = get_commit_error();
+    if (commitError.has_value()) {
+        throw std::runtime_error(commitError.value());
+    }
     validate_trees_are_equally_synched();
     WorldStateStatusFull status;
     if (is_same_state_reference(WorldStateRevision::uncommitted(), block_state_ref) &&
@@ -718,6 +940,7 @@ GetLowIndexedLeafResponse WorldState::find_low_leaf_index(const WorldStateRevisi
 
 WorldStateStatusSummary WorldState::set_finalised_blocks(const block_number_t& toBlockNumber)
 {
+    wait_for_durability();
     // This will throw if it fails
     set_finalised_block(toBlockNumber);
     WorldStateStatusSummary status;
@@ -726,6 +949,7 @@ WorldStateStatusSummary WorldState::set_finalised_blocks(const block_number_t& t
 }
 WorldStateStatusFull WorldState::unwind_blocks(const block_number_t& toBlockNumber)
 {
+    wait_for_durability();
     WorldStateRevision revision{ .forkId = CANONICAL_FORK_ID, .blockNumber = 0, .includeUncommitted = false };
     std::array<TreeMeta, NUM_TREES> responses;
     get_all_tree_info(revision, responses);
@@ -754,12 +978,14 @@ WorldStateStatusFull WorldState::unwind_blocks(const block_number_t& toBlockNumb
         // This will throw if it fails
         unwind_block(blockNumber, status);
     }
+    rebuild_stale_leaf_key_filters();
     populate_status_summary(status);
     return status;
 }
 
 WorldStateStatusFull WorldState::remove_historical_blocks(const block_number_t& toBlockNumber)
 {
+    wait_for_durability();
     WorldStateRevision revision{ .forkId = CANONICAL_FORK_ID, .blockNumber = 0, .includeUncommitted = false };
     std::array<TreeMeta, NUM_TREES> responses;
     get_all_tree_info(revision, responses);
@@ -1038,7 +1264,10 @@ bool WorldState::is_same_state_reference(const WorldStateRevision& revision, con
 
 void WorldState::validate_trees_are_equally_synched()
 {
-    WorldStateRevision revision{ .forkId = CANONICAL_FORK_ID, .blockNumber = 0, .includeUncommitted = false };
+    // The staged blocks are written to one tree after the other, they are checked instead of the committed state
+    WorldStateRevision revision{
+        .forkId = CANONICAL_FORK_ID, .blockNumber = 0, .includeUncommitted = _pipelinedCommits
+    };
     std::array<TreeMeta, NUM_TREES> responses;
     get_all_tree_info(revision, responses);
 
@@ -1245,6 +1474,7 @@ WorldStateStatusFull WorldState::attempt_tree_resync()
         unwind_block(blockToUnwind, status);
         blockToUnwind--;
     }
+    rebuild_stale_leaf_key_filters();
 
     if (*finalisedBlockRange.first != *finalisedBlockRange.second) {
         set_finalised_block(*finalisedBlockRange.second);
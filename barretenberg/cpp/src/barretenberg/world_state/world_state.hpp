@@ -23,6 +23,7 @@
 #include <exception>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <type_traits>
@@ -49,6 +50,7 @@ template <typename LeafValueType> struct SequentialInsertionResult {
 };
 
 const uint64_t DEFAULT_MIN_NUMBER_OF_READERS = 128;
+const uint32_t DEFAULT_PINNED_NODE_LEVELS = 16;
 
 /**
  * @brief Holds the Merkle trees responsible for storing the state of the Aztec protocol.
@@ -96,6 +98,42 @@ class WorldState {
      */
     void copy_stores(const std::string& dstPath, bool compact) const;
 
+    /**
+     * @brief Sets the number of upper levels of every tree whose committed nodes are cached in memory
+     * @details The cache of a tree is shared by the canonical fork and all other forks, and is cleared whenever a block
+     * is committed, unwound or removed. 0 disables it. Defaults to DEFAULT_PINNED_NODE_LEVELS.
+     *
+     * @param levels The number of levels to cache, starting from the root
+     */
+    void set_pinned_node_levels(uint32_t levels);
+
+    /**
+     * @brief Enables the filter of the keys committed to a tree
+     * @details The filter answers most lookups of keys absent from the committed state of the tree, such as those of
+     * find_leaf_indices for the nullifiers of a new transaction, without reading the store. It is shared by the
+     * canonical fork and all other forks. It is loaded from the directory of the tree if it was saved there at the
+     * committed block, otherwise it is built from the leaf indices of the tree.
+     *
+     * @param tree_id The tree to filter the keys of
+     * @param false_positive_rate The target rate of absent keys the filter passes on to the store
+     */
+    void enable_leaf_key_filter(MerkleTreeId tree_id,
+                                double false_positive_rate = LeafKeyFilter::DEFAULT_FALSE_POSITIVE_RATE);
+
+    void disable_leaf_key_filter(MerkleTreeId tree_id);
+
+    LeafKeyFilterStats get_leaf_key_filter_stats(MerkleTreeId tree_id) const;
+
+    /**
+     * @brief Rewrites the nodes and leaf preimages of every tree written in msgpack by earlier versions as fixed width
+     * records
+     * @details Databases written by earlier versions remain readable without it, the migration only brings the size
+     * and read cost of their existing values down to those of newly written values. It can be run again if interrupted.
+     *
+     * @return The number of values rewritten
+     */
+    uint64_t migrate_to_fixed_width_records();
+
     /**
      * @brief Get tree metadata for a particular tree
      *
@@ -132,6 +170,19 @@ class WorldState {
                                                           MerkleTreeId tree_id,
                                                           index_t leaf_index) const;
 
+    /**
+     * @brief Get the sibling paths of a batch of leaves in a tree
+     * @details The tree is walked once for the batch and the nodes shared by several paths are returned once
+     *
+     * @param revision The revision to query
+     * @param tree_id The ID of the tree
+     * @param leaf_indices The indices of the leaves
+     * @return crypto::merkle_tree::SiblingPathsBatch
+     */
+    crypto::merkle_tree::SiblingPathsBatch get_sibling_paths(const WorldStateRevision& revision,
+                                                             MerkleTreeId tree_id,
+                                                             const std::vector<index_t>& leaf_indices) const;
+
     void get_block_numbers_for_leaf_indices(const WorldStateRevision& revision,
                                             MerkleTreeId tree_id,
                                             const std::vector<index_t>& leafIndices,
@@ -269,9 +320,30 @@ class WorldState {
 
     /**
      * @brief Rolls back any uncommitted changes made to the world state.
+     * @details If writing a pipelined block failed, this also discards the blocks that have not been written and
+     * unwinds the trees to the last block written to all of them.
      */
     void rollback();
 
+    /**
+     * @brief Enables or disables the pipelined commit of blocks
+     * @details When enabled, commit and sync_block stage the block of each tree in memory and return without waiting
+     * for it to be written. The staged blocks are written to the stores in order by a dedicated writer thread while
+     * the next block is built on top of them. Uncommitted reads include the staged blocks, committed and historical
+     * reads only include the blocks that have been written. Unwinding, removing and finalising blocks as well as
+     * creating forks and copying the stores first wait for every staged block to be written. Disabled by default.
+     *
+     * @param enabled Whether blocks are committed in a pipeline. Disabling waits for the staged blocks to be written.
+     */
+    void set_pipelined_commits(bool enabled);
+
+    /**
+     * @brief Waits until every committed block has been written to the stores
+     * @details Throws if writing a pipelined block failed. That block and the ones committed after it are not written
+     * and further commits are refused until rollback is called.
+     */
+    void wait_for_durability() const;
+
     uint64_t create_fork(const std::optional<block_number_t>& blockNumber);
     void delete_fork(const uint64_t& forkId);
 
@@ -304,6 +376,13 @@ class WorldState {
     uint64_t _forkId = 0;
     uint32_t _initial_header_generator_point;
 
+    bool _pipelinedCommits = false;
+    mutable std::mutex _commitMtx;
+    // The error of the first pipelined block that failed to be written
+    std::optional<std::string> _commitError;
+    // Declared last so that it is destroyed first, writing the blocks still staged before the trees are destroyed
+    std::unique_ptr<bb::ThreadPool> _commitWriter;
+
     TreeStateReference get_tree_snapshot(MerkleTreeId id);
     void create_canonical_fork(const std::string& dataDir,
                                const std::unordered_map<MerkleTreeId, uint64_t>& dbSize,
@@ -311,10 +390,13 @@ class WorldState {
                                uint64_t maxReaders);
 
     Fork::SharedPtr retrieve_fork(const uint64_t& forkId) const;
+    LMDBTreeStore::SharedPtr get_persistent_store(MerkleTreeId tree_id) const;
     Fork::SharedPtr create_new_fork(const block_number_t& blockNumber);
     void remove_forks_for_block(const block_number_t& blockNumber);
 
     bool unwind_block(const block_number_t& blockNumber, WorldStateStatusFull& status);
+    // Rebuilds the leaf key filters holding keys removed by unwinds
+    void rebuild_stale_leaf_key_filters();
     bool remove_historical_block(const block_number_t& blockNumber, WorldStateStatusFull& status);
     bool set_finalised_block(const block_number_t& blockNumber);
 
@@ -322,6 +404,14 @@ class WorldState {
 
     void validate_trees_are_equally_synched();
 
+    void write_staged_block(const Fork::SharedPtr& fork, const block_number_t& blockNumber);
+
+    std::optional<std::string> get_commit_error() const;
+
+    void set_commit_error(const std::string& message);
+
+    void discard_staged_blocks();
+
     WorldStateStatusFull attempt_tree_resync();
 
     static bool block_state_matches_world_state(const StateReference& block_state_ref,
@@ -378,7 +468,7 @@ void WorldState::commit_tree(TreeDBStats& dbStats,
                              std::string& message,
                              TreeMeta& meta)
 {
-    tree.commit([&](TypedResponse<CommitResponse>& response) {
+    auto callback = [&](TypedResponse<CommitResponse>& response) {
         bool expected = true;
         if (!response.success && success.compare_exchange_strong(expected, false)) {
             message = response.message;
@@ -386,7 +476,12 @@ void WorldState::commit_tree(TreeDBStats& dbStats,
         dbStats = std::move(response.inner.stats);
         meta = std::move(response.inner.meta);
         signal.signal_decrement();
-    });
+    };
+    if (_pipelinedCommits) {
+        tree.stage_block(callback);
+    } else {
+        tree.commit(callback);
+    }
 }
 
 template <typename TreeType>
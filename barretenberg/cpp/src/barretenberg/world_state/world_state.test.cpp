@@ -926,3 +926,212 @@ TEST_F(WorldStateTest, GetBlockForIndex)
         EXPECT_EQ(blockNumbers[0].value(), 1);
     }
 }
+
+// Appends a block to every tree. Its nullifiers interleave with those of the earlier blocks and its public data writes
+// update the slots written by them.
+void append_test_block(WorldState& ws, uint32_t blockNumber, uint32_t numNotes)
+{
+    std::vector<fr> notes;
+    for (uint32_t i = 0; i < numNotes; i++) {
+        notes.emplace_back(blockNumber * 1000 + i);
+    }
+    ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, notes);
+    ws.append_leaves<fr>(MerkleTreeId::L1_TO_L2_MESSAGE_TREE, { fr(blockNumber) });
+    std::vector<NullifierLeafValue> nullifiers{ NullifierLeafValue(1000 + blockNumber),
+                                                NullifierLeafValue(5000 - blockNumber) };
+    ws.append_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, nullifiers);
+    ws.append_leaves<PublicDataLeafValue>(MerkleTreeId::PUBLIC_DATA_TREE,
+                                          { PublicDataLeafValue(200 + (blockNumber % 3), blockNumber) });
+    ws.append_leaves<fr>(MerkleTreeId::ARCHIVE, { fr(blockNumber) });
+}
+
+// Commits blocks in pipelined mode until writing one of them fails. Returns the state reference after each committed
+// block, starting with the initial state.
+std::vector<StateReference> commit_blocks_until_write_fails(WorldState& ws)
+{
+    std::vector<StateReference> states{ ws.get_state_reference(WorldStateRevision::uncommitted()) };
+    for (uint32_t blockNumber = 1; blockNumber <= 64; blockNumber++) {
+        append_test_block(ws, blockNumber, 64);
+        WorldStateStatusFull status;
+        if (!ws.commit(status).first) {
+            break;
+        }
+        states.push_back(ws.get_state_reference(WorldStateRevision::uncommitted()));
+    }
+    EXPECT_THROW(ws.wait_for_durability(), std::runtime_error);
+    return states;
+}
+
+TEST_F(WorldStateTest, PipelinedCommitsMatchSequentialCommits)
+{
+    std::string sequential_dir = data_dir + "/sequential";
+    std::string pipelined_dir = data_dir + "/pipelined";
+    WorldState sequential(
+        thread_pool_size, sequential_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    WorldState pipelined(
+        thread_pool_size, pipelined_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    pipelined.set_pipelined_commits(true);
+
+    auto expect_same_state = [&](const WorldStateRevision& revision, uint32_t lastBlockNumber) {
+        EXPECT_EQ(pipelined.get_state_reference(revision), sequential.get_state_reference(revision));
+        for (uint32_t blockNumber = 1; blockNumber <= lastBlockNumber; blockNumber++) {
+            std::vector<NullifierLeafValue> nullifiers{ NullifierLeafValue(1000 + blockNumber),
+                                                        NullifierLeafValue(5000 - blockNumber) };
+            std::vector<std::optional<index_t>> sequentialIndices;
+            std::vector<std::optional<index_t>> pipelinedIndices;
+            sequential.find_leaf_indices(revision, MerkleTreeId::NULLIFIER_TREE, nullifiers, sequentialIndices);
+            pipelined.find_leaf_indices(revision, MerkleTreeId::NULLIFIER_TREE, nullifiers, pipelinedIndices);
+            EXPECT_EQ(pipelinedIndices, sequentialIndices);
+        }
+        for (uint32_t slot = 199; slot < 204; slot++) {
+            auto sequentialLowLeaf = sequential.find_low_leaf_index(revision, MerkleTreeId::PUBLIC_DATA_TREE, fr(slot));
+            auto pipelinedLowLeaf = pipelined.find_low_leaf_index(revision, MerkleTreeId::PUBLIC_DATA_TREE, fr(slot));
+            EXPECT_EQ(pipelinedLowLeaf.index, sequentialLowLeaf.index);
+            EXPECT_EQ(pipelinedLowLeaf.is_already_present, sequentialLowLeaf.is_already_present);
+        }
+        EXPECT_EQ(pipelined.get_sibling_path(revision, MerkleTreeId::NOTE_HASH_TREE, 0),
+                  sequential.get_sibling_path(revision, MerkleTreeId::NOTE_HASH_TREE, 0));
+    };
+
+    for (uint32_t blockNumber = 1; blockNumber <= 8; blockNumber++) {
+        append_test_block(sequential, blockNumber, 8);
+        append_test_block(pipelined, blockNumber, 8);
+        // The block is built on top of the blocks that may not have been written yet
+        expect_same_state(WorldStateRevision::uncommitted(), blockNumber);
+
+        WorldStateStatusFull sequentialStatus;
+        WorldStateStatusFull pipelinedStatus;
+        EXPECT_TRUE(sequential.commit(sequentialStatus).first);
+        EXPECT_TRUE(pipelined.commit(pipelinedStatus).first);
+        EXPECT_EQ(pipelinedStatus.meta.archiveTreeMeta, sequentialStatus.meta.archiveTreeMeta);
+        EXPECT_EQ(pipelinedStatus.meta.nullifierTreeMeta, sequentialStatus.meta.nullifierTreeMeta);
+        expect_same_state(WorldStateRevision::uncommitted(), blockNumber);
+    }
+
+    pipelined.wait_for_durability();
+
+    expect_same_state(WorldStateRevision::committed(), 8);
+    expect_same_state(WorldStateRevision{ .forkId = CANONICAL_FORK_ID, .blockNumber = 4, .includeUncommitted = false },
+                      4);
+    WorldStateStatusSummary sequentialSummary;
+    WorldStateStatusSummary pipelinedSummary;
+    sequential.get_status_summary(sequentialSummary);
+    pipelined.get_status_summary(pipelinedSummary);
+    EXPECT_EQ(pipelinedSummary, sequentialSummary);
+}
+
+TEST_F(WorldStateTest, PipelinedCommitsAreWrittenOnShutdown)
+{
+    StateReference expected;
+    {
+        WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+        ws.set_pipelined_commits(true);
+        for (uint32_t blockNumber = 1; blockNumber <= 6; blockNumber++) {
+            append_test_block(ws, blockNumber, 8);
+            WorldStateStatusFull status;
+            EXPECT_TRUE(ws.commit(status).first);
+        }
+        expected = ws.get_state_reference(WorldStateRevision::uncommitted());
+        // Destroyed without waiting for the blocks to be written
+    }
+
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    WorldStateStatusSummary summary;
+    ws.get_status_summary(summary);
+    EXPECT_EQ(summary.unfinalisedBlockNumber, 6);
+    EXPECT_TRUE(summary.treesAreSynched);
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision::committed()), expected);
+    assert_tree_size(ws, WorldStateRevision::committed(), MerkleTreeId::ARCHIVE, 7);
+}
+
+TEST_F(WorldStateTest, PipelinedCommitRecoversFromFailedWrite)
+{
+    // The note hash tree runs out of space part way through the blocks, after the nullifier tree wrote the block
+    std::unordered_map<MerkleTreeId, uint64_t> map_sizes{
+        { MerkleTreeId::NULLIFIER_TREE, map_size },   { MerkleTreeId::NOTE_HASH_TREE, 256 },
+        { MerkleTreeId::PUBLIC_DATA_TREE, map_size }, { MerkleTreeId::L1_TO_L2_MESSAGE_TREE, map_size },
+        { MerkleTreeId::ARCHIVE, map_size },
+    };
+    WorldState ws(thread_pool_size, data_dir, map_sizes, tree_heights, tree_prefill, initial_header_generator_point);
+    ws.set_pipelined_commits(true);
+    std::vector<StateReference> states = commit_blocks_until_write_fails(ws);
+
+    // Commits are refused until the failure is rolled back
+    WorldStateStatusFull status;
+    EXPECT_FALSE(ws.commit(status).first);
+    ws.rollback();
+    EXPECT_NO_THROW(ws.wait_for_durability());
+
+    // All trees are back at the last block written to every one of them
+    WorldStateStatusSummary summary;
+    ws.get_status_summary(summary);
+    EXPECT_TRUE(summary.treesAreSynched);
+    ASSERT_LT(summary.unfinalisedBlockNumber, states.size() - 1);
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision::committed()), states[summary.unfinalisedBlockNumber]);
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision::uncommitted()), states[summary.unfinalisedBlockNumber]);
+    assert_tree_size(ws, WorldStateRevision::committed(), MerkleTreeId::ARCHIVE, summary.unfinalisedBlockNumber + 1);
+}
+
+TEST_F(WorldStateTest, PipelinedCommitKeepsEarlierBlocksWhenStagingFails)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    ws.set_pipelined_commits(true);
+    std::vector<StateReference> states{ ws.get_state_reference(WorldStateRevision::uncommitted()) };
+    for (uint32_t blockNumber = 1; blockNumber <= 8; blockNumber++) {
+        append_test_block(ws, blockNumber, 8);
+        WorldStateStatusFull status;
+        EXPECT_TRUE(ws.commit(status).first);
+        states.push_back(ws.get_state_reference(WorldStateRevision::uncommitted()));
+    }
+
+    // A block can not be staged with an active checkpoint, the earlier blocks may still be queued for writing
+    ws.checkpoint(CANONICAL_FORK_ID);
+    append_test_block(ws, 9, 8);
+    WorldStateStatusFull status;
+    EXPECT_FALSE(ws.commit(status).first);
+    EXPECT_THROW(ws.wait_for_durability(), std::runtime_error);
+    ws.rollback();
+    EXPECT_NO_THROW(ws.wait_for_durability());
+
+    // Every block acknowledged before the failure was written
+    WorldStateStatusSummary summary;
+    ws.get_status_summary(summary);
+    EXPECT_TRUE(summary.treesAreSynched);
+    EXPECT_EQ(summary.unfinalisedBlockNumber, 8);
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision::committed()), states.back());
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision::uncommitted()), states.back());
+    assert_tree_size(ws, WorldStateRevision::committed(), MerkleTreeId::ARCHIVE, 9);
+
+    // Commits are accepted again
+    append_test_block(ws, 9, 8);
+    EXPECT_TRUE(ws.commit(status).first);
+    ws.wait_for_durability();
+    ws.get_status_summary(summary);
+    EXPECT_EQ(summary.unfinalisedBlockNumber, 9);
+}
+
+TEST_F(WorldStateTest, PipelinedCommitIsConsistentOnRestartAfterFailedWrite)
+{
+    std::unordered_map<MerkleTreeId, uint64_t> map_sizes{
+        { MerkleTreeId::NULLIFIER_TREE, map_size },   { MerkleTreeId::NOTE_HASH_TREE, 256 },
+        { MerkleTreeId::PUBLIC_DATA_TREE, map_size }, { MerkleTreeId::L1_TO_L2_MESSAGE_TREE, map_size },
+        { MerkleTreeId::ARCHIVE, map_size },
+    };
+    std::vector<StateReference> states;
+    {
+        WorldState ws(
+            thread_pool_size, data_dir, map_sizes, tree_heights, tree_prefill, initial_header_generator_point);
+        ws.set_pipelined_commits(true);
+        states = commit_blocks_until_write_fails(ws);
+        // Destroyed without rolling back, as if the process had stopped
+    }
+
+    // The trees that wrote the failed block are unwound when the world state is opened again
+    WorldState ws(thread_pool_size, data_dir, map_sizes, tree_heights, tree_prefill, initial_header_generator_point);
+    WorldStateStatusSummary summary;
+    ws.get_status_summary(summary);
+    EXPECT_TRUE(summary.treesAreSynched);
+    ASSERT_LT(summary.unfinalisedBlockNumber, states.size() - 1);
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision::committed()), states[summary.unfinalisedBlockNumber]);
+    assert_tree_size(ws, WorldStateRevision::committed(), MerkleTreeId::ARCHIVE, summary.unfinalisedBlockNumber + 1);
+}
@@ -142,6 +142,16 @@ export class MerkleTreesFacade implements MerkleTreeReadOperations {
     return new SiblingPath(siblingPath.length, siblingPath) as any;
   }
 
+  async getSiblingPaths<N extends number>(treeId: MerkleTreeId, leafIndices: bigint[]): Promise<SiblingPath<N>[]> {
+    const { nodes, paths } = await this.instance.call(WorldStateMessageType.GET_SIBLING_PATHS, {
+      leafIndices,
+      revision: this.revision,
+      treeId,
+    });
+
+    return paths.map(path => new SiblingPath<N>(path.length as N, path.map(node => nodes[node])));
+  }
+
   async getStateReference(): Promise<StateReference> {
     const resp = await this.instance.call(WorldStateMessageType.GET_STATE_REFERENCE, {
       revision: this.revision,
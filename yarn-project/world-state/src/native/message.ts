@@ -46,6 +46,12 @@ export enum WorldStateMessageType {
 
   COPY_STORES,
 
+  GET_SIBLING_PATHS,
+
+  ENABLE_LEAF_KEY_FILTER,
+  DISABLE_LEAF_KEY_FILTER,
+  GET_LEAF_KEY_FILTER_STATS,
+
   CLOSE = 999,
 }
 
@@ -335,6 +341,15 @@ interface GetBlockNumbersForLeafIndicesResponse {
 interface GetSiblingPathRequest extends WithTreeId, WithLeafIndex, WithWorldStateRevision {}
 type GetSiblingPathResponse = Buffer[];
 
+interface GetSiblingPathsRequest extends WithTreeId, WithWorldStateRevision {
+  leafIndices: bigint[];
+}
+/** The distinct nodes of the paths, each path being the positions of its siblings in `nodes` from the leaf up. */
+interface GetSiblingPathsResponse {
+  nodes: Buffer[];
+  paths: number[][];
+}
+
 interface GetStateReferenceRequest extends WithWorldStateRevision {}
 interface GetStateReferenceResponse {
   state: Record<MerkleTreeId, TreeStateReference>;
@@ -433,6 +448,34 @@ interface CopyStoresRequest extends WithCanonicalForkId {
   compact: boolean;
 }
 
+interface EnableLeafKeyFilterRequest extends WithTreeId, WithCanonicalForkId {
+  /** The target false positive rate of the filter, the native default if not given */
+  falsePositiveRate?: number;
+}
+
+interface LeafKeyFilterRequest extends WithTreeId, WithCanonicalForkId {}
+
+export interface LeafKeyFilterStats {
+  /** Whether the filter is enabled */
+  enabled: boolean;
+  /** The number of keys in the filter */
+  numKeys: bigint | number;
+  /** The number of keys the filter was sized for */
+  capacity: bigint | number;
+  numBits: bigint | number;
+  numHashes: number;
+  /** The committed lookups checked against the filter */
+  lookups: bigint | number;
+  /** The lookups answered by the filter without reading the store */
+  negatives: bigint | number;
+  /** The lookups passed on to the store that did not find the key */
+  falsePositives: bigint | number;
+  rebuilds: bigint | number;
+  estimatedFalsePositiveRate: number;
+  /** Whether keys have been removed from the store since the filter was built */
+  stale: boolean;
+}
+
 export type WorldStateRequestCategories = WithForkId | WithWorldStateRevision | WithCanonicalForkId;
 
 export function isWithForkId(body: WorldStateRequestCategories): body is WithForkId {
@@ -489,6 +532,12 @@ export type WorldStateRequest = {
 
   [WorldStateMessageType.COPY_STORES]: CopyStoresRequest;
 
+  [WorldStateMessageType.GET_SIBLING_PATHS]: GetSiblingPathsRequest;
+
+  [WorldStateMessageType.ENABLE_LEAF_KEY_FILTER]: EnableLeafKeyFilterRequest;
+  [WorldStateMessageType.DISABLE_LEAF_KEY_FILTER]: LeafKeyFilterRequest;
+  [WorldStateMessageType.GET_LEAF_KEY_FILTER_STATS]: LeafKeyFilterRequest;
+
   [WorldStateMessageType.CLOSE]: WithCanonicalForkId;
 };
 
@@ -534,6 +583,12 @@ export type WorldStateResponse = {
 
   [WorldStateMessageType.COPY_STORES]: void;
 
+  [WorldStateMessageType.GET_SIBLING_PATHS]: GetSiblingPathsResponse;
+
+  [WorldStateMessageType.ENABLE_LEAF_KEY_FILTER]: void;
+  [WorldStateMessageType.DISABLE_LEAF_KEY_FILTER]: void;
+  [WorldStateMessageType.GET_LEAF_KEY_FILTER_STATS]: LeafKeyFilterStats;
+
   [WorldStateMessageType.CLOSE]: void;
 };
 
@@ -26,6 +26,7 @@ import type { WorldStateTreeMapSizes } from '../synchronizer/factory.js';
 import type { MerkleTreeAdminDatabase as MerkleTreeDatabase } from '../world-state-db/merkle_tree_db.js';
 import { MerkleTreesFacade, MerkleTreesForkFacade, serializeLeaf } from './merkle_trees_facade.js';
 import {
+  type LeafKeyFilterStats,
   WorldStateMessageType,
   type WorldStateStatusFull,
   type WorldStateStatusSummary,
@@ -345,6 +346,28 @@ export class NativeWorldStateService implements MerkleTreeDatabase {
     });
     return fromEntries(NATIVE_WORLD_STATE_DBS.map(([name, dir]) => [name, join(dstPath, dir, 'data.mdb')] as const));
   }
+
+  /**
+   * Enables the filter of the keys committed to the given tree, used to answer lookups of absent keys without reading
+   * the store. The filter saved by a previous run is reused if it matches the committed state of the tree.
+   * @param treeId - The tree to filter the keys of.
+   * @param falsePositiveRate - The target false positive rate, the native default if not given.
+   */
+  public async enableLeafKeyFilter(treeId: MerkleTreeId, falsePositiveRate?: number): Promise<void> {
+    await this.instance.call(WorldStateMessageType.ENABLE_LEAF_KEY_FILTER, {
+      treeId,
+      falsePositiveRate,
+      canonical: true,
+    });
+  }
+
+  public async disableLeafKeyFilter(treeId: MerkleTreeId): Promise<void> {
+    await this.instance.call(WorldStateMessageType.DISABLE_LEAF_KEY_FILTER, { treeId, canonical: true });
+  }
+
+  public getLeafKeyFilterStats(treeId: MerkleTreeId): Promise<LeafKeyFilterStats> {
+    return this.instance.call(WorldStateMessageType.GET_LEAF_KEY_FILTER_STATS, { treeId, canonical: true });
+  }
 }
 
 // The following paths are defined in cpp-land
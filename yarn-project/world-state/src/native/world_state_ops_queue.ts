@@ -41,6 +41,8 @@ export const MUTATING_MSG_TYPES = new Set([
   WorldStateMessageType.CREATE_CHECKPOINT,
   WorldStateMessageType.COMMIT_CHECKPOINT,
   WorldStateMessageType.REVERT_CHECKPOINT,
+  WorldStateMessageType.ENABLE_LEAF_KEY_FILTER,
+  WorldStateMessageType.DISABLE_LEAF_KEY_FILTER,
 ]);
 
 // This class implements the per-fork operation queue